@@ -67,9 +67,9 @@ struct cartesian2 final : public coordinate_base<cartesian2, transform3_t> {
 
     /** This method transform from a point from global cartesian 3D frame to a
      * local 2D cartesian point */
-    DETRAY_HOST_DEVICE
-    inline point2 global_to_local(const transform3_t &trf3, const point3 &p,
-                                  const vector3 & /*d*/) const {
+    template <typename trf_t>
+    DETRAY_HOST_DEVICE inline point2 global_to_local(
+        const trf_t &trf3, const point3 &p, const vector3 & /*d*/) const {
         const auto local3 = trf3.point_to_local(p);
         return this->operator()(local3);
     }
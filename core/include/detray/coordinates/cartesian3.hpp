@@ -44,9 +44,9 @@ struct cartesian3 final : public coordinate_base<cartesian3, transform3_t> {
 
     /** This method transform from a point from global cartesian 3D frame to a
      * local 3D cartesian point */
-    DETRAY_HOST_DEVICE
-    inline point3 global_to_local(const transform3_t &trf, const point3 &p,
-                                  const vector3 & /*d*/) const {
+    template <typename trf_t>
+    DETRAY_HOST_DEVICE inline point3 global_to_local(
+        const trf_t &trf, const point3 &p, const vector3 & /*d*/) const {
         return trf.point_to_local(p);
     }
 
@@ -49,9 +49,9 @@ struct cylindrical3 final : public coordinate_base<cylindrical3, transform3_t> {
 
     /** This method transform from a point from global cartesian 3D frame to a
      * local 3D cylindrical point */
-    DETRAY_HOST_DEVICE
-    inline point3 global_to_local(const transform3_t &trf, const point3 &p,
-                                  const vector3 & /*d*/) const {
+    template <typename trf_t>
+    DETRAY_HOST_DEVICE inline point3 global_to_local(
+        const trf_t &trf, const point3 &p, const vector3 & /*d*/) const {
         const auto local3 = trf.point_to_local(p);
         return this->operator()(local3);
     }
@@ -70,9 +70,9 @@ struct polar2 : public coordinate_base<polar2, transform3_t> {
 
     /** This method transform from a point from global cartesian 3D frame to a
      * local 2D polar point */
-    DETRAY_HOST_DEVICE
-    inline point2 global_to_local(const transform3_t &trf, const point3 &p,
-                                  const vector3 & /*d*/) const {
+    template <typename trf_t>
+    DETRAY_HOST_DEVICE inline point2 global_to_local(
+        const trf_t &trf, const point3 &p, const vector3 & /*d*/) const {
         const auto local3 = trf.point_to_local(p);
         return this->operator()(local3);
     }
@@ -10,6 +10,10 @@
 // Project include(s)
 #include "detray/definitions/indexing.hpp"
 #include "detray/definitions/qualifiers.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s)
+#include <vector>
 
 namespace detray::detail {
 
@@ -24,6 +28,30 @@ struct get_surface {
     }
 };
 
+/// A functor to collect the surfaces of a surface finder in the order in
+/// which they are stored: grids are traversed bin by bin
+struct surface_collector {
+    template <typename collection_t, typename index_t, typename surface_t>
+    DETRAY_HOST inline void operator()(const collection_t& sf_finders,
+                                       const index_t& index,
+                                       std::vector<surface_t>& sfs) const {
+
+        const auto sf_finder = sf_finders[index];
+        if constexpr (is_grid_collection_v<collection_t>) {
+            for (std::size_t gbin = 0u; gbin < sf_finder.nbins(); ++gbin) {
+                for (const auto& sf :
+                     sf_finder.at(static_cast<dindex>(gbin))) {
+                    sfs.push_back(sf);
+                }
+            }
+        } else {
+            for (const auto& sf : sf_finder.all()) {
+                sfs.push_back(sf);
+            }
+        }
+    }
+};
+
 /// A functor to perform global to local transformation
 template <typename algebra_t>
 struct global_to_local {
@@ -14,6 +14,7 @@
 #include "detray/definitions/indexing.hpp"
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/utils/type_registry.hpp"
+#include "detray/utils/type_traits.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
@@ -30,17 +31,20 @@ namespace detray {
 /// @tparam Ts pack.
 /// @tparam context_t How to retrieve data according to e.g. conditions data
 /// @tparam tuple_t The type of the underlying tuple container.
-/// @tparam container_t The type of container to use for the respective
-///                     data collections.
+/// @tparam dispatch_v How to resolve a type ID in the @c visit calls.
 /// @tparam Ts the data types (value types of the collections)
-template <typename ID = std::size_t, typename context_t = empty_context,
-          template <typename...> class tuple_t = dtuple, typename... Ts>
-class multi_store {
+template <typename ID, typename context_t,
+          template <typename...> class tuple_t,
+          detail::visit_dispatch dispatch_v, typename... Ts>
+class basic_multi_store {
 
     public:
     using size_type = typename detail::first_t<Ts...>::size_type;
     using context_type = context_t;
 
+    /// The strategy used to call functors on a collection by type ID
+    static constexpr detail::visit_dispatch dispatch{dispatch_v};
+
     /// How to find and index a data collection in the store
     /// @{
     using ids = ID;
@@ -66,12 +70,12 @@ class multi_store {
     using const_view_type = typename tuple_type::const_view_type;
 
     /// Empty container
-    constexpr multi_store() = default;
+    constexpr basic_multi_store() = default;
 
     // Delegate constructors to tuple container, which handles the memory
 
     /// Copy construct from element types
-    constexpr explicit multi_store(const Ts &... args)
+    constexpr explicit basic_multi_store(const Ts &... args)
         : m_tuple_container(args...) {}
 
     /// Construct with a specific vecmem memory resource @param resource
@@ -79,7 +83,7 @@ class multi_store {
     template <typename allocator_t = vecmem::memory_resource,
               std::enable_if_t<not detail::is_device_view_v<allocator_t>,
                                bool> = true>
-    DETRAY_HOST explicit multi_store(allocator_t &resource)
+    DETRAY_HOST explicit basic_multi_store(allocator_t &resource)
         : m_tuple_container(resource) {}
 
     /// Copy Construct with a specific (vecmem) memory resource @param resource
@@ -88,14 +92,15 @@ class multi_store {
         typename allocator_t = vecmem::memory_resource,
         typename T = tuple_t<Ts...>,
         std::enable_if_t<std::is_same_v<T, std::tuple<Ts...>>, bool> = true>
-    DETRAY_HOST explicit multi_store(allocator_t &resource, const Ts &... args)
+    DETRAY_HOST explicit basic_multi_store(allocator_t &resource,
+                                           const Ts &... args)
         : m_tuple_container(resource, args...) {}
 
     /// Construct from the container @param view . Mainly used device-side.
     template <
         typename tuple_view_t,
         std::enable_if_t<detail::is_device_view_v<tuple_view_t>, bool> = true>
-    DETRAY_HOST_DEVICE multi_store(tuple_view_t &view)
+    DETRAY_HOST_DEVICE basic_multi_store(tuple_view_t &view)
         : m_tuple_container(view) {}
 
     /// @returns a pointer to the underlying tuple container - const
@@ -229,8 +234,12 @@ class multi_store {
         auto &coll = const_cast<collection_t &>(
             detail::get<collection_t>(m_tuple_container));
 
-        coll.reserve(coll.size() + new_data.size());
-        coll.insert(coll.end(), new_data.begin(), new_data.end());
+        if constexpr (detail::is_grid_collection_v<collection_t>) {
+            coll.append(new_data);
+        } else {
+            coll.reserve(coll.size() + new_data.size());
+            coll.insert(coll.end(), new_data.begin(), new_data.end());
+        }
     }
 
     /// Add a new collection - move
@@ -250,9 +259,13 @@ class multi_store {
 
         auto &coll = detail::get<collection_t>(m_tuple_container);
 
-        coll.reserve(coll.size() + new_data.size());
-        coll.insert(coll.end(), std::make_move_iterator(new_data.begin()),
-                    std::make_move_iterator(new_data.end()));
+        if constexpr (detail::is_grid_collection_v<collection_t>) {
+            coll.append(new_data);
+        } else {
+            coll.reserve(coll.size() + new_data.size());
+            coll.insert(coll.end(), std::make_move_iterator(new_data.begin()),
+                        std::make_move_iterator(new_data.end()));
+        }
     }
 
     /// Append another store to the current one
@@ -263,7 +276,7 @@ class multi_store {
     ///
     /// @note in general can throw an exception
     template <std::size_t current_idx = 0>
-    DETRAY_HOST void append(multi_store &&other,
+    DETRAY_HOST void append(basic_multi_store &&other,
                             const context_type &ctx = {}) noexcept(false) {
         auto &coll = other.template get<value_types::to_id(current_idx)>();
         insert(coll, ctx);
@@ -283,8 +296,9 @@ class multi_store {
     ///
     /// @return the functor output
     template <typename functor_t, typename... Args>
-    DETRAY_HOST_DEVICE decltype(auto) visit(const ID id, Args &&... args) {
-        return m_tuple_container.template visit<functor_t>(
+    DETRAY_HOST_DEVICE decltype(auto) visit(const ID id,
+                                            Args &&... args) const {
+        return m_tuple_container.template visit<functor_t, dispatch_v>(
             static_cast<size_type>(id), std::forward<Args>(args)...);
     }
 
@@ -301,7 +315,7 @@ class multi_store {
     template <typename functor_t, typename link_t, typename... Args>
     DETRAY_HOST_DEVICE decltype(auto) visit(const link_t link,
                                             Args &&... args) const {
-        return m_tuple_container.template visit<functor_t>(
+        return m_tuple_container.template visit<functor_t, dispatch_v>(
             value_types::to_index(detail::get<0>(link)), detail::get<1>(link),
             std::forward<Args>(args)...);
     }
@@ -321,10 +335,34 @@ class multi_store {
     tuple_type m_tuple_container;
 };
 
+/// Data store that resolves the collection type IDs by linear search
+template <typename ID = std::size_t, typename context_t = empty_context,
+          template <typename...> class tuple_t = dtuple, typename... Ts>
+using multi_store = basic_multi_store<ID, context_t, tuple_t,
+                                      detail::visit_dispatch::e_linear, Ts...>;
+
 /// Helper type for a data store that uses a sinlge collection container
+///
+/// @tparam container_t The type of container to use for the respective
+///                     data collections.
 template <typename ID, typename context_t, template <typename...> class tuple_t,
           template <typename...> class container_t, typename... Ts>
 using regular_multi_store =
     multi_store<ID, context_t, tuple_t, container_t<Ts>...>;
 
+/// Data store that resolves the collection type IDs through a jump table
+/// (function pointers on host, switch-statement on device). Pays off for
+/// stores with many collection types that are visited in mixed order.
+template <typename ID = std::size_t, typename context_t = empty_context,
+          template <typename...> class tuple_t = dtuple, typename... Ts>
+using jump_table_multi_store =
+    basic_multi_store<ID, context_t, tuple_t,
+                      detail::visit_dispatch::e_jump_table, Ts...>;
+
+/// Helper type for a jump table data store with a single collection container
+template <typename ID, typename context_t, template <typename...> class tuple_t,
+          template <typename...> class container_t, typename... Ts>
+using regular_jump_table_store =
+    jump_table_multi_store<ID, context_t, tuple_t, container_t<Ts>...>;
+
 }  // namespace detray
\ No newline at end of file
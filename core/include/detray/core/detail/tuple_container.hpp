@@ -18,11 +18,22 @@
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s)
+#include <array>
 #include <memory>
 #include <type_traits>
 
 namespace detray::detail {
 
+/// @brief How the runtime type index is resolved in the container visit
+enum class visit_dispatch {
+    /// Test the index against every tuple index in turn (if-chain)
+    e_linear = 0,
+    /// Generated function pointer table on host, switch-statement on device
+    e_jump_table = 1,
+    /// Switch-statement on host and device
+    e_switch = 2,
+};
+
 /// @brief detray tuple wrapper.
 ///
 /// @tparam An enum of type IDs that needs to match the [value] types of the
@@ -112,14 +123,32 @@ class tuple_container {
     /// Visits a tuple element according to its @param idx and calls
     /// @tparam functor_t with the arguments @param As on it.
     ///
+    /// @tparam dispatch_v how to resolve the runtime index to a tuple element
+    ///
     /// @returns the functor result (this is necessarily always of the same
     /// type, regardless the input tuple element type).
-    template <typename functor_t, typename... Args>
+    template <typename functor_t,
+              visit_dispatch dispatch_v = visit_dispatch::e_linear,
+              typename... Args>
     DETRAY_HOST_DEVICE decltype(auto) visit(const std::size_t idx,
                                             Args &&... As) const {
 
-        return visit<functor_t>(idx, std::make_index_sequence<sizeof...(Ts)>{},
-                                std::forward<Args>(As)...);
+        if constexpr (dispatch_v == visit_dispatch::e_switch) {
+            return visit_switch<functor_t, 0u>(idx, std::forward<Args>(As)...);
+        } else if constexpr (dispatch_v == visit_dispatch::e_jump_table) {
+#if defined(__CUDACC__) || defined(CL_SYCL_LANGUAGE_VERSION) || \
+    defined(SYCL_LANGUAGE_VERSION)
+            return visit_switch<functor_t, 0u>(idx, std::forward<Args>(As)...);
+#else
+            return visit_table<functor_t>(
+                idx, std::make_index_sequence<sizeof...(Ts)>{},
+                std::forward<Args>(As)...);
+#endif
+        } else {
+            return visit_linear<functor_t>(
+                idx, std::make_index_sequence<sizeof...(Ts)>{},
+                std::forward<Args>(As)...);
+        }
     }
 
     private:
@@ -146,6 +175,21 @@ class tuple_container {
         return detail::make_tuple<tuple_t>(Ts(detail::get<I>(view.m_view))...);
     }
 
+    /// Result type of a functor call on the tuple elements
+    template <typename functor_t, typename... Args>
+    using visit_result_t =
+        std::invoke_result_t<functor_t,
+                             const detail::tuple_element_t<0, tuple_type> &,
+                             Args...>;
+
+    /// Calls the functor @tparam functor_t on the tuple element @tparam I
+    template <typename functor_t, std::size_t I, typename... Args>
+    DETRAY_HOST_DEVICE static visit_result_t<functor_t, Args...> invoke(
+        const tuple_container &container, Args &&... As) {
+        return functor_t()(container.template get<I>(),
+                           std::forward<Args>(As)...);
+    }
+
     /// Variadic unrolling of the tuple that calls a functor on the element that
     /// corresponds to @param idx.
     ///
@@ -158,11 +202,10 @@ class tuple_container {
     /// @see https://godbolt.org/z/qd6xns7KG
     template <typename functor_t, typename... Args, std::size_t first_idx,
               std::size_t... remaining_idcs>
-    DETRAY_HOST_DEVICE std::invoke_result_t<
-        functor_t, const detail::tuple_element_t<0, tuple_type> &, Args...>
-    visit(const std::size_t idx,
-          std::index_sequence<first_idx, remaining_idcs...> /*seq*/,
-          Args &&... As) const {
+    DETRAY_HOST_DEVICE visit_result_t<functor_t, Args...> visit_linear(
+        const std::size_t idx,
+        std::index_sequence<first_idx, remaining_idcs...> /*seq*/,
+        Args &&... As) const {
 
         // Check if the first tuple index is matched to the target ID
         if (idx == first_idx) {
@@ -170,17 +213,109 @@ class tuple_container {
         }
         // Check the next ID
         if constexpr (sizeof...(remaining_idcs) >= 1u) {
-            return visit<functor_t>(idx,
-                                    std::index_sequence<remaining_idcs...>{},
-                                    std::forward<Args>(As)...);
+            return visit_linear<functor_t>(
+                idx, std::index_sequence<remaining_idcs...>{},
+                std::forward<Args>(As)...);
+        }
+        // If there is no matching ID, return default output
+        if constexpr (not std::is_void_v<visit_result_t<functor_t, Args...>>) {
+            return {};
+        }
+    }
+
+    /// Calls a functor on the element that corresponds to @param idx through
+    /// a function pointer table that is generated at compile time: a single
+    /// indirect call instead of a cascade of compare-and-branch.
+    template <typename functor_t, typename... Args, std::size_t... I>
+    DETRAY_HOST visit_result_t<functor_t, Args...> visit_table(
+        const std::size_t idx, std::index_sequence<I...> /*seq*/,
+        Args &&... As) const {
+
+        using result_t = visit_result_t<functor_t, Args...>;
+        using function_t = result_t (*)(const tuple_container &, Args &&...);
+
+        constexpr std::array<function_t, sizeof...(I)> table{
+            &tuple_container::template invoke<functor_t, I, Args...>...};
+
+        if (idx < sizeof...(I)) {
+            return table[idx](*this, std::forward<Args>(As)...);
+        }
+        // If there is no matching ID, return default output
+        if constexpr (not std::is_void_v<result_t>) {
+            return {};
+        }
+    }
+
+    /// Calls a functor on the element that corresponds to @param idx by
+    /// switching over blocks of eight tuple indices, starting at
+    /// @tparam offset (function pointers are not usable on every device).
+    template <typename functor_t, std::size_t offset, typename... Args>
+    DETRAY_HOST_DEVICE visit_result_t<functor_t, Args...> visit_switch(
+        const std::size_t idx, Args &&... As) const {
+
+        constexpr std::size_t n{sizeof...(Ts)};
+
+        switch (idx - offset) {
+            case 0u:
+                if constexpr (offset < n) {
+                    return invoke<functor_t, offset>(*this,
+                                                     std::forward<Args>(As)...);
+                }
+                break;
+            case 1u:
+                if constexpr (offset + 1u < n) {
+                    return invoke<functor_t, offset + 1u>(
+                        *this, std::forward<Args>(As)...);
+                }
+                break;
+            case 2u:
+                if constexpr (offset + 2u < n) {
+                    return invoke<functor_t, offset + 2u>(
+                        *this, std::forward<Args>(As)...);
+                }
+                break;
+            case 3u:
+                if constexpr (offset + 3u < n) {
+                    return invoke<functor_t, offset + 3u>(
+                        *this, std::forward<Args>(As)...);
+                }
+                break;
+            case 4u:
+                if constexpr (offset + 4u < n) {
+                    return invoke<functor_t, offset + 4u>(
+                        *this, std::forward<Args>(As)...);
+                }
+                break;
+            case 5u:
+                if constexpr (offset + 5u < n) {
+                    return invoke<functor_t, offset + 5u>(
+                        *this, std::forward<Args>(As)...);
+                }
+                break;
+            case 6u:
+                if constexpr (offset + 6u < n) {
+                    return invoke<functor_t, offset + 6u>(
+                        *this, std::forward<Args>(As)...);
+                }
+                break;
+            case 7u:
+                if constexpr (offset + 7u < n) {
+                    return invoke<functor_t, offset + 7u>(
+                        *this, std::forward<Args>(As)...);
+                }
+                break;
+            default:
+                // Indices beyond this block: go to the next one
+                if constexpr (offset + 8u < n) {
+                    if (idx >= offset + 8u) {
+                        return visit_switch<functor_t, offset + 8u>(
+                            idx, std::forward<Args>(As)...);
+                    }
+                }
+                break;
         }
         // If there is no matching ID, return default output
-        if constexpr (not std::is_same_v<
-                          std::invoke_result_t<
-                              functor_t,
-                              const detail::tuple_element_t<0, tuple_type> &,
-                              Args...>,
-                          void>) {
+        if constexpr (not std::is_void_v<visit_result_t<functor_t, Args...>>) {
             return {};
         }
     }
@@ -11,10 +11,18 @@
 #include "detray/core/detail/detector_kernel.hpp"
 #include "detray/definitions/containers.hpp"
 #include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/geometry/bounding_sphere.hpp"
+#include "detray/geometry/compact_transform3.hpp"
 #include "detray/geometry/detector_volume.hpp"
 #include "detray/geometry/surface.hpp"
+#include "detray/geometry/volume_navigation_info.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/surface_finders/grid/uniform_bin_index.hpp"
 #include "detray/tools/volume_builder.hpp"
 #include "detray/utils/ranges.hpp"
+#include "detray/utils/type_traits.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
@@ -24,9 +32,12 @@
 
 // System include(s)
 #include <algorithm>
+#include <cassert>
 #include <map>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 namespace detray {
 
@@ -81,10 +92,12 @@ class detector {
     using name_map = std::map<dindex, std::string>;
 
     /// Forward the alignable transform container (surface placements) and
-    /// the geo context (e.g. for alignment)
+    /// the geo context (e.g. for alignment). The stored type may be a compact
+    /// representation that converts to the algebra transform type.
     using transform_container =
         typename metadata::template transform_store<vector_type>;
-    using transform3 = typename transform_container::value_type;
+    using transform3 =
+        detail::algebra_transform_t<typename transform_container::value_type>;
     using transform_link = typename transform_container::link_type;
     using geometry_context = typename transform_container::context_type;
 
@@ -96,7 +109,7 @@ class detector {
 
     /// Forward mask types that are present in this detector
     using material_container =
-        typename metadata::template material_store<tuple_type, vector_type>;
+        typename metadata::template material_store<tuple_type, container_t>;
     using materials = typename material_container::value_types;
     using material_link = typename material_container::single_link;
 
@@ -120,15 +133,30 @@ class detector {
     using geo_obj_ids = typename metadata::geo_objects;
     using volume_type =
         detector_volume<geo_obj_ids, sf_finder_link, scalar_type>;
+    /// Navigation metadata per volume
+    using navigation_info_type =
+        volume_navigation_info<scalar_type,
+                               static_cast<std::size_t>(geo_obj_ids::e_size)>;
+    /// Homogeneous material that fills a volume
+    using volume_material_type = material<scalar_type>;
+    /// Bounding sphere per surface for the early rejection of intersections
+    using bounding_sphere_type = detray::bounding_sphere<scalar_type>;
 
     /// Volume finder definition: Make volume index available from track
     /// position
     using volume_finder =
         typename metadata::template volume_finder<container_t>;
+    /// Uniform lookup table for the irregular axes of the volume finder
+    using volume_index_type = uniform_bin_index<scalar_type, container_t>;
 
     using detector_view_type =
         detector_view<metadata, covfie::field, host_container_types>;
 
+    /// Maximal number of candidates per surface finder that the candidates
+    /// buffers are sized for, if the navigator keeps all candidates
+    /// @todo: Remove when local navigation becomes available !!!!
+    static constexpr unsigned int max_candidates_per_finder{20u};
+
     detector() = delete;
 
     /// Allowed costructor
@@ -141,6 +169,10 @@ class detector {
           _materials(resource),
           _surfaces(resource),
           _volume_finder(resource),
+          _volume_index(resource),
+          _nav_info(&resource),
+          _volume_materials(&resource),
+          _sf_spheres(&resource),
           _resource(&resource),
           _bfield(field) {}
 
@@ -154,6 +186,10 @@ class detector {
           _materials(resource),
           _surfaces(resource),
           _volume_finder(resource),
+          _volume_index(resource),
+          _nav_info(&resource),
+          _volume_materials(&resource),
+          _sf_spheres(&resource),
           _resource(&resource),
           _bfield(typename bfield_type::backend_t::configuration_t{0.f, 0.f,
                                                                    0.f}) {}
@@ -170,6 +206,11 @@ class detector {
           _materials(det_data._materials_data),
           _surfaces(det_data._surface_data),
           _volume_finder(det_data._volume_finder_data),
+          _volume_index(det_data._volume_index_data),
+          _nav_info(det_data._nav_info_data),
+          _volume_materials(det_data._volume_materials_data),
+          _sf_spheres(det_data._sf_spheres_data),
+          _n_top_candidates(det_data._n_top_candidates),
           _bfield(det_data._bfield_view) {}
 
     /// Add a new volume and retrieve a reference to it
@@ -185,6 +226,8 @@ class detector {
         volume_type &cvolume = _volumes.emplace_back(id, bounds);
         cvolume.set_index(_volumes.size() - 1);
         cvolume.set_link(srf_finder_link);
+        // Empty navigation metadata until the volume is filled
+        _nav_info.resize(_volumes.size());
 
         return cvolume;
     }
@@ -212,17 +255,99 @@ class detector {
         return _volumes[volume_index];
     }
 
+    /// @return the navigation metadata of all volumes - const access
+    DETRAY_HOST_DEVICE
+    inline auto navigation_info() const
+        -> const vector_type<navigation_info_type> & {
+        return _nav_info;
+    }
+
+    /// @return the navigation metadata of all volumes - non-const access
+    DETRAY_HOST_DEVICE
+    inline auto navigation_info() -> vector_type<navigation_info_type> & {
+        return _nav_info;
+    }
+
+    /// @return the navigation metadata of the volume with index
+    /// @param volume_index - const access
+    DETRAY_HOST_DEVICE
+    inline auto navigation_info(dindex volume_index) const
+        -> const navigation_info_type & {
+        assert(volume_index < _nav_info.size());
+        return _nav_info[volume_index];
+    }
+
+    /// @returns the number of closest candidates that the navigator keeps
+    /// per volume initialization (zero: all candidates are kept)
+    DETRAY_HOST_DEVICE
+    inline auto n_top_candidates() const -> unsigned int {
+        return _n_top_candidates;
+    }
+
+    /// Let the navigator keep only the @param k closest candidates per
+    /// volume initialization (zero: all candidates are kept).
+    ///
+    /// @note At least two candidates are kept, since a new volume is
+    /// initialized on the portal the track entered it through.
+    DETRAY_HOST
+    inline void set_n_top_candidates(const unsigned int k) {
+        _n_top_candidates = (k == 0u or k >= 2u) ? k : 2u;
+    }
+
+    /// @return the homogeneous materials of all volumes - const access
+    DETRAY_HOST_DEVICE
+    inline auto volume_materials() const
+        -> const vector_type<volume_material_type> & {
+        return _volume_materials;
+    }
+
+    /// @return the homogeneous materials of all volumes - non-const access
+    DETRAY_HOST_DEVICE
+    inline auto volume_materials() -> vector_type<volume_material_type> & {
+        return _volume_materials;
+    }
+
+    /// @return the homogeneous material of the volume with index
+    /// @param volume_index (vacuum, if no material was set for the volume)
+    DETRAY_HOST_DEVICE
+    inline auto volume_material(dindex volume_index) const
+        -> volume_material_type {
+        if (volume_index < _volume_materials.size()) {
+            return _volume_materials[volume_index];
+        }
+        return vacuum<scalar_type>();
+    }
+
+    /// Fill the volume @param vol with the homogeneous material @param mat
+    DETRAY_HOST
+    auto set_volume_material(const volume_type &vol,
+                             const volume_material_type &mat) -> void {
+        if (_volume_materials.size() < _volumes.size()) {
+            _volume_materials.resize(_volumes.size(), vacuum<scalar_type>());
+        }
+        _volume_materials[vol.index()] = mat;
+    }
+
     /// @return the volume by global cartesian @param position - const access
     DETRAY_HOST_DEVICE
     inline auto volume_by_pos(const point3 &p) const -> const volume_type & {
-        // The 3D cylindrical volume search grid is concentric
-        const transform3 identity{};
-        const auto loc_pos =
-            _volume_finder.global_to_local(identity, p, identity.translation());
+        return _volumes[volume_index_by_pos(p)];
+    }
 
-        // Only one entry per bin
-        dindex volume_index{*_volume_finder.search(loc_pos)};
-        return _volumes[volume_index];
+    /// @return the volume by global cartesian @param position - const access
+    ///
+    /// @param volume_hint index of a volume that likely contains the position
+    ///                    (e.g. the last volume of the track), is checked
+    ///                    first and updated to the result of the search.
+    DETRAY_HOST_DEVICE
+    inline auto volume_by_pos(const point3 &p, dindex &volume_hint) const
+        -> const volume_type & {
+        if (volume_hint < _volumes.size() and
+            is_inside(_volumes[volume_hint], p)) {
+            return _volumes[volume_hint];
+        }
+        volume_hint = volume_index_by_pos(p);
+        return _volumes[volume_hint];
     }
 
     /// @returns access to the surface finder container
@@ -235,6 +360,31 @@ class detector {
     DETRAY_HOST_DEVICE
     inline auto surface_store() -> surface_container & { return _surfaces; }
 
+    /// @return the bounding spheres of all surfaces - const access
+    DETRAY_HOST_DEVICE
+    inline auto bounding_spheres() const
+        -> const vector_type<bounding_sphere_type> & {
+        return _sf_spheres;
+    }
+
+    /// @return the bounding spheres of all surfaces - non-const access
+    DETRAY_HOST_DEVICE
+    inline auto bounding_spheres() -> vector_type<bounding_sphere_type> & {
+        return _sf_spheres;
+    }
+
+    /// @return the bounding sphere of the surface @param sf (infinite, if
+    /// it has not been computed)
+    DETRAY_HOST_DEVICE
+    inline auto bounding_sphere(const surface_type &sf) const
+        -> bounding_sphere_type {
+        const dindex sf_idx{sf.barcode().index()};
+        if (sf_idx < _sf_spheres.size()) {
+            return _sf_spheres[sf_idx];
+        }
+        return {};
+    }
+
     /// @returns all surfaces - const
     DETRAY_HOST_DEVICE
     inline const auto &surfaces() const {
@@ -354,6 +504,7 @@ class detector {
         dindex sf_offset{_surfaces.template get<sf_finders::id::e_brute_force>()
                              .all()
                              .size()};
+        detail::group_by_mask_type(surfaces_per_vol);
         for (auto &sf : surfaces_per_vol) {
             _masks.template visit<detail::mask_index_update>(sf.mask(), sf);
             sf.update_transform(trf_offset);
@@ -371,6 +522,8 @@ class detector {
 
         // Append mask and material container
         _masks.append(std::move(masks_per_vol));
+
+        update_navigation_info(vol, ctx);
     }
 
     /// Add a new full set of detector components (e.g. transforms or volumes)
@@ -409,8 +562,28 @@ class detector {
     DETRAY_HOST
     inline auto add_volume_finder(volume_finder &&v_grid) -> void {
         _volume_finder = std::move(v_grid);
+        update_volume_index();
+    }
+
+    /// Rebuild the uniform lookup table of the volume grid axes.
+    ///
+    /// @note Needs to be called whenever the axes of the volume grid are
+    /// modified through @c volume_search_grid()
+    DETRAY_HOST
+    inline auto update_volume_index() -> void {
+        _volume_index.build(_volume_finder.axes());
     }
 
+    /// @return the lookup table of the volume grid axes - const access
+    DETRAY_HOST_DEVICE
+    inline auto volume_index() const -> const volume_index_type & {
+        return _volume_index;
+    }
+
+    /// @return the lookup table of the volume grid axes - non-const access
+    DETRAY_HOST_DEVICE
+    inline auto volume_index() -> volume_index_type & { return _volume_index; }
+
     /// @return the volume grid - const access
     DETRAY_HOST_DEVICE
     inline auto volume_search_grid() const -> const volume_finder & {
@@ -424,15 +597,158 @@ class detector {
     }
 
     /// @returns the maximum number of surface candidates that any volume may
-    /// return.
+    /// return, if every surface finder contributes at most @param limit
+    /// candidates.
+    DETRAY_HOST_DEVICE
+    inline auto n_max_candidates(
+        const unsigned int limit = max_candidates_per_finder) const
+        -> std::size_t {
+        unsigned int n_max{0u};
+        for (const auto &info : _nav_info) {
+            const unsigned int n{info.n_max_candidates(limit)};
+            n_max = n > n_max ? n : n_max;
+        }
+        return n_max;
+    }
+
+    /// Computes the navigation metadata of the volume @param vol from its
+    /// surface finders and surfaces.
+    ///
+    /// @param ctx the geometry context of the transforms
+    ///
+    /// @note Needs to be called whenever the surfaces or surface finders of
+    /// a volume change.
     DETRAY_HOST
-    inline auto n_max_candidates() const -> std::size_t {
-        std::vector<std::size_t> n_candidates;
-        n_candidates.reserve(_volumes.size());
+    auto update_navigation_info(const volume_type &vol,
+                                const geometry_context ctx = {}) -> void {
+        if (_nav_info.size() < _volumes.size()) {
+            _nav_info.resize(_volumes.size());
+        }
+        navigation_info_type &info = _nav_info[vol.index()];
+        info = {};
+
+        fill_candidates_info(vol, info);
+
+        if (_sf_spheres.size() < surfaces().size()) {
+            _sf_spheres.resize(surfaces().size());
+        }
+
+        // Only visit the brute force surface collections of the volume
+        const auto &links = vol.full_link();
+        const auto &bf_finder =
+            _surfaces.template get<sf_finders::id::e_brute_force>();
+        for (std::size_t i = 0u; i < links.size(); ++i) {
+            const dindex coll_idx{links[i].index()};
+            if (links[i].id() != sf_finders::id::e_brute_force or
+                coll_idx == dindex_invalid) {
+                continue;
+            }
+            // Several object types can share the same collection
+            bool is_duplicate{false};
+            for (std::size_t j = 0u; j < i; ++j) {
+                is_duplicate |= (links[j] == links[i]);
+            }
+            if (is_duplicate) {
+                continue;
+            }
+
+            for (const auto &sf : bf_finder[coll_idx].all()) {
+                if (sf.volume() != vol.index()) {
+                    continue;
+                }
+                const auto &trf = _transforms.get(ctx)[sf.transform()];
+                info.n_portals += sf.is_portal() ? 1u : 0u;
+                info.extend(
+                    _masks.template visit<detail::surface_extent_getter>(
+                        sf.mask(), trf));
+                // Surfaces without a valid index keep the infinite sphere
+                if (const dindex sf_idx{sf.barcode().index()};
+                    sf_idx < _sf_spheres.size()) {
+                    _sf_spheres[sf_idx] =
+                        _masks.template visit<detail::bounding_sphere_getter>(
+                            sf.mask(), trf);
+                }
+            }
+        }
+    }
+
+    /// Computes the navigation metadata of all volumes
+    ///
+    /// @param ctx the geometry context of the transforms
+    DETRAY_HOST
+    auto update_navigation_info(const geometry_context ctx = {}) -> void {
         for (const auto &vol : _volumes) {
-            n_candidates.push_back(vol.n_max_candidates(surface_store()));
+            update_navigation_info(vol, ctx);
+        }
+    }
+
+    /// Reorders the transforms, masks and materials, so that they are laid
+    /// out in the order in which the navigator visits the surfaces: Volume by
+    /// volume, the surfaces of the brute force collections in storage order
+    /// and the surfaces of the surface grids bin by bin. The data that is
+    /// needed to intersect the surfaces of a volume, or of a grid bin, then
+    /// becomes contiguous. All surface links and barcodes are rewritten
+    /// accordingly, both in the surface store and in the surface grids. Data
+    /// that is not referenced by any surface is moved to the back of its
+    /// collection.
+    ///
+    /// @param ctx the geometry context of the transforms
+    ///
+    /// @note Only call this on a completely built detector: External links
+    /// into the transform, mask and material stores are invalidated.
+    /// @note Material maps hold no links and keep their order.
+    DETRAY_HOST
+    auto optimize_layout(const geometry_context ctx = {}) -> void {
+
+        static_assert(
+            std::is_same_v<typename mask_link::index_type, dindex> and
+                std::is_same_v<typename material_link::index_type, dindex>,
+            "Layout optimization needs single index mask/material links");
+
+        auto &sfs = surfaces();
+        const std::vector<surface_type> visited = visit_order();
+
+        // Transforms
+        std::vector<dindex> accesses;
+        accesses.reserve(visited.size());
+        for (const auto &sf : visited) {
+            accesses.push_back(sf.transform());
+        }
+        const std::vector<dindex> trf_pos =
+            access_order(_transforms.size(ctx), accesses);
+        reorder(_transforms.get(ctx), trf_pos);
+
+        for_each_surface([&trf_pos](surface_type &sf) {
+            // Invalid grid entries do not link a transform
+            if (sf.transform() < trf_pos.size()) {
+                sf.set_transform(trf_pos[sf.transform()]);
+            }
+        });
+
+        // Masks and materials, one type at a time
+        reorder_store(
+            _masks, visited, [](const surface_type &sf) { return sf.mask(); },
+            [](surface_type &sf, const mask_link &l) { sf.set_mask(l); });
+        reorder_store(
+            _materials, visited,
+            [](const surface_type &sf) { return sf.material(); },
+            [](surface_type &sf, const material_link &l) {
+                sf.material() = l;
+            });
+
+        // Barcode index is the position in the surface store. The surface
+        // copies in the grids are matched by their previous index
+        std::map<dindex, dindex> sf_pos;
+        for (dindex i = 0u; i < sfs.size(); ++i) {
+            sf_pos.emplace(sfs[i].index(), i);
+            sfs[i].set_index(i);
         }
-        return *std::max_element(n_candidates.begin(), n_candidates.end());
+        for_each_grid_surface([&sf_pos](surface_type &sf) {
+            if (const auto pos = sf_pos.find(sf.index());
+                pos != sf_pos.end()) {
+                sf.set_index(pos->second);
+            }
+        });
     }
 
     DETRAY_HOST_DEVICE
@@ -498,6 +814,212 @@ class detector {
     const auto *resource() const { return _resource; }
 
     private:
+    /// @returns the index of the volume that contains the global cartesian
+    /// position @param p according to the volume grid
+    DETRAY_HOST_DEVICE
+    inline auto volume_index_by_pos(const point3 &p) const -> dindex {
+        // The 3D cylindrical volume search grid is concentric
+        const transform3 identity{};
+        const auto loc_pos =
+            _volume_finder.global_to_local(identity, p, identity.translation());
+
+        // Only one entry per bin
+        if (_volume_index.empty()) {
+            return *_volume_finder.search(loc_pos);
+        }
+        return *_volume_finder.at(
+            _volume_index.bins(_volume_finder.axes(), loc_pos));
+    }
+
+    /// @returns true if the global cartesian position @param p lies within
+    /// the bounds of the cylindrical volume @param vol
+    DETRAY_HOST_DEVICE
+    inline auto is_inside(const volume_type &vol, const point3 &p) const
+        -> bool {
+        if (vol.id() != volume_id::e_cylinder) {
+            return false;
+        }
+        const auto &b = vol.bounds();
+        const scalar_type r{getter::perp(p)};
+        if (not(b[0] <= r and r < b[1] and b[2] <= p[2] and p[2] < b[3])) {
+            return false;
+        }
+        // Only evaluate phi if the volume does not cover the full azimuth
+        if (b[4] <= -constant<scalar_type>::pi and
+            b[5] >= constant<scalar_type>::pi) {
+            return true;
+        }
+        const scalar_type phi{getter::phi(p)};
+
+        return (b[4] <= phi and phi <= b[5]);
+    }
+
+    /// Fill the number of candidates of every surface finder that is linked
+    /// in the volume @param vol into the navigation metadata @param info
+    template <int I = static_cast<int>(geo_obj_ids::e_size) - 1>
+    DETRAY_HOST auto fill_candidates_info(const volume_type &vol,
+                                          navigation_info_type &info) const
+        -> void {
+        const auto &link{vol.template link<static_cast<geo_obj_ids>(I)>()};
+
+        // Only query the surface finder, if the volume holds one
+        if (detail::get<1>(link) != dindex_invalid) {
+            const auto n_candidates =
+                _surfaces.template visit<detail::n_candidates_getter>(link);
+            info.max_candidates[I] = n_candidates[0];
+            info.typical_candidates[I] = n_candidates[1];
+        }
+        // Check the next surface finder link
+        if constexpr (I > 0) {
+            fill_candidates_info<I - 1>(vol, info);
+        }
+    }
+
+    /// @returns the new positions of the elements of a collection of size
+    /// @param n, ordered by their first occurence in @param accesses
+    DETRAY_HOST
+    static auto access_order(const std::size_t n,
+                             const std::vector<dindex> &accesses)
+        -> std::vector<dindex> {
+        std::vector<dindex> new_pos(n, dindex_invalid);
+
+        dindex next{0u};
+        for (const dindex idx : accesses) {
+            if (idx < n and new_pos[idx] == dindex_invalid) {
+                new_pos[idx] = next++;
+            }
+        }
+        // Elements that are never accessed go to the back
+        for (dindex &pos : new_pos) {
+            if (pos == dindex_invalid) {
+                pos = next++;
+            }
+        }
+
+        return new_pos;
+    }
+
+    /// Moves the elements of @param coll to the positions @param new_pos
+    template <typename collection_t>
+    DETRAY_HOST static auto reorder(collection_t &coll,
+                                    const std::vector<dindex> &new_pos)
+        -> void {
+        using value_t = typename collection_t::value_type;
+        const std::vector<value_t> old(coll.begin(), coll.end());
+
+        for (std::size_t i = 0u; i < old.size(); ++i) {
+            coll[new_pos[i]] = old[i];
+        }
+    }
+
+    /// @returns copies of all surfaces in the order in which the navigator
+    /// visits them (see @c optimize_layout). The surfaces of the surface
+    /// store are appended at the end, so that unlinked surfaces are covered.
+    DETRAY_HOST
+    auto visit_order() const -> std::vector<surface_type> {
+        std::vector<surface_type> sf_order;
+        sf_order.reserve(surfaces().size());
+
+        for (const auto &vol : _volumes) {
+            const auto &links = vol.full_link();
+            for (std::size_t i = 0u; i < links.size(); ++i) {
+                if (links[i].index() == dindex_invalid) {
+                    continue;
+                }
+                // Several object types can share the same surface finder
+                bool is_duplicate{false};
+                for (std::size_t j = 0u; j < i; ++j) {
+                    is_duplicate |= (links[j] == links[i]);
+                }
+                if (not is_duplicate) {
+                    _surfaces.template visit<detail::surface_collector>(
+                        links[i], sf_order);
+                }
+            }
+        }
+        sf_order.insert(sf_order.end(), surfaces().begin(), surfaces().end());
+
+        return sf_order;
+    }
+
+    /// Calls @param f on every surface in the surface store and on every
+    /// surface copy in the surface grids
+    template <typename func_t>
+    DETRAY_HOST auto for_each_surface(const func_t &f) -> void {
+        for (auto &sf : surfaces()) {
+            f(sf);
+        }
+        for_each_grid_surface(f);
+    }
+
+    /// Calls @param f on every entry in the bins of the surface grids,
+    /// including the unused entries of bins with a fixed capacity
+    template <std::size_t I = 0u, typename func_t>
+    DETRAY_HOST auto for_each_grid_surface(const func_t &f) -> void {
+        constexpr auto id{sf_finders::to_id(I)};
+        auto &coll = _surfaces.template get<id>();
+
+        if constexpr (detail::is_grid_collection_v<
+                          std::decay_t<decltype(coll)>>) {
+            for (dindex i = 0u; i < coll.size(); ++i) {
+                auto gr = coll[i];
+                for (std::size_t gbin = 0u; gbin < gr.nbins(); ++gbin) {
+                    for (auto &sf : gr.at(static_cast<dindex>(gbin))) {
+                        f(sf);
+                    }
+                }
+            }
+        }
+
+        if constexpr (I < sf_finders::n_types - 1u) {
+            for_each_grid_surface<I + 1u>(f);
+        }
+    }
+
+    /// Reorders the collections of the multi store @param store by the
+    /// surface links of the surfaces in @param visited, which are retrieved
+    /// by @param get_link and updated by @param set_link
+    template <std::size_t I = 0u, typename store_t, typename get_link_t,
+              typename set_link_t>
+    DETRAY_HOST auto reorder_store(store_t &store,
+                                   const std::vector<surface_type> &visited,
+                                   const get_link_t &get_link,
+                                   const set_link_t &set_link) -> void {
+        using value_types = typename store_t::value_types;
+        constexpr auto id{value_types::to_id(I)};
+
+        auto &coll = store.template get<id>();
+
+        // Grid collections (e.g. material maps) keep their order
+        if constexpr (not detail::is_grid_collection_v<
+                          std::decay_t<decltype(coll)>>) {
+            std::vector<dindex> accesses;
+            accesses.reserve(visited.size());
+            for (const auto &sf : visited) {
+                const auto link = get_link(sf);
+                if (value_types::to_index(link.id()) == I) {
+                    accesses.push_back(link.index());
+                }
+            }
+            const std::vector<dindex> new_pos =
+                access_order(coll.size(), accesses);
+            reorder(coll, new_pos);
+
+            for_each_surface([&](surface_type &sf) {
+                auto link = get_link(sf);
+                if (value_types::to_index(link.id()) == I and
+                    link.index() < new_pos.size()) {
+                    link.index() = new_pos[link.index()];
+                    set_link(sf, link);
+                }
+            });
+        }
+
+        if constexpr (I < value_types::n_types - 1u) {
+            reorder_store<I + 1u>(store, visited, get_link, set_link);
+        }
+    }
+
     /// Contains the detector sub-volumes.
     vector_type<volume_type> _volumes;
 
@@ -516,6 +1038,21 @@ class detector {
     /// Search structure for volumes
     volume_finder _volume_finder;
 
+    /// Uniform lookup table for the volume grid axes
+    volume_index_type _volume_index;
+
+    /// Navigation metadata per volume
+    vector_type<navigation_info_type> _nav_info;
+
+    /// Homogeneous material per volume
+    vector_type<volume_material_type> _volume_materials;
+
+    /// Bounding sphere per surface
+    vector_type<bounding_sphere_type> _sf_spheres;
+
+    /// Number of candidates the navigator keeps (zero: all candidates)
+    unsigned int _n_top_candidates{0u};
+
     /// The memory resource represents how and where (host, device, managed)
     /// the memory for the detector containers is allocated
     vecmem::memory_resource *_resource = nullptr;
@@ -538,6 +1075,11 @@ struct detector_view {
           _transforms_data(get_data(det.transform_store())),
           _surface_data(get_data(det.surface_store())),
           _volume_finder_data(get_data(det.volume_search_grid())),
+          _volume_index_data(detray::get_data(det.volume_index())),
+          _nav_info_data(vecmem::get_data(det.navigation_info())),
+          _volume_materials_data(vecmem::get_data(det.volume_materials())),
+          _sf_spheres_data(vecmem::get_data(det.bounding_spheres())),
+          _n_top_candidates(det.n_top_candidates()),
           _bfield_view(det.get_bfield()) {}
 
     // members
@@ -548,6 +1090,14 @@ struct detector_view {
     typename detector_type::transform_container::view_type _transforms_data;
     typename detector_type::surface_container::view_type _surface_data;
     typename detector_type::volume_finder::view_type _volume_finder_data;
+    typename detector_type::volume_index_type::view_type _volume_index_data;
+    vecmem::data::vector_view<typename detector_type::navigation_info_type>
+        _nav_info_data;
+    vecmem::data::vector_view<typename detector_type::volume_material_type>
+        _volume_materials_data;
+    vecmem::data::vector_view<typename detector_type::bounding_sphere_type>
+        _sf_spheres_data;
+    unsigned int _n_top_candidates;
     typename detector_type::bfield_type::view_t _bfield_view;
 };
 
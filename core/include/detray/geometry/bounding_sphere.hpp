@@ -0,0 +1,130 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/intersection/detail/trajectories.hpp"
+
+// System include(s)
+#include <cmath>
+#include <limits>
+
+namespace detray {
+
+/// @brief Conservative bounding sphere of a surface in global coordinates.
+///
+/// Is computed once when the volume is built and then kept in a flat table
+/// in the detector, which is indexed by the surface index. A straight line
+/// that does not pass through the sphere cannot intersect the surface, which
+/// can be decided with two dot products before the full intersection is
+/// computed. The default sphere is infinite and never rejects a surface.
+template <typename scalar_t>
+struct bounding_sphere {
+
+    using scalar_type = scalar_t;
+
+    /// Relative margin that covers the cancellation in the distance
+    /// computation for spheres that are far away from the ray origin
+    static constexpr scalar_type rel_margin{1e-5f};
+
+    /// Centre of the sphere
+    darray<scalar_type, 3> center{0.f, 0.f, 0.f};
+    /// Radius of the sphere
+    scalar_type radius{std::numeric_limits<scalar_type>::infinity()};
+
+    /// @returns false only if the @param ray certainly misses the sphere,
+    /// enlarged by @param tol, or if the sphere lies entirely behind the
+    /// overstepping tolerance of the ray
+    template <typename transform3_t>
+    DETRAY_HOST_DEVICE constexpr bool is_reachable(
+        const detail::ray<transform3_t> &ray,
+        const scalar_type tol = 0.f) const {
+        if (not std::isfinite(radius)) {
+            return true;
+        }
+
+        const auto &pos = ray.pos();
+        const auto &dir = ray.dir();
+
+        const scalar_type oc[3]{center[0] - pos[0], center[1] - pos[1],
+                                center[2] - pos[2]};
+        const scalar_type oc2{oc[0] * oc[0] + oc[1] * oc[1] + oc[2] * oc[2]};
+        // Path to the point of closest approach
+        const scalar_type t{oc[0] * dir[0] + oc[1] * dir[1] + oc[2] * dir[2]};
+        const scalar_type r{radius + tol};
+
+        return (oc2 - t * t <= r * r + rel_margin * oc2) and
+               (t + r >= ray.overstep_tolerance());
+    }
+
+    /// @returns a lower bound on the distance from @param pos to the sphere,
+    /// enlarged by @param tol, which no trajectory can undercut (zero if the
+    /// point is inside the sphere or the sphere is infinite)
+    template <typename point3_t>
+    DETRAY_HOST_DEVICE constexpr scalar_type safety(
+        const point3_t &pos, const scalar_type tol = 0.f) const {
+        if (not std::isfinite(radius)) {
+            return 0.f;
+        }
+
+        const scalar_type oc[3]{center[0] - pos[0], center[1] - pos[1],
+                                center[2] - pos[2]};
+        const scalar_type dist{
+            std::sqrt(oc[0] * oc[0] + oc[1] * oc[1] + oc[2] * oc[2])};
+        const scalar_type s{(1.f - rel_margin) * dist - radius - tol};
+
+        return s > 0.f ? s : 0.f;
+    }
+};
+
+namespace detail {
+
+/// A functor to compute the bounding sphere of a surface in global cartesian
+/// coordinates. Returns an infinite sphere for unbounded surfaces.
+struct bounding_sphere_getter {
+    template <typename mask_group_t, typename index_t, typename transform3_t>
+    DETRAY_HOST inline auto operator()(const mask_group_t &mask_group,
+                                       const index_t &index,
+                                       const transform3_t &trf) const {
+        using scalar_t = typename mask_group_t::value_type::scalar_type;
+        using point3_t = typename transform3_t::point3;
+
+        bounding_sphere<scalar_t> sphere{};
+
+        // Local minimal bounding box: (min_x, min_y, min_z, max_x, ...)
+        const auto loc_box =
+            mask_group[index]
+                .local_min_bounds(std::numeric_limits<scalar_t>::epsilon())
+                .values();
+        for (const scalar_t v : loc_box) {
+            if (!std::isfinite(v)) {
+                return sphere;
+            }
+        }
+
+        // Sphere around the local box, the placement preserves distances
+        const point3_t glob_c = trf.point_to_global(
+            point3_t{0.5f * (loc_box[0] + loc_box[3]),
+                     0.5f * (loc_box[1] + loc_box[4]),
+                     0.5f * (loc_box[2] + loc_box[5])});
+        const scalar_t dx{loc_box[3] - loc_box[0]};
+        const scalar_t dy{loc_box[4] - loc_box[1]};
+        const scalar_t dz{loc_box[5] - loc_box[2]};
+
+        sphere.center = {glob_c[0], glob_c[1], glob_c[2]};
+        sphere.radius = 0.5f * std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        return sphere;
+    }
+};
+
+}  // namespace detail
+
+}  // namespace detray
@@ -0,0 +1,183 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/algebra.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/qualifiers.hpp"
+
+// System include(s)
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Compact storage type for surface placements.
+///
+/// Keeps only the rotation (as its three column vectors) and the translation
+/// of an affine transformation, optionally in a reduced precision. The inverse
+/// transformation is not stored: Global to local transformations apply the
+/// transposed rotation instead. Can be used as value type of the detector
+/// transform store. The intersectors and local frames read the axes and the
+/// translation directly, so that no full transform has to be built during
+/// navigation.
+///
+/// @tparam transform3_t the algebra transform type that is being compressed
+/// @tparam storage_scalar_t the scalar type in which the data is stored
+template <typename transform3_t,
+          typename storage_scalar_t = typename transform3_t::scalar_type>
+class compact_transform3 {
+
+    public:
+    /// The full transform this type converts to
+    using transform3_type = transform3_t;
+    using scalar_type = typename transform3_t::scalar_type;
+    using storage_scalar_type = storage_scalar_t;
+    using point3 = typename transform3_t::point3;
+    using vector3 = typename transform3_t::vector3;
+
+    /// Default constructor: identity
+    constexpr compact_transform3() = default;
+
+    /// Construct from the full transform @param trf
+    DETRAY_HOST_DEVICE
+    compact_transform3(const transform3_type &trf) {
+        set_column(0u, trf.x());
+        set_column(1u, trf.y());
+        set_column(2u, trf.z());
+        set_column(3u, trf.translation());
+    }
+
+    /// Construct from a translation @param t only
+    DETRAY_HOST_DEVICE
+    explicit compact_transform3(const vector3 &t) { set_column(3u, t); }
+
+    /// Construct from translation @param t and the local axes @param x,
+    /// @param y and @param z in global coordinates
+    DETRAY_HOST_DEVICE
+    compact_transform3(const vector3 &t, const vector3 &x, const vector3 &y,
+                       const vector3 &z) {
+        set_column(0u, x);
+        set_column(1u, y);
+        set_column(2u, z);
+        set_column(3u, t);
+    }
+
+    /// Construct from translation @param t, the local z-axis @param z and the
+    /// local x-axis @param x in global coordinates
+    DETRAY_HOST_DEVICE
+    compact_transform3(const vector3 &t, const vector3 &z, const vector3 &x)
+        : compact_transform3(transform3_type{t, z, x}) {}
+
+    /// @returns the full algebra transform (the algebra plugin recomputes
+    /// the inverse matrix, so this is not meant for use in hot loops)
+    DETRAY_HOST_DEVICE
+    explicit operator transform3_type() const {
+        return transform3_type{translation(), x(), y(), z()};
+    }
+
+    /// Equality operator
+    DETRAY_HOST_DEVICE
+    constexpr bool operator==(const compact_transform3 &rhs) const {
+        return m_data == rhs.m_data;
+    }
+
+    /// @returns the local x-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    auto x() const -> vector3 { return column(0u); }
+
+    /// @returns the local y-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    auto y() const -> vector3 { return column(1u); }
+
+    /// @returns the local z-axis in global coordinates
+    DETRAY_HOST_DEVICE
+    auto z() const -> vector3 { return column(2u); }
+
+    /// @returns the translation
+    DETRAY_HOST_DEVICE
+    auto translation() const -> point3 { return column(3u); }
+
+    /// @returns the point @param p transformed from local to global frame
+    DETRAY_HOST_DEVICE
+    auto point_to_global(const point3 &p) const -> point3 {
+        return rotate(p) + translation();
+    }
+
+    /// @returns the vector @param v transformed from local to global frame
+    DETRAY_HOST_DEVICE
+    auto vector_to_global(const vector3 &v) const -> vector3 {
+        return rotate(v);
+    }
+
+    /// @returns the point @param p transformed from global to local frame
+    DETRAY_HOST_DEVICE
+    auto point_to_local(const point3 &p) const -> point3 {
+        return rotate_inverse(p - translation());
+    }
+
+    /// @returns the vector @param v transformed from global to local frame
+    DETRAY_HOST_DEVICE
+    auto vector_to_local(const vector3 &v) const -> vector3 {
+        return rotate_inverse(v);
+    }
+
+    private:
+    /// @returns the column @param c as a vector of the algebra scalar type
+    DETRAY_HOST_DEVICE
+    auto column(const unsigned int c) const -> vector3 {
+        return {static_cast<scalar_type>(m_data[3u * c]),
+                static_cast<scalar_type>(m_data[3u * c + 1u]),
+                static_cast<scalar_type>(m_data[3u * c + 2u])};
+    }
+
+    /// Set the column @param c to @param v
+    DETRAY_HOST_DEVICE
+    void set_column(const unsigned int c, const vector3 &v) {
+        m_data[3u * c] = static_cast<storage_scalar_t>(v[0]);
+        m_data[3u * c + 1u] = static_cast<storage_scalar_t>(v[1]);
+        m_data[3u * c + 2u] = static_cast<storage_scalar_t>(v[2]);
+    }
+
+    /// @returns @param v multiplied by the rotation matrix
+    DETRAY_HOST_DEVICE
+    auto rotate(const vector3 &v) const -> vector3 {
+        return v[0] * x() + v[1] * y() + v[2] * z();
+    }
+
+    /// @returns @param v multiplied by the inverse (transposed) rotation
+    DETRAY_HOST_DEVICE
+    auto rotate_inverse(const vector3 &v) const -> vector3 {
+        return {vector::dot(x(), v), vector::dot(y(), v), vector::dot(z(), v)};
+    }
+
+    /// Rotation columns (x, y, z) followed by the translation
+    darray<storage_scalar_t, 12> m_data{1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0};
+};
+
+namespace detail {
+
+/// Get the algebra transform type of a transform store value type
+/// @{
+template <typename T, typename = void>
+struct algebra_transform {
+    using type = T;
+};
+
+template <typename T>
+struct algebra_transform<T, std::void_t<typename T::transform3_type>> {
+    using type = typename T::transform3_type;
+};
+
+template <typename T>
+using algebra_transform_t = typename algebra_transform<T>::type;
+/// @}
+
+}  // namespace detail
+
+}  // namespace detray
@@ -161,11 +161,8 @@ class detector_volume {
         // Check if this volume holds such a collection and, if so, add max
         // number of candidates that we can expect from it
         if (coll_idx != dindex_invalid) {
-            const unsigned int n_max{
-                sf_collections.template get<sf_col_id>()[coll_idx]
-                    .n_max_candidates()};
-            // @todo: Remove when local navigation becomes available !!!!
-            n += n_max > 20u ? 20u : n_max;
+            n += sf_collections.template get<sf_col_id>()[coll_idx]
+                     .n_max_candidates();
         }
         // Check the next surface collection type
         if constexpr (I > 0) {
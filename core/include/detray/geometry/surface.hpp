@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 
 #include "detray/definitions/geometry.hpp"
@@ -129,6 +130,10 @@ class surface {
     DETRAY_HOST
     auto update_transform(dindex offset) -> void { _trf += offset; }
 
+    /// Set a new transform index
+    DETRAY_HOST
+    auto set_transform(const transform_link &trf) -> void { _trf = trf; }
+
     /// @return the transform index
     DETRAY_HOST_DEVICE
     constexpr auto transform() const -> const transform_link & { return _trf; }
@@ -139,6 +144,10 @@ class surface {
     DETRAY_HOST
     auto update_mask(dindex offset) -> void { _mask += offset; }
 
+    /// Set a new mask link
+    DETRAY_HOST
+    auto set_mask(const mask_link &mask) -> void { _mask = mask; }
+
     /// @return the mask link
     DETRAY_HOST_DEVICE
     constexpr auto mask() const -> const mask_link & { return _mask; }
@@ -189,4 +198,36 @@ class surface {
     source_link_t _src{};
 };
 
+namespace detail {
+
+/// Reorder the @param surfaces of a volume, so that all surfaces of a kind
+/// (portal, sensitive, passive) that share a mask type are contiguous. This
+/// way, the navigator can dispatch on the mask type once per group instead of
+/// once per surface. The groups are ordered by their first surface and the
+/// surfaces keep their order within a group, so that surfaces which are
+/// already grouped are not moved.
+///
+/// @note has to be called before the surface indices are set
+template <typename surface_container_t>
+DETRAY_HOST inline void group_by_mask_type(surface_container_t &surfaces) {
+    auto first = surfaces.begin();
+    while (first != surfaces.end()) {
+        const auto kind = first->id();
+        const auto last =
+            std::find_if(first, surfaces.end(),
+                         [kind](const auto &sf) { return sf.id() != kind; });
+
+        // Pull all surfaces with the mask type of the first one to the front
+        while (first != last) {
+            const auto mask_id = first->mask().id();
+            first = std::stable_partition(
+                first, last, [mask_id](const auto &sf) {
+                    return sf.mask().id() == mask_id;
+                });
+        }
+    }
+}
+
+}  // namespace detail
+
 }  // namespace detray
\ No newline at end of file
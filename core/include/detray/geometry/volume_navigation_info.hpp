@@ -0,0 +1,137 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/masks/masks.hpp"
+
+// System include(s)
+#include <cmath>
+#include <limits>
+
+namespace detray {
+
+/// @brief Navigation metadata of a detector volume.
+///
+/// Is computed once when the volume is built and then kept in a flat table
+/// in the detector, which is indexed by the volume index. The navigator uses
+/// it e.g. to size its candidates cache for the current volume.
+///
+/// @tparam scalar_t the scalar type of the volume extent
+/// @tparam N the number of surface finder links per volume
+template <typename scalar_t, std::size_t N>
+struct volume_navigation_info {
+
+    /// Maximal number of candidates that a surface finder can return per link
+    darray<unsigned int, N> max_candidates{};
+    /// Typical (average) number of candidates per surface finder link
+    darray<unsigned int, N> typical_candidates{};
+    /// Number of portals that bound the volume
+    unsigned int n_portals{0u};
+    /// Axis aligned extent of the volume surfaces in global cartesian
+    /// coordinates: (min_x, min_y, min_z, max_x, max_y, max_z)
+    darray<scalar_t, 6> extent{std::numeric_limits<scalar_t>::infinity(),
+                               std::numeric_limits<scalar_t>::infinity(),
+                               std::numeric_limits<scalar_t>::infinity(),
+                               -std::numeric_limits<scalar_t>::infinity(),
+                               -std::numeric_limits<scalar_t>::infinity(),
+                               -std::numeric_limits<scalar_t>::infinity()};
+
+    /// @returns the maximal number of candidates over all surface finders,
+    /// if every surface finder contributes at most @param limit candidates
+    DETRAY_HOST_DEVICE
+    constexpr auto n_max_candidates(
+        const unsigned int limit =
+            std::numeric_limits<unsigned int>::max()) const -> unsigned int {
+        unsigned int n{0u};
+        for (const unsigned int n_cand : max_candidates) {
+            n += n_cand < limit ? n_cand : limit;
+        }
+        return n;
+    }
+
+    /// @returns the typical number of candidates over all surface finders
+    DETRAY_HOST_DEVICE
+    constexpr auto n_typical_candidates() const -> unsigned int {
+        unsigned int n{0u};
+        for (const unsigned int n_cand : typical_candidates) {
+            n += n_cand;
+        }
+        return n;
+    }
+
+    /// Extend the volume extent by the axis aligned box @param aabb
+    DETRAY_HOST constexpr void extend(const darray<scalar_t, 6> &aabb) {
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            extent[i] = aabb[i] < extent[i] ? aabb[i] : extent[i];
+            extent[i + 3u] =
+                aabb[i + 3u] > extent[i + 3u] ? aabb[i + 3u] : extent[i + 3u];
+        }
+    }
+};
+
+namespace detail {
+
+/// A functor to retrieve the maximal and typical number of candidates of a
+/// surface finder
+struct n_candidates_getter {
+    template <typename collection_t, typename index_t>
+    DETRAY_HOST_DEVICE inline auto operator()(const collection_t &sf_finders,
+                                              const index_t &index) const
+        -> darray<unsigned int, 2> {
+        const auto sf_finder = sf_finders[index];
+        return {sf_finder.n_max_candidates(), sf_finder.n_typical_candidates()};
+    }
+};
+
+/// A functor to compute the axis aligned bounding box of a surface in global
+/// cartesian coordinates. Returns an infinite box for unbounded surfaces.
+struct surface_extent_getter {
+    template <typename mask_group_t, typename index_t, typename transform3_t>
+    DETRAY_HOST inline auto operator()(const mask_group_t &mask_group,
+                                       const index_t &index,
+                                       const transform3_t &trf) const {
+        using scalar_t = typename mask_group_t::value_type::scalar_type;
+        using point3_t = typename transform3_t::point3;
+
+        constexpr scalar_t inf{std::numeric_limits<scalar_t>::infinity()};
+        darray<scalar_t, 6> extent{inf, inf, inf, -inf, -inf, -inf};
+
+        // Local minimal bounding box: (min_x, min_y, min_z, max_x, ...)
+        const auto loc_box =
+            mask_group[index]
+                .local_min_bounds(std::numeric_limits<scalar_t>::epsilon())
+                .values();
+        for (const scalar_t v : loc_box) {
+            if (!std::isfinite(v)) {
+                return darray<scalar_t, 6>{-inf, -inf, -inf, inf, inf, inf};
+            }
+        }
+
+        // Transform all corner points to global coordinates
+        for (unsigned int c = 0u; c < 8u; ++c) {
+            const point3_t glob_p = trf.point_to_global(
+                point3_t{loc_box[(c & 1u) ? 3u : 0u],
+                         loc_box[(c & 2u) ? 4u : 1u],
+                         loc_box[(c & 4u) ? 5u : 2u]});
+            for (unsigned int i = 0u; i < 3u; ++i) {
+                extent[i] = glob_p[i] < extent[i] ? glob_p[i] : extent[i];
+                extent[i + 3u] =
+                    glob_p[i] > extent[i + 3u] ? glob_p[i] : extent[i + 3u];
+            }
+        }
+
+        return extent;
+    }
+};
+
+}  // namespace detail
+
+}  // namespace detray
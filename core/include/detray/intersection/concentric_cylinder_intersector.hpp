@@ -49,13 +49,13 @@ struct concentric_cylinder_intersector {
     ///
     /// @return the intersection
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
                                         cylindrical2<transform3_t>>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline intersection2D<surface_t, transform3_t>
     operator()(const ray_type &ray, const surface_t sf, const mask_t &mask,
-               const transform3_t & /*trf*/,
+               const trf_t & /*trf*/,
                const scalar_type mask_tolerance = 0.f) const {
 
         using intersection_t = intersection2D<surface_t, transform3_t>;
@@ -146,13 +146,13 @@ struct concentric_cylinder_intersector {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
                                         cylindrical2<transform3_t>>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
-        const mask_t &mask, const transform3_t &trf,
+        const mask_t &mask, const trf_t &trf,
         const scalar_type mask_tolerance = 0.f) const {
         sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance)[0];
     }
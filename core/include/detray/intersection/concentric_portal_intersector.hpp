@@ -0,0 +1,326 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/coordinates/cylindrical2.hpp"
+#include "detray/coordinates/polar2.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/intersection/cylinder_portal_intersector.hpp"
+#include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/intersection.hpp"
+#include "detray/intersection/intersection_kernel.hpp"
+#include "detray/intersection/plane_intersector.hpp"
+#include "detray/utils/ranges.hpp"
+
+// System include(s)
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace detray {
+
+/// @brief Intersects a straight line with the portals of a cylindrical
+/// volume, i.e. with cylinders around the z-axis and with discs normal to it.
+///
+/// The transverse quadratic coefficients of the ray are computed once on
+/// construction. Every concentric cylinder portal then only costs one square
+/// root and every disc portal one multiplication, instead of the cross
+/// products of the generic cylinder intersector and the projection onto the
+/// normal of the plane intersector.
+template <typename transform3_t>
+struct concentric_portal_intersector {
+
+    /// linear algebra types
+    /// @{
+    using scalar_type = typename transform3_t::scalar_type;
+    using point3 = typename transform3_t::point3;
+    using point2 = typename transform3_t::point2;
+    using vector3 = typename transform3_t::vector3;
+    /// @}
+    using ray_type = detail::ray<transform3_t>;
+
+    /// Tolerance to decide whether a placement is aligned with the z-axis
+    static constexpr scalar_type axis_tolerance{1e-6f};
+
+    /// Precompute the coefficients for the @param ray
+    DETRAY_HOST_DEVICE
+    explicit concentric_portal_intersector(const ray_type &ray)
+        : m_ray{ray} {
+        const point3 &ro = ray.pos();
+        const vector3 &rd = ray.dir();
+
+        m_a = rd[0] * rd[0] + rd[1] * rd[1];
+        m_b = ro[0] * rd[0] + ro[1] * rd[1];
+        m_c = ro[0] * ro[0] + ro[1] * ro[1];
+        m_inv_a = (m_a > 0.f) ? 1.f / m_a
+                              : std::numeric_limits<scalar_type>::infinity();
+        m_inv_dz = (rd[2] != 0.f)
+                       ? 1.f / rd[2]
+                       : std::numeric_limits<scalar_type>::infinity();
+    }
+
+    /// @returns the ray the coefficients were computed for
+    DETRAY_HOST_DEVICE
+    const ray_type &ray() const { return m_ray; }
+
+    /// @returns true if the placement @param trf has its local z-axis on the
+    /// global z-axis (in either direction)
+    template <typename trf_t>
+    DETRAY_HOST_DEVICE static bool is_on_z_axis(const trf_t &trf) {
+        const vector3 z = trf.z();
+        const point3 t = trf.translation();
+
+        return std::abs(z[0]) < axis_tolerance and
+               std::abs(z[1]) < axis_tolerance and
+               std::abs(t[0]) < axis_tolerance and
+               std::abs(t[1]) < axis_tolerance;
+    }
+
+    /// Intersect a cylinder around the z-axis
+    ///
+    /// @param sf the surface handle the mask is associated with
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    ///
+    /// @returns the closest intersection outside of the overstepping
+    /// tolerance, like the @c cylinder_portal_intersector
+    template <typename mask_t, typename surface_t, typename trf_t>
+    DETRAY_HOST_DEVICE inline intersection2D<surface_t, transform3_t>
+    cylinder(const surface_t sf, const mask_t &mask, const trf_t &trf,
+             const scalar_type mask_tolerance = 0.f) const {
+
+        intersection2D<surface_t, transform3_t> is;
+
+        const scalar_type r{mask[mask_t::shape::e_r]};
+        const scalar_type disc{m_b * m_b - m_a * (m_c - r * r)};
+
+        // Parallel to the cylinder axis or no crossing
+        if (not(disc >= 0.f) or m_a == 0.f) {
+            return is;
+        }
+
+        // Numerically stable form of the two solutions
+        const scalar_type q{-(m_b + std::copysign(math_ns::sqrt(disc), m_b))};
+        scalar_type t0{q * m_inv_a};
+        scalar_type t1{(q != 0.f) ? (m_c - r * r) / q : t0};
+        if (t0 > t1) {
+            const scalar_type tmp{t0};
+            t0 = t1;
+            t1 = tmp;
+        }
+
+        const scalar_type overstep{m_ray.overstep_tolerance()};
+        if (t1 <= overstep) {
+            return is;
+        }
+        is.path = (t0 > overstep) ? t0 : t1;
+        is.p3 = m_ray.pos() + is.path * m_ray.dir();
+
+        // The point has to be in cylinder3 coordinates for the r-check
+        if constexpr (mask_t::shape::check_radius) {
+            const auto loc3D = mask.to_local_frame(trf, is.p3);
+            is.status = mask.is_inside(loc3D, mask_tolerance);
+            is.p2 = point2{loc3D[0] * loc3D[1], loc3D[2]};
+        } else {
+            is.p2 = mask.to_measurement_frame(trf, is.p3);
+            is.status = mask.is_inside(is.p2, mask_tolerance);
+        }
+
+        if (is.status == intersection::status::e_inside) {
+            is.surface = sf;
+            is.direction = std::signbit(is.path)
+                               ? intersection::direction::e_opposite
+                               : intersection::direction::e_along;
+            is.volume_link = mask.volume_link();
+
+            const scalar_type phi{is.p2[0] / r};
+            const vector3 normal = {math_ns::cos(phi), math_ns::sin(phi), 0.f};
+            is.cos_incidence_angle = vector::dot(m_ray.dir(), normal);
+        }
+
+        return is;
+    }
+
+    /// Intersect a disc that is normal to the z-axis
+    ///
+    /// @param sf the surface handle the mask is associated with
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    ///
+    /// @returns the intersection, like the @c plane_intersector
+    template <typename mask_t, typename surface_t, typename trf_t>
+    DETRAY_HOST_DEVICE inline intersection2D<surface_t, transform3_t> disc(
+        const surface_t sf, const mask_t &mask, const trf_t &trf,
+        const scalar_type mask_tolerance = 0.f) const {
+
+        intersection2D<surface_t, transform3_t> is;
+
+        const scalar_type dz{m_ray.dir()[2]};
+        if (dz == 0.f) {
+            return is;
+        }
+        const scalar_type path{(trf.translation()[2] - m_ray.pos()[2]) *
+                               m_inv_dz};
+        if (path < m_ray.overstep_tolerance()) {
+            return is;
+        }
+
+        is.path = path;
+        is.surface = sf;
+        is.p3 = m_ray.pos() + is.path * m_ray.dir();
+        is.p2 = mask.to_local_frame(trf, is.p3, m_ray.dir());
+        is.status = mask.is_inside(is.p2, mask_tolerance);
+        is.direction = std::signbit(is.path)
+                           ? intersection::direction::e_opposite
+                           : intersection::direction::e_along;
+        is.volume_link = mask.volume_link();
+        is.cos_incidence_angle = std::abs(dz);
+
+        return is;
+    }
+
+    private:
+    /// The ray
+    ray_type m_ray;
+    /// Transverse quadratic coefficients: a t² + 2 b t + c - r² = 0
+    scalar_type m_a{0.f}, m_b{0.f}, m_c{0.f};
+    /// Inverse of the transverse and longitudinal direction components
+    scalar_type m_inv_a{0.f}, m_inv_dz{0.f};
+};
+
+/// A functor to add the intersections between a ray and a portal surface.
+///
+/// Cylinder portals around the z-axis and disc portals normal to it are
+/// intersected with the precomputed coefficients of a
+/// @c concentric_portal_intersector. All other portals are forwarded to
+/// @c intersection_initialize.
+struct portal_intersection_initialize {
+
+    /// Operator function to initalize the intersections with a portal
+    ///
+    /// @param mask_group is the input mask group
+    /// @param mask_range is the range of masks in the group that belong to the
+    ///                   surface
+    /// @param is_container is the intersection container to be filled
+    /// @param portal_intr holds the ray and its precomputed coefficients
+    /// @param surface is the input surface
+    /// @param contextual_transforms is the input transform container
+    /// @param mask_tolerance is the tolerance for mask size
+    template <typename mask_group_t, typename mask_range_t,
+              typename is_container_t, typename transform3_t,
+              typename surface_t, typename transform_container_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        is_container_t &is_container,
+        const concentric_portal_intersector<transform3_t> &portal_intr,
+        const surface_t &surface,
+        const transform_container_t &contextual_transforms,
+        const scalar mask_tolerance = 0.f) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using intersector_t =
+            typename mask_t::shape::template intersector_type<transform3_t>;
+
+        constexpr bool is_cylinder{
+            std::is_same_v<intersector_t,
+                           cylinder_portal_intersector<transform3_t>> and
+            std::is_same_v<typename mask_t::measurement_frame_type,
+                           cylindrical2<transform3_t>>};
+        constexpr bool is_disc{
+            std::is_same_v<intersector_t, plane_intersector<transform3_t>> and
+            std::is_same_v<typename mask_t::local_frame_type,
+                           polar2<transform3_t>>};
+
+        const auto &ctf = contextual_transforms[surface.transform()];
+
+        if constexpr (is_cylinder or is_disc) {
+            if (concentric_portal_intersector<transform3_t>::is_on_z_axis(
+                    ctf)) {
+                // Run over the masks that belong to the surface (only one can
+                // be hit)
+                for (const auto &mask :
+                     detray::ranges::subrange(mask_group, mask_range)) {
+                    typename is_container_t::value_type is;
+                    if constexpr (is_cylinder) {
+                        is = portal_intr.cylinder(surface, mask, ctf,
+                                                  mask_tolerance);
+                    } else {
+                        is = portal_intr.disc(surface, mask, ctf,
+                                              mask_tolerance);
+                    }
+                    if (is.status == intersection::status::e_inside) {
+                        is_container.push_back(is);
+                        return;
+                    }
+                }
+                return;
+            }
+        }
+
+        intersection_initialize{}(mask_group, mask_range, is_container,
+                                  portal_intr.ray(), surface,
+                                  contextual_transforms, mask_tolerance);
+    }
+};
+
+namespace detail {
+
+/// Keeps only the closest of the intersections that are pushed into it
+template <typename intersection_t>
+struct closest_intersection {
+    using value_type = intersection_t;
+
+    value_type closest{};
+
+    DETRAY_HOST_DEVICE
+    void push_back(const value_type &is) {
+        if (is < closest) {
+            closest = is;
+        }
+    }
+};
+
+}  // namespace detail
+
+/// Intersect the @param ray with all portals of the volume @param vol in the
+/// detector @param det and find the portal through which it leaves.
+///
+/// @param mask_tolerance is the tolerance for mask edges
+///
+/// @returns the closest portal intersection, which has the status
+/// @c e_missed if no portal was hit
+template <typename detector_t>
+DETRAY_HOST_DEVICE inline auto exit_portal(
+    const detector_t &det, const typename detector_t::volume_type &vol,
+    const detail::ray<typename detector_t::transform3> &ray,
+    const typename detector_t::scalar_type mask_tolerance = 0.f) {
+
+    using surface_t = typename detector_t::surface_type;
+    using transform3_t = typename detector_t::transform3;
+
+    const concentric_portal_intersector<transform3_t> portal_intr(ray);
+    detail::closest_intersection<intersection2D<surface_t, transform3_t>>
+        result{};
+
+    for (const auto &sf : det.surfaces(vol)) {
+        if (not sf.is_portal()) {
+            continue;
+        }
+        det.mask_store().template visit<portal_intersection_initialize>(
+            sf.mask(), result, portal_intr, sf, det.transform_store(),
+            mask_tolerance);
+    }
+
+    return result.closest;
+}
+
+}  // namespace detray
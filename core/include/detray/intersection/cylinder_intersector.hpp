@@ -47,14 +47,14 @@ struct cylinder_intersector {
     ///
     /// @return the intersections.
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
                                         cylindrical2<transform3_t>>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline std::array<
         intersection2D<surface_t, transform3_t>, 2>
     operator()(const ray_type &ray, const surface_t sf, const mask_t &mask,
-               const transform3_t &trf,
+               const trf_t &trf,
                const scalar_type mask_tolerance = 0.f) const {
 
         using intersection_t = intersection2D<surface_t, transform3_t>;
@@ -99,13 +99,13 @@ struct cylinder_intersector {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
                                         cylindrical2<transform3_t>>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
-        const mask_t &mask, const transform3_t &trf,
+        const mask_t &mask, const trf_t &trf,
         const scalar_type mask_tolerance = 0.f) const {
 
         using intersection_t = intersection2D<surface_t, transform3_t>;
@@ -123,19 +123,54 @@ struct cylinder_intersector {
         };
     }
 
+    /// Operator function to update only the path and the status of an
+    /// intersection between a ray and a 2D cylinder. The remaining data of
+    /// the intersection is left as it is.
+    ///
+    /// @tparam mask_t is the input mask type
+    /// @tparam surface_t is the type of surface handle
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be updated
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    template <
+        typename mask_t, typename surface_t, typename trf_t,
+        std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
+                                        cylindrical2<transform3_t>>,
+                         bool> = true>
+    DETRAY_HOST_DEVICE inline void update_path(
+        const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
+        const mask_t &mask, const trf_t &trf,
+        const scalar_type mask_tolerance = 0.f) const {
+
+        // One or both of these solutions might be invalid
+        const auto qe = solve_intersection(ray, mask, trf);
+
+        switch (qe.solutions()) {
+            case 1:
+                sfi.path = qe.smaller();
+                sfi.status = check_candidate(ray, mask, trf, sfi.path,
+                                             mask_tolerance);
+                break;
+            case 0:
+                sfi.status = intersection::status::e_missed;
+        };
+    }
+
     protected:
     /// Calculates the distance to the (two) intersection points on the
     /// cylinder in global coordinates.
     ///
     /// @returns a quadratic equation object that contains the solution(s).
-    template <typename mask_t>
+    template <typename mask_t, typename trf_t>
     DETRAY_HOST_DEVICE inline detail::quadratic_equation<scalar_type>
     solve_intersection(const ray_type &ray, const mask_t &mask,
-                       const transform3_t &trf) const {
+                       const trf_t &trf) const {
         const scalar_type r{mask[mask_t::shape::e_r]};
-        const auto &m = trf.matrix();
-        const vector3 sz = getter::vector<3>(m, 0u, 2u);
-        const vector3 sc = getter::vector<3>(m, 0u, 3u);
+        const vector3 sz = trf.z();
+        const point3 sc = trf.translation();
 
         const point3 &ro = ray.pos();
         const vector3 &rd = ray.dir();
@@ -149,15 +184,40 @@ struct cylinder_intersector {
         return detail::quadratic_equation<scalar_type>{a, b, c};
     }
 
+    /// Check the point at @param path along the ray against the surface
+    /// boundaries (mask) without constructing the intersection candidate.
+    ///
+    /// @returns the intersection status
+    template <typename mask_t, typename trf_t>
+    DETRAY_HOST_DEVICE inline intersection::status check_candidate(
+        const ray_type &ray, const mask_t &mask, const trf_t &trf,
+        const scalar_type path, const scalar_type mask_tolerance = 0.f) const {
+
+        if (path < ray.overstep_tolerance()) {
+            return intersection::status::e_missed;
+        }
+
+        const point3 p3 = ray.pos() + path * ray.dir();
+
+        // The point has to be in cylinder3 coordinates for the r-check
+        if constexpr (mask_t::shape::check_radius) {
+            return mask.is_inside(mask.to_local_frame(trf, p3),
+                                  mask_tolerance);
+        } else {
+            return mask.is_inside(mask.to_measurement_frame(trf, p3),
+                                  mask_tolerance);
+        }
+    }
+
     /// From the intersection path, construct an intersection candidate and
     /// check it against the surface boundaries (mask).
     ///
     /// @returns the intersection candidate. Might be (partially) uninitialized
     /// if the overstepping tolerance is not met or the intersection lies
     /// outside of the mask.
-    template <typename intersection_t, typename mask_t>
+    template <typename intersection_t, typename mask_t, typename trf_t>
     DETRAY_HOST_DEVICE inline intersection_t build_candidate(
-        const ray_type &ray, const mask_t &mask, const transform3_t &trf,
+        const ray_type &ray, const mask_t &mask, const trf_t &trf,
         const scalar_type path, const scalar_type mask_tolerance = 0.f) const {
 
         intersection_t is;
@@ -51,13 +51,13 @@ struct cylinder_portal_intersector : public cylinder_intersector<transform3_t> {
     ///
     /// @return the closest intersection
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
                                         cylindrical2<transform3_t>>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline intersection2D<surface_t, transform3_t>
     operator()(const ray_type &ray, const surface_t sf, const mask_t &mask,
-               const transform3_t &trf,
+               const trf_t &trf,
                const scalar_type mask_tolerance = 0.f) const {
 
         using intersection_t = intersection2D<surface_t, transform3_t>;
@@ -95,16 +95,52 @@ struct cylinder_portal_intersector : public cylinder_intersector<transform3_t> {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
                                         cylindrical2<transform3_t>>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
-        const mask_t &mask, const transform3_t &trf,
+        const mask_t &mask, const trf_t &trf,
         const scalar_type mask_tolerance = 0.f) const {
         sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance);
     }
+
+    /// Operator function to update only the path and the status of an
+    /// intersection between a ray and a cylinder portal. The remaining data
+    /// of the intersection is left as it is.
+    ///
+    /// @tparam mask_t is the input mask type
+    /// @tparam surface_t is the type of surface handle
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be updated
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    template <
+        typename mask_t, typename surface_t, typename trf_t,
+        std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
+                                        cylindrical2<transform3_t>>,
+                         bool> = true>
+    DETRAY_HOST_DEVICE inline void update_path(
+        const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
+        const mask_t &mask, const trf_t &trf,
+        const scalar_type mask_tolerance = 0.f) const {
+
+        const auto qe = this->solve_intersection(ray, mask, trf);
+
+        // Find the closest valid intersection
+        if (qe.solutions() > 0 and qe.larger() > ray.overstep_tolerance()) {
+            sfi.path = (qe.smaller() > ray.overstep_tolerance())
+                           ? qe.smaller()
+                           : qe.larger();
+            sfi.status = this->check_candidate(ray, mask, trf, sfi.path,
+                                               mask_tolerance);
+        } else {
+            sfi.status = intersection::status::e_missed;
+        }
+    }
 };
 
 }  // namespace detray
@@ -8,10 +8,15 @@
 #pragma once
 
 // Project include(s)
+#include "detray/definitions/qualifiers.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_cylinder_intersector.hpp"
+#include "detray/intersection/helix_plane_intersector.hpp"
+#include "detray/intersection/intersection.hpp"
 #include "detray/utils/ranges.hpp"
-#include "tests/common/tools/intersectors/helix_cylinder_intersector.hpp"
-#include "tests/common/tools/intersectors/helix_plane_intersector.hpp"
+
+// System include(s)
+#include <array>
 
 namespace detray {
 
@@ -45,7 +50,8 @@ struct helix_intersection_initialize {
         const scalar mask_tolerance = 0.f) const {
 
         using mask_t = typename mask_group_t::value_type;
-        using transform3_t = typename transform_container_t::value_type;
+        // The transform store might hold a compact representation
+        using transform3_t = typename mask_t::algebra_type;
 
         const auto &ctf = contextual_transforms[surface.transform()];
 
@@ -46,6 +46,7 @@ template <typename surface_handle_t,
           typename algebra_t = __plugin::transform3<detray::scalar>>
 struct intersection2D {
 
+    using algebra_type = algebra_t;
     using scalar_t = typename algebra_t::scalar_type;
     using point3 = typename algebra_t::point3;
     using point2 = typename algebra_t::point2;
@@ -77,6 +78,10 @@ struct intersection2D {
     point2 p2{std::numeric_limits<scalar_t>::infinity(),
               std::numeric_limits<scalar_t>::infinity()};
 
+    /// Lower bound on the path length the track needs to reach the surface
+    /// (zero: unknown). Lets the navigator skip the update of the candidate
+    scalar_t safety{0.f};
+
     /// @param rhs is the right hand side intersection for comparison
     DETRAY_HOST_DEVICE
     bool operator<(const intersection2D &rhs) const {
@@ -8,12 +8,63 @@
 #pragma once
 
 // Project include(s)
+#include "detray/coordinates/cartesian2.hpp"
+#include "detray/definitions/indexing.hpp"
 #include "detray/definitions/qualifiers.hpp"
+#include "detray/intersection/concentric_cylinder_intersector.hpp"
+#include "detray/intersection/cylinder_intersector.hpp"
+#include "detray/intersection/detail/trajectories.hpp"
 #include "detray/intersection/intersection.hpp"
+#include "detray/intersection/plane_intersector.hpp"
+#include "detray/intersection/soa_plane_intersector.hpp"
 #include "detray/utils/ranges.hpp"
 
+// System include(s)
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
 namespace detray {
 
+namespace detail {
+
+/// Checks whether a type is a range of surfaces (elements have a mask link)
+template <typename T, typename = void>
+struct is_surface_range : public std::false_type {};
+
+template <typename T>
+struct is_surface_range<
+    T, std::void_t<decltype((*std::declval<const T &>().begin()).mask())>>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_surface_range_v = is_surface_range<T>::value;
+
+/// Checks whether the intersector of a mask can update only the path and the
+/// status of an intersection
+template <typename mask_t, typename traj_t, typename intersection_t,
+          typename transform3_t, typename = void>
+struct has_path_update : public std::false_type {};
+
+template <typename mask_t, typename traj_t, typename intersection_t,
+          typename transform3_t>
+struct has_path_update<
+    mask_t, traj_t, intersection_t, transform3_t,
+    std::void_t<decltype(
+        std::declval<const mask_t &>().intersector().update_path(
+            std::declval<const traj_t &>(), std::declval<intersection_t &>(),
+            std::declval<const mask_t &>(),
+            std::declval<const transform3_t &>(), scalar{0.f}))>>
+    : public std::true_type {};
+
+template <typename mask_t, typename traj_t, typename intersection_t,
+          typename transform3_t>
+inline constexpr bool has_path_update_v =
+    has_path_update<mask_t, traj_t, intersection_t, transform3_t>::value;
+
+}  // namespace detail
+
 /// A functor to add all valid intersections between the trajectory and surface
 struct intersection_initialize {
 
@@ -36,7 +87,9 @@ struct intersection_initialize {
     /// @return the number of valid intersections
     template <typename mask_group_t, typename mask_range_t,
               typename is_container_t, typename traj_t, typename surface_t,
-              typename transform_container_t>
+              typename transform_container_t,
+              std::enable_if_t<not detail::is_surface_range_v<mask_range_t>,
+                               bool> = true>
     DETRAY_HOST_DEVICE inline void operator()(
         const mask_group_t &mask_group, const mask_range_t &mask_range,
         is_container_t &is_container, const traj_t &traj,
@@ -58,7 +111,135 @@ struct intersection_initialize {
         }
     }
 
+    /// Operator function to initalize the intersections with a range of
+    /// surfaces that all share the mask type of @param mask_group
+    ///
+    /// Rays are intersected with planar surfaces in batches of
+    /// @c batch_size, using the SoA plane intersector. All other
+    /// combinations are intersected surface by surface.
+    ///
+    /// @param surfaces the surfaces to be intersected
+    template <typename mask_group_t, typename surface_range_t,
+              typename is_container_t, typename traj_t,
+              typename transform_container_t,
+              std::enable_if_t<detail::is_surface_range_v<surface_range_t>,
+                               bool> = true>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const mask_group_t &mask_group, const surface_range_t &surfaces,
+        is_container_t &is_container, const traj_t &traj,
+        const transform_container_t &contextual_transforms,
+        const scalar mask_tolerance = 0.f) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using intersection_t = typename is_container_t::value_type;
+        using algebra_t = typename intersection_t::algebra_type;
+
+        if constexpr (std::is_same_v<typename mask_t::shape::template
+                                         intersector_type<algebra_t>,
+                                     plane_intersector<algebra_t>> and
+                      std::is_same_v<traj_t, detail::ray<algebra_t>>) {
+
+            using scalar_t = typename algebra_t::scalar_type;
+
+            plane_batch<scalar_t, batch_size> batch{};
+            std::array<const std::decay_t<decltype(*surfaces.begin())> *,
+                       batch_size>
+                batch_surfaces{};
+
+            for (const auto &sf : surfaces) {
+                batch_surfaces[batch.n] = &sf;
+                batch.push_back(contextual_transforms[sf.transform()]);
+
+                if (batch.full()) {
+                    intersect_batch(mask_group, batch, batch_surfaces,
+                                    is_container, traj, contextual_transforms,
+                                    mask_tolerance);
+                    batch.clear();
+                }
+            }
+            if (batch.n > 0u) {
+                intersect_batch(mask_group, batch, batch_surfaces,
+                                is_container, traj, contextual_transforms,
+                                mask_tolerance);
+            }
+        } else {
+            for (const auto &sf : surfaces) {
+                this->operator()(mask_group, detail::get<1>(sf.mask()),
+                                 is_container, traj, sf,
+                                 contextual_transforms, mask_tolerance);
+            }
+        }
+    }
+
+    /// Number of planar surfaces that are intersected at once
+    static constexpr std::size_t batch_size{8u};
+
     private:
+    /// Intersect the ray @param ray with a full or partial @param batch of
+    /// planar surfaces and check the masks of the surfaces
+    template <typename mask_group_t, typename batch_t,
+              typename surface_ptrs_t, typename is_container_t,
+              typename ray_t, typename transform_container_t>
+    DETRAY_HOST_DEVICE inline void intersect_batch(
+        const mask_group_t &mask_group, const batch_t &batch,
+        const surface_ptrs_t &batch_surfaces, is_container_t &is_container,
+        const ray_t &ray, const transform_container_t &contextual_transforms,
+        const scalar mask_tolerance) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using intersection_t = typename is_container_t::value_type;
+        using algebra_t = typename intersection_t::algebra_type;
+        using scalar_t = typename algebra_t::scalar_type;
+        using point2_t = typename algebra_t::point2;
+        using point3_t = typename algebra_t::point3;
+
+        plane_batch_result<scalar_t, batch_t::capacity> res{};
+        soa_plane_intersector<algebra_t>{}(ray, batch, res);
+
+        for (std::size_t i = 0u; i < batch.n; ++i) {
+            // Parallel to the surface or not valid for navigation (also
+            // catches NaN)
+            if (res.cos_incidence_angle[i] == 0.f or
+                not(res.path[i] >= ray.overstep_tolerance())) {
+                continue;
+            }
+
+            const auto &sf = *batch_surfaces[i];
+            const point3_t p3{res.x[i], res.y[i], res.z[i]};
+
+            // The local cartesian position is already known
+            point2_t p2{res.loc0[i], res.loc1[i]};
+            if constexpr (not std::is_same_v<typename mask_t::local_frame_type,
+                                             cartesian2<algebra_t>>) {
+                p2 = typename mask_t::local_frame_type{}.global_to_local(
+                    contextual_transforms[sf.transform()], p3, ray.dir());
+            }
+
+            // Run over the masks that belong to the surface (only one can be
+            // hit)
+            for (const auto &mask : detray::ranges::subrange(
+                     mask_group, detail::get<1>(sf.mask()))) {
+
+                if (mask.is_inside(p2, mask_tolerance) ==
+                    intersection::status::e_inside) {
+                    intersection_t is{};
+                    is.status = intersection::status::e_inside;
+                    is.path = res.path[i];
+                    is.surface = sf;
+                    is.p3 = p3;
+                    is.p2 = p2;
+                    is.direction = std::signbit(is.path)
+                                       ? intersection::direction::e_opposite
+                                       : intersection::direction::e_along;
+                    is.volume_link = mask.volume_link();
+                    is.cos_incidence_angle = res.cos_incidence_angle[i];
+                    is_container.push_back(is);
+                    break;
+                }
+            }
+        }
+    }
+
     template <typename is_container_t>
     DETRAY_HOST_DEVICE bool place_in_collection(
         typename is_container_t::value_type &&sfi,
@@ -132,4 +313,121 @@ struct intersection_update {
     }
 };
 
+/// A functor to update only the path and the status of an intersection.
+///
+/// The remaining data of the intersection (positions, incidence angle etc.)
+/// is not recomputed, which makes this cheaper than @c intersection_update
+/// when many candidates have to be refreshed after a step, but only their
+/// ordering and reachability is needed. Falls back to the full update for
+/// intersectors that do not provide a path-only update.
+struct intersection_path_update {
+
+    /// Operator function to update the path of the intersection
+    ///
+    /// @tparam mask_group_t is the input mask group type found by variadic
+    /// unrolling
+    /// @tparam traj_t is the input trajectory type (e.g. ray or helix)
+    /// @tparam surface_t is the input surface type
+    /// @tparam transform_container_t is the input transform store type
+    ///
+    /// @param mask_group is the input mask group
+    /// @param mask_range is the range of masks in the group that belong to the
+    ///                   surface
+    /// @param traj is the input trajectory
+    /// @param surface is the input surface
+    /// @param contextual_transforms is the input transform container
+    /// @param mask_tolerance is the tolerance for mask size
+    ///
+    /// @return whether the intersection is still valid
+    template <typename mask_group_t, typename mask_range_t, typename traj_t,
+              typename intersection_t, typename transform_container_t>
+    DETRAY_HOST_DEVICE inline bool operator()(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        const traj_t &traj, intersection_t &sfi,
+        const transform_container_t &contextual_transforms,
+        const scalar mask_tolerance = 0.f) const {
+
+        using mask_t = typename mask_group_t::value_type;
+
+        const auto &ctf = contextual_transforms[sfi.surface.transform()];
+        using transform3_t = std::decay_t<decltype(ctf)>;
+
+        // Run over the masks that belong to the surface
+        for (const auto &mask :
+             detray::ranges::subrange(mask_group, mask_range)) {
+
+            if constexpr (detail::has_path_update_v<mask_t, traj_t,
+                                                    intersection_t,
+                                                    transform3_t>) {
+                mask.intersector().update_path(traj, sfi, mask, ctf,
+                                               mask_tolerance);
+            } else {
+                mask.intersector().update(traj, sfi, mask, ctf,
+                                          mask_tolerance);
+            }
+
+            if (sfi.status == intersection::status::e_inside) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+/// A functor to compute a lower bound on the distance between a point and a
+/// surface, i.e. the distance to the plane or to the cylinder the surface
+/// lies on. Is zero for all other surface types.
+struct surface_safety {
+
+    /// Operator function to compute the safety distance
+    ///
+    /// @param mask_group is the input mask group
+    /// @param mask_range is the range of masks in the group that belong to the
+    ///                   surface
+    /// @param pos is the global position
+    /// @param surface is the input surface
+    /// @param contextual_transforms is the input transform container
+    ///
+    /// @return the distance that no trajectory from @param pos can undercut
+    template <typename mask_group_t, typename mask_range_t, typename point3_t,
+              typename surface_t, typename transform_container_t>
+    DETRAY_HOST_DEVICE inline scalar operator()(
+        const mask_group_t &mask_group, const mask_range_t &mask_range,
+        const point3_t &pos, const surface_t &surface,
+        const transform_container_t &contextual_transforms) const {
+
+        using mask_t = typename mask_group_t::value_type;
+        using transform3_t = typename mask_t::algebra_type;
+        using intersector_t =
+            typename mask_t::shape::template intersector_type<transform3_t>;
+
+        constexpr bool is_plane{
+            std::is_same_v<intersector_t, plane_intersector<transform3_t>>};
+        constexpr bool is_cylinder{
+            std::is_base_of_v<cylinder_intersector<transform3_t>,
+                              intersector_t> or
+            std::is_same_v<intersector_t,
+                           concentric_cylinder_intersector<transform3_t>>};
+
+        const auto &ctf = contextual_transforms[surface.transform()];
+
+        if constexpr (is_plane) {
+            return std::abs(vector::dot(ctf.z(), pos - ctf.translation()));
+        } else if constexpr (is_cylinder) {
+            const scalar rho{getter::perp(ctf.point_to_local(pos))};
+
+            scalar safety{std::numeric_limits<scalar>::max()};
+            for (const auto &mask :
+                 detray::ranges::subrange(mask_group, mask_range)) {
+                const scalar d{std::abs(rho - mask[mask_t::shape::e_r])};
+                safety = d < safety ? d : safety;
+            }
+            return safety;
+        } else {
+            return 0.f;
+        }
+    }
+};
+
 }  // namespace detray
\ No newline at end of file
@@ -45,20 +45,20 @@ struct line_intersector {
     //
     /// @return the intersection
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
                                         line2<transform3_t>>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline intersection2D<surface_t, transform3_t>
     operator()(const ray_type &ray, const surface_t sf, const mask_t &mask,
-               const transform3_t &trf,
+               const trf_t &trf,
                const scalar_type mask_tolerance = 0.f) const {
 
         using intersection_t = intersection2D<surface_t, transform3_t>;
         intersection_t is;
 
         // line direction
-        const vector3 _z = getter::vector<3>(trf.matrix(), 0u, 2u);
+        const vector3 _z = trf.z();
 
         // line center
         const point3 _t = trf.translation();
@@ -154,16 +154,70 @@ struct line_intersector {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
                                         line2<transform3_t>>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
-        const mask_t &mask, const transform3_t &trf,
+        const mask_t &mask, const trf_t &trf,
         const scalar_type mask_tolerance = 0.f) const {
         sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance);
     }
+
+    /// Operator function to update only the path and the status of an
+    /// intersection between a ray and a line. The remaining data of the
+    /// intersection is left as it is.
+    ///
+    /// @tparam mask_t is the input mask type
+    /// @tparam surface_t is the type of surface handle
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be updated
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    template <
+        typename mask_t, typename surface_t, typename trf_t,
+        std::enable_if_t<std::is_same_v<typename mask_t::measurement_frame_type,
+                                        line2<transform3_t>>,
+                         bool> = true>
+    DETRAY_HOST_DEVICE inline void update_path(
+        const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
+        const mask_t &mask, const trf_t &trf,
+        const scalar_type mask_tolerance = 0.f) const {
+
+        const vector3 _z = trf.z();
+        const vector3 &_d = ray.dir();
+        const scalar_type zd{vector::dot(_z, _d)};
+        const scalar_type denom{1.f - (zd * zd)};
+
+        // Case for wire is parallel to track
+        if (denom < 1e-5f) {
+            sfi.status = intersection::status::e_missed;
+            return;
+        }
+
+        const auto t2l = trf.translation() - ray.pos();
+
+        // path length to the point of closest approach on the track
+        sfi.path = 1.f / denom *
+                   (vector::dot(t2l, _d) - vector::dot(t2l, _z) * zd);
+
+        if (sfi.path < ray.overstep_tolerance()) {
+            sfi.status = intersection::status::e_missed;
+            return;
+        }
+
+        const point3 m = ray.pos() + _d * sfi.path;
+        if constexpr (mask_t::shape::square_cross_sect) {
+            sfi.status =
+                mask.is_inside(mask.to_local_frame(trf, m), mask_tolerance);
+        } else {
+            sfi.status = mask.is_inside(mask.to_measurement_frame(trf, m, _d),
+                                        mask_tolerance);
+        }
+    }
 };
 
 }  // namespace detray
\ No newline at end of file
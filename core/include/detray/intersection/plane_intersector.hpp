@@ -44,21 +44,20 @@ struct plane_intersector {
     ///
     /// @return the intersection
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::loc_point_t, point2>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline intersection2D<surface_t, transform3_t>
     operator()(const ray_type &ray, const surface_t sf, const mask_t &mask,
-               const transform3_t &trf,
+               const trf_t &trf,
                const scalar_type mask_tolerance = 0.f) const {
 
         using intersection_t = intersection2D<surface_t, transform3_t>;
         intersection_t is;
 
         // Retrieve the surface normal & translation (context resolved)
-        const auto &sm = trf.matrix();
-        const vector3 sn = getter::vector<3>(sm, 0u, 2u);
-        const vector3 st = getter::vector<3>(sm, 0u, 3u);
+        const vector3 sn = trf.z();
+        const point3 st = trf.translation();
 
         // Intersection code
         const point3 &ro = ray.pos();
@@ -108,15 +107,55 @@ struct plane_intersector {
     /// @param trf is the surface placement transform
     /// @param mask_tolerance is the tolerance for mask edges
     template <
-        typename mask_t, typename surface_t,
+        typename mask_t, typename surface_t, typename trf_t,
         std::enable_if_t<std::is_same_v<typename mask_t::loc_point_t, point2>,
                          bool> = true>
     DETRAY_HOST_DEVICE inline void update(
         const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
-        const mask_t &mask, const transform3_t &trf,
+        const mask_t &mask, const trf_t &trf,
         const scalar_type mask_tolerance = 0.f) const {
         sfi = this->operator()(ray, sfi.surface, mask, trf, mask_tolerance);
     }
+
+    /// Operator function to update only the path and the status of an
+    /// intersection between a ray and a planar surface. The remaining data
+    /// of the intersection is left as it is.
+    ///
+    /// @tparam mask_t is the input mask type
+    /// @tparam surface_t is the type of surface handle
+    ///
+    /// @param ray is the input ray trajectory
+    /// @param sfi the intersection to be updated
+    /// @param mask is the input mask that defines the surface extent
+    /// @param trf is the surface placement transform
+    /// @param mask_tolerance is the tolerance for mask edges
+    template <
+        typename mask_t, typename surface_t, typename trf_t,
+        std::enable_if_t<std::is_same_v<typename mask_t::loc_point_t, point2>,
+                         bool> = true>
+    DETRAY_HOST_DEVICE inline void update_path(
+        const ray_type &ray, intersection2D<surface_t, transform3_t> &sfi,
+        const mask_t &mask, const trf_t &trf,
+        const scalar_type mask_tolerance = 0.f) const {
+
+        const vector3 sn = trf.z();
+        const point3 st = trf.translation();
+
+        const point3 &ro = ray.pos();
+        const vector3 &rd = ray.dir();
+        const scalar_type denom = vector::dot(rd, sn);
+
+        sfi.status = intersection::status::e_missed;
+        if (denom != 0.f) {
+            sfi.path = vector::dot(sn, st - ro) / denom;
+
+            if (sfi.path >= ray.overstep_tolerance()) {
+                sfi.status = mask.is_inside(
+                    mask.to_local_frame(trf, ro + sfi.path * rd, rd),
+                    mask_tolerance);
+            }
+        }
+    }
 };
 
 }  // namespace detray
\ No newline at end of file
@@ -0,0 +1,151 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/intersection/detail/trajectories.hpp"
+
+// System include(s)
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace detray {
+
+/// @brief Placements of a batch of planar surfaces in SoA layout.
+///
+/// Holds the normal, the translation and the local x- and y-axes of up to
+/// @tparam N surfaces, one array per component, so that a ray can be
+/// intersected with all surfaces in a single vectorizable loop.
+template <typename scalar_t, std::size_t N>
+struct plane_batch {
+
+    using scalar_type = scalar_t;
+    using component_type = std::array<scalar_type, N>;
+
+    /// Maximal number of surfaces in the batch
+    static constexpr std::size_t capacity{N};
+
+    /// Local x-axes
+    component_type ux{}, uy{}, uz{};
+    /// Local y-axes
+    component_type vx{}, vy{}, vz{};
+    /// Normals (local z-axes)
+    component_type nx{}, ny{}, nz{};
+    /// Translations
+    component_type tx{}, ty{}, tz{};
+
+    /// Number of surfaces in the batch
+    std::size_t n{0u};
+
+    /// @returns true if no more surfaces fit into the batch
+    DETRAY_HOST_DEVICE
+    constexpr bool full() const { return n == N; }
+
+    /// Remove all surfaces from the batch
+    DETRAY_HOST_DEVICE
+    constexpr void clear() { n = 0u; }
+
+    /// Add the placement @param trf of a planar surface
+    template <typename transform3_t>
+    DETRAY_HOST_DEVICE inline void push_back(const transform3_t &trf) {
+        const auto x = trf.x();
+        const auto y = trf.y();
+        const auto z = trf.z();
+        const auto t = trf.translation();
+
+        ux[n] = x[0];
+        uy[n] = x[1];
+        uz[n] = x[2];
+        vx[n] = y[0];
+        vy[n] = y[1];
+        vz[n] = y[2];
+        nx[n] = z[0];
+        ny[n] = z[1];
+        nz[n] = z[2];
+        tx[n] = t[0];
+        ty[n] = t[1];
+        tz[n] = t[2];
+
+        ++n;
+    }
+};
+
+/// @brief Results of a batched plane intersection in SoA layout.
+template <typename scalar_t, std::size_t N>
+struct plane_batch_result {
+
+    using component_type = std::array<scalar_t, N>;
+
+    /// Path length along the ray (NaN or infinite if parallel)
+    component_type path{};
+    /// Local cartesian position on the surface
+    component_type loc0{}, loc1{};
+    /// Global position
+    component_type x{}, y{}, z{};
+    /// Cosine of the incidence angle (zero if parallel)
+    component_type cos_incidence_angle{};
+};
+
+/// A functor that intersects a straight line with a batch of planar
+/// surfaces.
+///
+/// All lanes are computed without branches, so that the loop can be
+/// vectorized by the compiler. Lanes beyond the number of surfaces in the
+/// batch contain unspecified values. The masks are checked by the caller.
+template <typename transform3_t>
+struct soa_plane_intersector {
+
+    using scalar_type = typename transform3_t::scalar_type;
+    using ray_type = detail::ray<transform3_t>;
+
+    /// Intersect the @param ray with all surfaces in @param batch
+    ///
+    /// @param[out] res the intersection path and positions per surface
+    template <std::size_t N>
+    DETRAY_HOST_DEVICE inline void operator()(
+        const ray_type &ray, const plane_batch<scalar_type, N> &batch,
+        plane_batch_result<scalar_type, N> &res) const {
+
+        const auto &ro = ray.pos();
+        const auto &rd = ray.dir();
+        const scalar_type ox{ro[0]}, oy{ro[1]}, oz{ro[2]};
+        const scalar_type dx{rd[0]}, dy{rd[1]}, dz{rd[2]};
+
+        for (std::size_t i = 0u; i < N; ++i) {
+            const scalar_type denom{dx * batch.nx[i] + dy * batch.ny[i] +
+                                    dz * batch.nz[i]};
+            const scalar_type dist{batch.nx[i] * (batch.tx[i] - ox) +
+                                   batch.ny[i] * (batch.ty[i] - oy) +
+                                   batch.nz[i] * (batch.tz[i] - oz)};
+            const scalar_type s{dist / denom};
+
+            const scalar_type px{ox + s * dx};
+            const scalar_type py{oy + s * dy};
+            const scalar_type pz{oz + s * dz};
+
+            // Position relative to the surface origin in the local frame
+            const scalar_type rx{px - batch.tx[i]};
+            const scalar_type ry{py - batch.ty[i]};
+            const scalar_type rz{pz - batch.tz[i]};
+
+            res.path[i] = s;
+            res.x[i] = px;
+            res.y[i] = py;
+            res.z[i] = pz;
+            res.loc0[i] =
+                batch.ux[i] * rx + batch.uy[i] * ry + batch.uz[i] * rz;
+            res.loc1[i] =
+                batch.vx[i] * rx + batch.vy[i] * ry + batch.vz[i] * rz;
+            res.cos_incidence_angle[i] = std::abs(denom);
+        }
+    }
+};
+
+}  // namespace detray
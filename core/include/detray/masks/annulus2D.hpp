@@ -158,22 +158,25 @@ class annulus2D {
         // Rotate by avr phi in the focal system (this is usually zero)
         const scalar_t phi_strp{loc_p[1] - bounds[e_average_phi]};
 
-        // Check phi boundaries, which are well def. in focal frame
+        // Check phi boundaries, which are well def. in focal frame. Unlike
+        // for the other shapes, returning early pays off here, since it saves
+        // the sine and cosine below
         if ((phi_strp < bounds[e_min_phi_rel] - tol) or
             (phi_strp > bounds[e_max_phi_rel] + tol)) {
             return false;
         }
 
-        // Now go to beam frame to check r boundaries. Use the origin
-        // shift in polar coordinates for that
-        // TODO: Put shift in r-phi into the bounds?
-        const point_t shift_xy = {-bounds[e_shift_x], -bounds[e_shift_y]};
-        const scalar_t shift_r{getter::perp(shift_xy)};
-        const scalar_t shift_phi{getter::phi(shift_xy)};
+        // Now go to beam frame to check r boundaries: The origin of the beam
+        // frame lies at -shift in the focal frame. Expanding the cosine of
+        // the angle difference avoids the polar angle of the shift
+        const scalar_t shift_x{bounds[e_shift_x]};
+        const scalar_t shift_y{bounds[e_shift_y]};
 
-        const scalar_t r_mod2{shift_r * shift_r + loc_p[0] * loc_p[0] +
-                              2.f * shift_r * loc_p[0] *
-                                  math_ns::cos(phi_strp - shift_phi)};
+        const scalar_t r_mod2{
+            shift_x * shift_x + shift_y * shift_y + loc_p[0] * loc_p[0] -
+            2.f * loc_p[0] *
+                (shift_x * math_ns::cos(phi_strp) +
+                 shift_y * math_ns::sin(phi_strp))};
 
         // Apply tolerances as squares: 0 <= a, 0 <= b: a^2 <= b^2 <=> a <= b
         const scalar_t minR_tol{bounds[e_min_r] - tol};
@@ -181,8 +184,8 @@ class annulus2D {
 
         assert(minR_tol >= 0.f);
 
-        return ((r_mod2 >= minR_tol * minR_tol) and
-                (r_mod2 <= maxR_tol * maxR_tol));
+        return (r_mod2 >= minR_tol * minR_tol) &
+               (r_mod2 <= maxR_tol * maxR_tol);
     }
 
     /// @brief Lower and upper point for minimal axis aligned bounding box.
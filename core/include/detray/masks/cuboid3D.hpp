@@ -106,12 +106,12 @@ class cuboid3D {
     DETRAY_HOST_DEVICE inline bool check_boundaries(
         const bounds_t<scalar_t, kDIM> &bounds, const point_t &loc_p,
         const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
-        return (bounds[e_min_x] - tol <= loc_p[0] and
-                bounds[e_min_y] - tol <= loc_p[1] and
-                bounds[e_min_x] - tol <= loc_p[2] and
-                loc_p[0] <= bounds[e_max_x] + tol and
-                loc_p[1] <= bounds[e_max_y] + tol and
-                loc_p[2] <= bounds[e_max_z] + tol);
+        return (bounds[e_min_x] - tol <= loc_p[0]) &
+               (bounds[e_min_y] - tol <= loc_p[1]) &
+               (bounds[e_min_z] - tol <= loc_p[2]) &
+               (loc_p[0] <= bounds[e_max_x] + tol) &
+               (loc_p[1] <= bounds[e_max_y] + tol) &
+               (loc_p[2] <= bounds[e_max_z] + tol);
     }
 
     /// @brief Lower and upper point for minimal axis aligned bounding box.
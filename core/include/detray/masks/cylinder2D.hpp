@@ -119,12 +119,12 @@ class cylinder2D {
         const bounds_t<scalar_t, kDIM>& bounds, const point_t& loc_p,
         const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
         if constexpr (kRadialCheck) {
-            return (std::abs(loc_p[0] - bounds[e_r]) <= 10.f * tol and
-                    bounds[e_n_half_z] - tol <= loc_p[2] and
-                    loc_p[2] <= bounds[e_p_half_z] + tol);
+            return (std::abs(loc_p[0] - bounds[e_r]) <= 10.f * tol) &
+                   (bounds[e_n_half_z] - tol <= loc_p[2]) &
+                   (loc_p[2] <= bounds[e_p_half_z] + tol);
         } else {
-            return (bounds[e_n_half_z] - tol <= loc_p[1] and
-                    loc_p[1] <= bounds[e_p_half_z] + tol);
+            return (bounds[e_n_half_z] - tol <= loc_p[1]) &
+                   (loc_p[1] <= bounds[e_p_half_z] + tol);
         }
     }
 
@@ -127,17 +127,21 @@ class line {
         // point of closest approach on thw line from the line center is less
         // than the half line length
         if constexpr (square_cross_sect) {
-            return (std::abs(loc_p[0]) <= bounds[e_cross_section] + tol &&
-                    std::abs(loc_p[1]) <= bounds[e_cross_section] + tol &&
-                    std::abs(loc_p[2]) <= bounds[e_half_z] + tol);
+            const scalar_t abs_x{std::abs(loc_p[0])};
+            const scalar_t abs_y{std::abs(loc_p[1])};
+            const scalar_t abs_z{std::abs(loc_p[2])};
+            return (abs_x <= bounds[e_cross_section] + tol) &
+                   (abs_y <= bounds[e_cross_section] + tol) &
+                   (abs_z <= bounds[e_half_z] + tol);
 
             // For a circular cross section, we check if (1) the radial distance
             // is within the scope and (2) the distance to the point of closest
             // approach on the line from the line center is less than the line
             // half length
         } else {
-            return (loc_p[0] <= bounds[e_cross_section] + tol &&
-                    std::abs(loc_p[1]) <= bounds[e_half_z] + tol);
+            const scalar_t abs_z{std::abs(loc_p[1])};
+            return (loc_p[0] <= bounds[e_cross_section] + tol) &
+                   (abs_z <= bounds[e_half_z] + tol);
         }
     }
 
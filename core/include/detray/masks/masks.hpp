@@ -24,7 +24,9 @@
 // System include(s)
 #include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
 namespace detray {
@@ -48,6 +50,7 @@ template <typename shape_t, typename links_t = dindex,
 class mask {
     public:
     using links_type = links_t;
+    using algebra_type = algebra_t;
     using scalar_type = typename algebra_t::scalar_type;
     using shape = shape_t;
     using boundaries = typename shape::boundaries;
@@ -177,6 +180,32 @@ class mask {
                    : intersection::status::e_outside;
     }
 
+    /// @brief Mask this shape onto a batch of points.
+    ///
+    /// The boundary checks of the shapes evaluate all conditions without
+    /// short-circuiting, so that the loop over the points is free of branches
+    /// and can be vectorized (the annulus still returns early on its phi
+    /// check, which saves the trigonometric functions).
+    ///
+    /// @param loc_ps the points to be checked in the local frame
+    /// @param[out] inside flags whether the respective point is inside
+    /// @param tol dynamic tolerance determined by caller
+    ///
+    /// @return the number of points that are inside
+    template <std::size_t N>
+    DETRAY_HOST_DEVICE inline unsigned int is_inside(
+        const array_t<loc_point_t, N>& loc_ps, array_t<bool, N>& inside,
+        const scalar_type t = std::numeric_limits<scalar_type>::epsilon())
+        const {
+
+        unsigned int n_inside{0u};
+        for (std::size_t i = 0u; i < N; ++i) {
+            inside[i] = _shape.check_boundaries(_values, loc_ps[i], t);
+            n_inside += static_cast<unsigned int>(inside[i]);
+        }
+        return n_inside;
+    }
+
     /// @returns return local frame object (used in geometrical checks)
     DETRAY_HOST_DEVICE inline constexpr local_frame_type local_frame() const {
         return local_frame_type{};
@@ -246,4 +275,35 @@ class mask {
     links_type _volume_link{std::numeric_limits<links_type>::max()};
 };
 
+/// @brief Mask a number of masks of the same type onto a single point.
+///
+/// This is e.g. the case for the masks of a surface, which share the local
+/// frame. All masks are checked without branching.
+///
+/// @param masks the range of masks
+/// @param loc_p the point to be checked in the local frame of the masks
+/// @param[out] inside flags whether the point is inside the respective mask
+/// @param tol dynamic tolerance determined by caller
+///
+/// @return the number of masks that contain the point
+template <typename mask_range_t, typename point_t, typename output_t,
+          typename scalar_t>
+DETRAY_HOST_DEVICE inline unsigned int is_inside(const mask_range_t& masks,
+                                                 const point_t& loc_p,
+                                                 output_t& inside,
+                                                 const scalar_t tol) {
+    using mask_t = std::decay_t<decltype(*std::begin(masks))>;
+    using mask_scalar_t = typename mask_t::scalar_type;
+
+    unsigned int n_inside{0u};
+    std::size_t i{0u};
+    for (const auto& m : masks) {
+        inside[i] = typename mask_t::shape{}.check_boundaries(
+            m.values(), loc_p, static_cast<mask_scalar_t>(tol));
+        n_inside += static_cast<unsigned int>(inside[i]);
+        ++i;
+    }
+    return n_inside;
+}
+
 }  // namespace detray
\ No newline at end of file
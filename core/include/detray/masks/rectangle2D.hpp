@@ -100,8 +100,10 @@ class rectangle2D {
     DETRAY_HOST_DEVICE inline bool check_boundaries(
         const bounds_t<scalar_t, kDIM>& bounds, const point_t& loc_p,
         const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
-        return (std::abs(loc_p[0]) <= bounds[e_half_x] + tol and
-                std::abs(loc_p[1]) <= bounds[e_half_y] + tol);
+        const scalar_t abs_x{std::abs(loc_p[0])};
+        const scalar_t abs_y{std::abs(loc_p[1])};
+        return (abs_x <= bounds[e_half_x] + tol) &
+               (abs_y <= bounds[e_half_y] + tol);
     }
 
     /// @brief Lower and upper point for minimal axis aligned bounding box.
@@ -102,8 +102,8 @@ class ring2D {
         const bounds_t<scalar_t, kDIM>& bounds, const point_t& loc_p,
         const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
 
-        return (loc_p[0] + tol >= bounds[e_inner_r] and
-                loc_p[0] <= bounds[e_outer_r] + tol);
+        return (loc_p[0] + tol >= bounds[e_inner_r]) &
+               (loc_p[0] <= bounds[e_outer_r] + tol);
     }
 
     /// @brief Lower and upper point for minimal axis aligned bounding box.
@@ -107,11 +107,13 @@ class trapezoid2D {
         const scalar_t tol = std::numeric_limits<scalar_t>::epsilon()) const {
         const scalar_t rel_y{(bounds[e_half_length_2] + loc_p[1]) *
                              bounds[e_divisor]};
-        return (std::abs(loc_p[0]) <= bounds[e_half_length_0] +
-                                          rel_y * (bounds[e_half_length_1] -
-                                                   bounds[e_half_length_0]) +
-                                          tol and
-                std::abs(loc_p[1]) <= bounds[e_half_length_2] + tol);
+        const scalar_t half_x{bounds[e_half_length_0] +
+                              rel_y * (bounds[e_half_length_1] -
+                                       bounds[e_half_length_0])};
+        const scalar_t abs_x{std::abs(loc_p[0])};
+        const scalar_t abs_y{std::abs(loc_p[1])};
+        return (abs_x <= half_x + tol) &
+               (abs_y <= bounds[e_half_length_2] + tol);
     }
 
     /// @brief Lower and upper point for minimal axis aligned bounding box.
@@ -0,0 +1,356 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/math.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/intersection/intersection.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cmath>
+#include <type_traits>
+
+namespace detray {
+
+namespace detail {
+
+/// Tabulated values of an interaction table per grid node
+template <typename scalar_t>
+struct interaction_table_node {
+    /// Mean energy loss per unit path length
+    scalar_t stopping_power{0.f};
+    /// Landau width in q/p per unit path length
+    scalar_t sigma_qop{0.f};
+};
+
+/// Vecmem based view of an interaction table: The tabulated materials and
+/// nodes, together with the parameters of the log(beta * gamma) grid
+template <typename scalar_t, typename material_t, typename node_t>
+struct interaction_table_view : public dbase_view {
+    scalar_t m_mass{0.f};
+    scalar_t m_log_min{0.f};
+    scalar_t m_step{0.f};
+    scalar_t m_inv_step{0.f};
+    unsigned int m_n_nodes{2u};
+    dvector_view<material_t> m_materials{};
+    dvector_view<node_t> m_nodes{};
+
+    /// @returns true if the viewed table does not hold any material
+    DETRAY_HOST_DEVICE
+    bool empty() const { return m_materials.size() == 0u; }
+};
+
+}  // namespace detail
+
+/// @brief Tabulated material interaction for a fixed particle mass.
+///
+/// For every material in the table, the mean (Bethe) stopping power and the
+/// Landau width in q/p per unit path length are precomputed for a particle
+/// of unit charge on a regular grid in log(beta * gamma). At run time, the
+/// values are linearly interpolated and scaled with the path length and the
+/// charge, which replaces the logarithms, square roots and the density
+/// effect correction of the analytic formulas by a single logarithm.
+///
+/// The interface mirrors @c interaction, so that the table can be used in
+/// its place. Whenever the table cannot answer a query (unknown material,
+/// different particle mass or beta * gamma outside of the grid), the
+/// analytic result is returned.
+///
+/// @note The multiple scattering angle depends on the path length in units
+/// of X0 logarithmically and is therefore always computed analytically.
+///
+/// @tparam container_t the types of underlying containers to be used: The
+/// table is filled on host and can be constructed from its view on device.
+template <typename scalar_t, typename container_t = host_container_types>
+class interaction_table {
+
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+
+    public:
+    using scalar_type = scalar_t;
+    using material_type = material<scalar_type>;
+    using interaction_type = interaction<scalar_type>;
+    using node = detail::interaction_table_node<scalar_type>;
+
+    /// Vecmem based view types
+    using view_type =
+        detail::interaction_table_view<scalar_type, material_type, node>;
+    using const_view_type =
+        detail::interaction_table_view<scalar_type, const material_type,
+                                       const node>;
+
+    /// Range and granularity of the log(beta * gamma) grid
+    struct config {
+        scalar_type min_beta_gamma{0.1f};
+        scalar_type max_beta_gamma{1e5f};
+        unsigned int n_nodes{1024u};
+    };
+
+    /// Constructor for a particle of mass @param mass
+    DETRAY_HOST
+    interaction_table(vecmem::memory_resource &resource,
+                      const scalar_type mass, const config &cfg = {})
+        : m_mass{mass},
+          m_log_min{math_ns::log(cfg.min_beta_gamma)},
+          m_n_nodes{cfg.n_nodes < 2u ? 2u : cfg.n_nodes},
+          m_materials(&resource),
+          m_nodes(&resource) {
+        const scalar_type log_max{math_ns::log(cfg.max_beta_gamma)};
+        m_step =
+            (log_max - m_log_min) / static_cast<scalar_type>(m_n_nodes - 1u);
+        m_inv_step = 1.f / m_step;
+    }
+
+    /// Device-side construction from a vecmem based view type
+    template <typename view_t,
+              std::enable_if_t<detail::is_device_view_v<view_t>, bool> = true>
+    DETRAY_HOST_DEVICE explicit interaction_table(const view_t &view)
+        : m_mass{view.m_mass},
+          m_log_min{view.m_log_min},
+          m_step{view.m_step},
+          m_inv_step{view.m_inv_step},
+          m_n_nodes{view.m_n_nodes},
+          m_materials(view.m_materials),
+          m_nodes(view.m_nodes) {}
+
+    /// @returns the particle mass the table was computed for
+    DETRAY_HOST_DEVICE
+    scalar_type mass() const { return m_mass; }
+
+    /// @returns the number of tabulated materials
+    DETRAY_HOST_DEVICE
+    dindex size() const { return static_cast<dindex>(m_materials.size()); }
+
+    /// @returns the position of the material @param mat in the table or
+    /// an invalid index, if it was not tabulated
+    DETRAY_HOST_DEVICE
+    dindex find(const material_type &mat) const {
+        for (dindex i = 0u; i < size(); ++i) {
+            if (m_materials[i] == mat) {
+                return i;
+            }
+        }
+        return dindex_invalid;
+    }
+
+    /// Tabulate the material @param mat, if it is not vacuum and not yet in
+    /// the table
+    DETRAY_HOST
+    void add(const material_type &mat) {
+        if (mat == vacuum<scalar_type>() or mat.Z() == 0.f or
+            mat.mass_density() == 0.f or find(mat) != dindex_invalid) {
+            return;
+        }
+        m_materials.push_back(mat);
+
+        // Unit charge and unit path length
+        const material_slab<scalar_type> unit_slab(mat, 1.f);
+        intersection2D<dindex> is{};
+        is.cos_incidence_angle = 1.f;
+
+        for (unsigned int i = 0u; i < m_n_nodes; ++i) {
+            const scalar_type log_bg{m_log_min +
+                                     static_cast<scalar_type>(i) * m_step};
+            const scalar_type qop{1.f / (m_mass * math_ns::exp(log_bg))};
+
+            node n{};
+            n.stopping_power = interaction_type().compute_energy_loss_bethe(
+                is, unit_slab, 0, m_mass, qop, 1.f);
+            n.sigma_qop =
+                interaction_type().compute_energy_loss_landau_sigma_QOverP(
+                    is, unit_slab, 0, m_mass, qop, 1.f);
+            m_nodes.push_back(n);
+        }
+    }
+
+    /// Tabulate all materials in the detector material @param store
+    template <typename store_t>
+    DETRAY_HOST void add_materials(const store_t &store) {
+        add_materials<0u>(store);
+    }
+
+    /// @returns the mean energy loss of the material @param mat at the
+    /// intersection @param is (see @c interaction)
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE scalar_type compute_energy_loss_bethe(
+        const intersection2D<surface_t, algebra_t> &is, const material_t &mat,
+        const int pdg, const scalar_type m, const scalar_type qOverP,
+        const scalar_type q) const {
+
+        // return early in case of vacuum or zero thickness
+        if (not mat) {
+            return 0.f;
+        }
+
+        node n{};
+        if (not lookup(mat.get_material(), m, qOverP, q, n)) {
+            return interaction_type().compute_energy_loss_bethe(is, mat, pdg,
+                                                                m, qOverP, q);
+        }
+        // The energy loss scales with q²
+        return q * q * mat.path_segment(is) * n.stopping_power;
+    }
+
+    /// @returns the Landau width in q/p of the material @param mat at the
+    /// intersection @param is (see @c interaction)
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE scalar_type compute_energy_loss_landau_sigma_QOverP(
+        const intersection2D<surface_t, algebra_t> &is, const material_t &mat,
+        const int pdg, const scalar_type m, const scalar_type qOverP,
+        const scalar_type q) const {
+
+        // return early in case of vacuum or zero thickness
+        if (not mat) {
+            return 0.f;
+        }
+
+        node n{};
+        if (not lookup(mat.get_material(), m, qOverP, q, n)) {
+            return interaction_type().compute_energy_loss_landau_sigma_QOverP(
+                is, mat, pdg, m, qOverP, q);
+        }
+        // The width scales with |q|³ (q²/beta² for the energy loss, |q| for
+        // the conversion to q/p)
+        return std::abs(q * q * q) * mat.path_segment(is) * n.sigma_qop;
+    }
+
+    /// @returns the multiple scattering angle (always analytic)
+    template <typename material_t, typename surface_t, typename algebra_t>
+    DETRAY_HOST_DEVICE scalar_type compute_multiple_scattering_theta0(
+        const intersection2D<surface_t, algebra_t> &is, const material_t &mat,
+        const int pdg, const scalar_type m, const scalar_type qOverP,
+        const scalar_type q) const {
+        return interaction_type().compute_multiple_scattering_theta0(
+            is, mat, pdg, m, qOverP, q);
+    }
+
+    /// @returns the view on the interaction table - non-const
+    DETRAY_HOST
+    auto get_data() -> view_type {
+        return {{},
+                m_mass,
+                m_log_min,
+                m_step,
+                m_inv_step,
+                m_n_nodes,
+                detray::get_data(m_materials),
+                detray::get_data(m_nodes)};
+    }
+
+    /// @returns the view on the interaction table - const
+    DETRAY_HOST
+    auto get_data() const -> const_view_type {
+        return {{},
+                m_mass,
+                m_log_min,
+                m_step,
+                m_inv_step,
+                m_n_nodes,
+                detray::get_data(m_materials),
+                detray::get_data(m_nodes)};
+    }
+
+    private:
+    /// Interpolate the tabulated values of material @param mat for a track
+    /// with mass @param m, @param qOverP and charge @param q into @param n
+    ///
+    /// @returns false if the table cannot be used for this query
+    DETRAY_HOST_DEVICE
+    bool lookup(const material_type &mat, const scalar_type m,
+                const scalar_type qOverP, const scalar_type q,
+                node &n) const {
+        if (m != m_mass or q == 0.f) {
+            return false;
+        }
+        const dindex mat_idx{find(mat)};
+        if (mat_idx == dindex_invalid) {
+            return false;
+        }
+
+        // beta * gamma = p / m
+        const scalar_type f{
+            (math_ns::log(std::abs(q / qOverP) / m) - m_log_min) * m_inv_step};
+        const auto last{static_cast<scalar_type>(m_n_nodes - 1u)};
+        // Outside of the grid (also catches NaN)
+        if (not(f >= 0.f and f <= last)) {
+            return false;
+        }
+
+        // The last node belongs to the last interval
+        auto i{static_cast<unsigned int>(f)};
+        i = i < m_n_nodes - 1u ? i : m_n_nodes - 2u;
+        const scalar_type w{f - static_cast<scalar_type>(i)};
+        const node &lo = m_nodes[mat_idx * m_n_nodes + i];
+        const node &hi = m_nodes[mat_idx * m_n_nodes + i + 1u];
+
+        n.stopping_power =
+            lo.stopping_power + w * (hi.stopping_power - lo.stopping_power);
+        n.sigma_qop = lo.sigma_qop + w * (hi.sigma_qop - lo.sigma_qop);
+
+        return true;
+    }
+
+    /// Tabulate the materials of every collection in the material @param store
+    template <std::size_t I, typename store_t>
+    DETRAY_HOST void add_materials(const store_t &store) {
+        constexpr auto id{store_t::value_types::to_id(I)};
+        const auto &coll = store.template get<id>();
+
+        if constexpr (detail::is_grid_collection_v<
+                          std::decay_t<decltype(coll)>>) {
+            // Material maps
+            for (dindex i = 0u; i < coll.size(); ++i) {
+                const auto gr = coll[i];
+                if (gr.data().bin_data()->empty()) {
+                    continue;
+                }
+                for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+                    for (const auto &mat : gr.at(gbin)) {
+                        add(mat.get_material());
+                    }
+                }
+            }
+        } else {
+            for (const auto &mat : coll) {
+                add(mat.get_material());
+            }
+        }
+
+        if constexpr (I < store_t::value_types::n_types - 1u) {
+            add_materials<I + 1u>(store);
+        }
+    }
+
+    /// Particle mass
+    scalar_type m_mass;
+    /// Lower edge and node distance of the log(beta * gamma) grid
+    scalar_type m_log_min;
+    scalar_type m_step{0.f};
+    scalar_type m_inv_step{0.f};
+    /// Number of grid nodes per material
+    unsigned int m_n_nodes;
+    /// The tabulated materials
+    vector_type<material_type> m_materials;
+    /// Grid nodes of all materials, contiguous per material
+    vector_type<node> m_nodes;
+};
+
+}  // namespace detray
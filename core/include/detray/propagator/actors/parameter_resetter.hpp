@@ -57,6 +57,11 @@ struct parameter_resetter : actor {
 
             // Reset jacobian transport to identity matrix
             matrix_operator().set_identity(stepping._jac_transport);
+
+            // The process noise is now part of the bound covariance
+            stepping._free_noise =
+                matrix_operator().template zero<e_free_size, e_free_size>();
+            stepping._has_free_noise = false;
         }
     };
 
@@ -120,6 +120,17 @@ struct parameter_transporter : actor {
                           matrix_operator().transpose(stepping._full_jacobian);
             }
 
+            // Add the process noise that was picked up along the way, which
+            // is already given at the destination surface position
+            if (stepping._has_free_noise) {
+                const matrix_type<e_bound_size, e_free_size> noise_jacobian =
+                    free_to_bound_jacobian * correction_term;
+
+                new_cov = new_cov + noise_jacobian * stepping._free_noise *
+                                        matrix_operator().transpose(
+                                            noise_jacobian);
+            }
+
             // Calculate surface-to-surface covariance transport
             stepping._bound_params.set_covariance(new_cov);
         }
@@ -8,12 +8,15 @@
 #pragma once
 
 // Project include(s).
+#include "detray/core/detail/container_views.hpp"
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/definitions/track_parametrization.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/utils/axis_rotation.hpp"
 #include "detray/utils/ranges.hpp"
+#include "detray/utils/type_traits.hpp"
 
 namespace detray {
 
@@ -27,6 +30,8 @@ struct pointwise_material_interactor : actor {
     using matrix_type =
         typename matrix_operator::template matrix_type<ROWS, COLS>;
     using interaction_type = interaction<scalar_type>;
+    using interaction_table_type =
+        interaction_table<scalar_type, device_container_types>;
     using vector3 = typename transform3_t::vector3;
     using bound_vector = matrix_type<e_bound_size, 1u>;
     using bound_matrix = matrix_type<e_bound_size, e_bound_size>;
@@ -50,6 +55,11 @@ struct pointwise_material_interactor : actor {
         bool do_energy_loss = true;
         bool do_multiple_scattering = true;
 
+        /// View of an optional precomputed interaction table for the
+        /// particle mass (see @c interaction_table::get_data). If it is
+        /// empty, the material interaction is computed analytically
+        typename interaction_table_type::view_type table{};
+
         DETRAY_HOST_DEVICE
         void reset() {
             e_loss = 0.f;
@@ -75,35 +85,73 @@ struct pointwise_material_interactor : actor {
             const scalar qop = stepping().qop();
             const scalar charge = stepping().charge();
 
-            for (const auto &mat :
-                 detray::ranges::subrange(material_group, material_range)) {
-
-                // Energy Loss
-                if (s.do_energy_loss) {
-                    s.e_loss = interaction_type().compute_energy_loss_bethe(
-                        is, mat, s.pdg, s.mass, qop, charge);
-                }
-
-                // @todo: include the radiative loss (Bremsstrahlung)
-                if (s.do_energy_loss && s.do_covariance_transport) {
-                    s.sigma_qop = interaction_type()
-                                      .compute_energy_loss_landau_sigma_QOverP(
-                                          is, mat, s.pdg, s.mass, qop, charge);
+            if constexpr (detail::is_grid_collection_v<material_group_t>) {
+                // Material map: Only the slab in the bin of the local
+                // intersection position contributes
+                for (const auto &mat :
+                     material_group[material_range].search(is.p2)) {
+                    // Empty bin
+                    if (not mat) {
+                        return false;
+                    }
+                    interact(mat, is, s, qop, charge);
                 }
-
-                // Covariance update
-                if (s.do_multiple_scattering) {
-                    // @todo: use momentum before or after energy loss in
-                    // backward mode?
-                    s.projected_scattering_angle =
-                        interaction_type().compute_multiple_scattering_theta0(
-                            is, mat, s.pdg, s.mass, qop, charge);
+            } else {
+                for (const auto &mat : detray::ranges::subrange(
+                         material_group, material_range)) {
+                    interact(mat, is, s, qop, charge);
                 }
             }
 
             // always true?
             return true;
         }
+
+        /// Evaluate the interaction of the track with a single material
+        /// @param mat at the intersection @param is
+        template <typename material_t, typename surface_t>
+        DETRAY_HOST_DEVICE inline void interact(
+            const material_t &mat,
+            const intersection2D<surface_t, transform3_type> &is, state &s,
+            const scalar qop, const scalar charge) const {
+            if (not s.table.empty()) {
+                const interaction_table_type table(s.table);
+                interact(table, mat, is, s, qop, charge);
+            } else {
+                interact(interaction_type{}, mat, is, s, qop, charge);
+            }
+        }
+
+        /// Evaluate the interaction with the analytic or tabulated
+        /// interaction formulas @param I
+        template <typename interaction_t, typename material_t,
+                  typename surface_t>
+        DETRAY_HOST_DEVICE inline void interact(
+            const interaction_t &I, const material_t &mat,
+            const intersection2D<surface_t, transform3_type> &is, state &s,
+            const scalar qop, const scalar charge) const {
+
+            // Energy Loss
+            if (s.do_energy_loss) {
+                s.e_loss = I.compute_energy_loss_bethe(is, mat, s.pdg, s.mass,
+                                                       qop, charge);
+            }
+
+            // @todo: include the radiative loss (Bremsstrahlung)
+            if (s.do_energy_loss && s.do_covariance_transport) {
+                s.sigma_qop = I.compute_energy_loss_landau_sigma_QOverP(
+                    is, mat, s.pdg, s.mass, qop, charge);
+            }
+
+            // Covariance update
+            if (s.do_multiple_scattering) {
+                // @todo: use momentum before or after energy loss in
+                // backward mode?
+                s.projected_scattering_angle =
+                    I.compute_multiple_scattering_theta0(is, mat, s.pdg,
+                                                         s.mass, qop, charge);
+            }
+        }
     };
 
     template <typename propagator_state_t>
@@ -98,9 +98,33 @@ class base_stepper {
         bound_to_free_matrix _jac_to_global =
             matrix_operator().template zero<e_free_size, e_bound_size>();
 
+        /// Process noise (e.g. from volume material) that was picked up since
+        /// the departure surface: free covariance at the current position
+        free_matrix _free_noise =
+            matrix_operator().template zero<e_free_size, e_free_size>();
+
+        /// Whether there is any process noise to be transported
+        bool _has_free_noise{false};
+
         /// bound covariance
         bound_track_parameters_type _bound_params;
 
+        /// Add process noise @param noise at the current track position
+        DETRAY_HOST_DEVICE
+        inline void add_free_noise(const free_matrix &noise) {
+            _free_noise = _free_noise + noise;
+            _has_free_noise = true;
+        }
+
+        /// Transport the accumulated process noise with the jacobian @param D
+        /// of the last step
+        DETRAY_HOST_DEVICE
+        inline void transport_free_noise(const free_matrix &D) {
+            if (_has_free_noise) {
+                _free_noise = D * _free_noise * matrix_operator().transpose(D);
+            }
+        }
+
         /// @returns track parameters - const access
         DETRAY_HOST_DEVICE
         free_track_parameters_type &operator()() { return _track; }
@@ -127,6 +151,13 @@ class base_stepper {
         /// Current step size
         scalar _step_size{0.};
 
+        /// Number of steps that were taken
+        std::size_t _n_steps{0u};
+
+        /// Number of trial steps that were rejected by the step size control
+        /// (only for adaptive steppers)
+        std::size_t _n_rejected_trials{0u};
+
         /// TODO: Use options?
         /// hypothetical mass of particle (assume pion by default)
         /// scalar _mass = 139.57018 * unit<scalar_type>::MeV;
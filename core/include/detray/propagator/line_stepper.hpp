@@ -76,6 +76,7 @@ class line_stepper final
             /// moment..
 
             this->_jac_transport = D * this->_jac_transport;
+            this->transport_free_noise(D);
         }
     };
 
@@ -110,6 +111,7 @@ class line_stepper final
 
         // Update track state
         stepping.advance_track();
+        ++stepping._n_steps;
 
         // Advance jacobian transport
         stepping.advance_jacobian();
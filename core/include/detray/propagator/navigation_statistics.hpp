@@ -0,0 +1,273 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/propagator/navigator.hpp"
+
+// System include(s)
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace detray {
+
+namespace navigation {
+
+/// Navigation counters that are collected per track
+enum class counter : unsigned int {
+    e_steps = 0u,                   ///< steps taken by the stepper
+    e_rejected_trials = 1u,         ///< rejected adaptive trial steps
+    e_intersections_no_trust = 2u,  ///< intersections during volume init
+    e_intersections_fair = 3u,      ///< intersections in fair trust updates
+    e_intersections_high = 4u,      ///< intersections in high trust updates
+    e_resorts = 5u,                 ///< re-sorts of the candidates cache
+    e_volume_switches = 6u,         ///< volumes entered through a portal
+    e_reinits = 7u,                 ///< initializations after the first one
+    e_aborts = 8u,                  ///< aborted navigation flows
+    e_size = 9u,
+};
+
+/// Names of the navigation counters, e.g. for the output
+constexpr std::array<const char *, static_cast<std::size_t>(counter::e_size)>
+    counter_names{"steps",
+                  "rejected_trials",
+                  "intersections_no_trust",
+                  "intersections_fair_trust",
+                  "intersections_high_trust",
+                  "resorts",
+                  "volume_switches",
+                  "reinitializations",
+                  "aborts"};
+
+/// @brief The navigation counters of a single track
+struct track_statistics {
+
+    darray<unsigned int, static_cast<std::size_t>(counter::e_size)> counts{};
+
+    /// @returns the value of the counter @param c
+    DETRAY_HOST_DEVICE
+    constexpr unsigned int operator[](const counter c) const {
+        return counts[static_cast<std::size_t>(c)];
+    }
+
+    /// @returns access to the value of the counter @param c
+    DETRAY_HOST_DEVICE
+    constexpr unsigned int &operator[](const counter c) {
+        return counts[static_cast<std::size_t>(c)];
+    }
+};
+
+/// @brief A navigation inspector that counts the navigation work per track.
+///
+/// Only keeps a handful of integers and does no output, so that it can run
+/// in production. The intersections are attributed to the trust level of
+/// the cache update that computed them, the other counters to the navigation
+/// call that reports to the inspector, which is classified by the navigation
+/// status and the trust level of the last cache update. Since the stepper
+/// counters are not visible to the navigator, the steps and rejected trial
+/// steps are added by @c navigation_statistics::fill from the stepping
+/// state.
+struct statistics_inspector {
+
+    /// Inspector interface
+    template <typename state_t>
+    DETRAY_HOST_DEVICE void operator()(const state_t &state,
+                                       const char * /*message*/) {
+        // Intersections since the last inspection, counted where they were
+        // computed: a high trust update can fall back to a fair trust update
+        // or a volume initialization before the inspector is called
+        count_intersections(state, trust_level::e_no_trust,
+                            counter::e_intersections_no_trust);
+        count_intersections(state, trust_level::e_fair,
+                            counter::e_intersections_fair);
+        count_intersections(state, trust_level::e_high,
+                            counter::e_intersections_high);
+
+        // Aborted or exited navigation flows do not update the cache
+        if (state.status() == status::e_abort) {
+            ++m_counters[counter::e_aborts];
+        } else if (state.status() != status::e_on_target) {
+            switch (state.update_trust_level()) {
+                case trust_level::e_no_trust:
+                    if (m_initialized) {
+                        ++m_counters[counter::e_reinits];
+                    }
+                    m_initialized = true;
+                    break;
+                case trust_level::e_fair:
+                    ++m_counters[counter::e_resorts];
+                    break;
+                default:
+                    break;
+            };
+        }
+
+        // The world volume is left through an invalid volume link
+        if (state.volume() != m_volume and m_volume != dindex_invalid and
+            state.volume() != dindex_invalid) {
+            ++m_counters[counter::e_volume_switches];
+        }
+        m_volume = state.volume();
+    }
+
+    /// @returns the navigation counters of the track
+    DETRAY_HOST_DEVICE
+    const track_statistics &counters() const { return m_counters; }
+
+    private:
+    /// Add the intersections of trust level @param trust that were computed
+    /// since the last inspection to the counter @param c
+    template <typename state_t>
+    DETRAY_HOST_DEVICE void count_intersections(const state_t &state,
+                                                const trust_level trust,
+                                                const counter c) {
+        const auto i{static_cast<std::size_t>(trust)};
+        const unsigned int n{state.n_intersections(trust)};
+        m_counters[c] += n - m_n_intersections[i];
+        m_n_intersections[i] = n;
+    }
+
+    /// The counters of the track
+    track_statistics m_counters{};
+    /// Number of intersections per trust level at the last inspection
+    darray<unsigned int, 4u> m_n_intersections{};
+    /// Volume at the last inspection
+    dindex m_volume{dindex_invalid};
+    /// Whether the first volume was initialized
+    bool m_initialized{false};
+};
+
+}  // namespace navigation
+
+/// @brief Lock-free aggregation of the navigation counters of many tracks.
+///
+/// Every counter is filled into a histogram with logarithmic bins: bin 0
+/// holds the tracks with a count of zero and bin b > 0 the tracks with a
+/// count in [2^(b-1), 2^b). Additionally, the sum and the maximum of every
+/// counter are kept. All members are atomics that are updated with relaxed
+/// ordering, so that the tracks of different threads can be filled into the
+/// same instance concurrently. The values should only be read once all
+/// threads are done.
+class navigation_statistics {
+
+    public:
+    using counter = navigation::counter;
+
+    /// Number of counters per track
+    static constexpr std::size_t n_counters{
+        static_cast<std::size_t>(counter::e_size)};
+    /// Number of histogram bins (covers all 32 bit values)
+    static constexpr std::size_t n_bins{33u};
+
+    /// Default constructor: all histograms are empty
+    DETRAY_HOST
+    navigation_statistics() { reset(); }
+
+    /// Not copyable, since the values are shared between threads
+    navigation_statistics(const navigation_statistics &) = delete;
+    navigation_statistics &operator=(const navigation_statistics &) = delete;
+
+    /// @returns the histogram bin of the count @param n
+    DETRAY_HOST_DEVICE
+    static constexpr std::size_t bin(unsigned int n) {
+        std::size_t b{0u};
+        while (n != 0u) {
+            n >>= 1u;
+            ++b;
+        }
+        return b;
+    }
+
+    /// Clear all histograms
+    DETRAY_HOST
+    void reset() {
+        m_n_tracks.store(0u, std::memory_order_relaxed);
+        for (std::size_t c = 0u; c < n_counters; ++c) {
+            for (auto &entries : m_histograms[c]) {
+                entries.store(0u, std::memory_order_relaxed);
+            }
+            m_totals[c].store(0u, std::memory_order_relaxed);
+            m_max[c].store(0u, std::memory_order_relaxed);
+        }
+    }
+
+    /// Add the counters of a single track @param track_stats
+    DETRAY_HOST
+    void fill(const navigation::track_statistics &track_stats) {
+        m_n_tracks.fetch_add(1u, std::memory_order_relaxed);
+        for (std::size_t c = 0u; c < n_counters; ++c) {
+            const unsigned int n{track_stats.counts[c]};
+
+            m_histograms[c][bin(n)].fetch_add(1u, std::memory_order_relaxed);
+            m_totals[c].fetch_add(n, std::memory_order_relaxed);
+
+            std::size_t max{m_max[c].load(std::memory_order_relaxed)};
+            while (n > max and not m_max[c].compare_exchange_weak(
+                                   max, n, std::memory_order_relaxed)) {
+            }
+        }
+    }
+
+    /// Add the counters of the track in the propagation state @param prop,
+    /// which has to be navigated with a @c navigation::statistics_inspector
+    template <typename propagation_state_t>
+    DETRAY_HOST void fill(const propagation_state_t &prop) {
+        navigation::track_statistics track_stats{
+            prop._navigation.inspector().counters()};
+
+        track_stats[counter::e_steps] =
+            static_cast<unsigned int>(prop._stepping._n_steps);
+        track_stats[counter::e_rejected_trials] =
+            static_cast<unsigned int>(prop._stepping._n_rejected_trials);
+
+        fill(track_stats);
+    }
+
+    /// @returns the number of tracks that were filled
+    DETRAY_HOST
+    std::size_t n_tracks() const {
+        return m_n_tracks.load(std::memory_order_relaxed);
+    }
+
+    /// @returns the number of tracks in bin @param b of counter @param c
+    DETRAY_HOST
+    std::size_t n_entries(const counter c, const std::size_t b) const {
+        return m_histograms[static_cast<std::size_t>(c)][b].load(
+            std::memory_order_relaxed);
+    }
+
+    /// @returns the sum of counter @param c over all tracks
+    DETRAY_HOST
+    std::size_t total(const counter c) const {
+        return m_totals[static_cast<std::size_t>(c)].load(
+            std::memory_order_relaxed);
+    }
+
+    /// @returns the maximum of counter @param c over all tracks
+    DETRAY_HOST
+    std::size_t max(const counter c) const {
+        return m_max[static_cast<std::size_t>(c)].load(
+            std::memory_order_relaxed);
+    }
+
+    private:
+    /// Number of tracks
+    std::atomic<std::size_t> m_n_tracks;
+    /// Histogram per counter
+    std::array<std::array<std::atomic<std::size_t>, n_bins>, n_counters>
+        m_histograms;
+    /// Sum and maximum per counter
+    std::array<std::atomic<std::size_t>, n_counters> m_totals;
+    std::array<std::atomic<std::size_t>, n_counters> m_max;
+};
+
+}  // namespace detray
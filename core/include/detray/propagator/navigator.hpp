@@ -15,6 +15,7 @@
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/geometry/barcode.hpp"
+#include "detray/intersection/concentric_portal_intersector.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
@@ -25,6 +26,9 @@
 #include <vecmem/containers/data/jagged_vector_buffer.hpp>
 #include <vecmem/memory/memory_resource.hpp>
 
+// System include(s)
+#include <limits>
+
 namespace detray {
 
 namespace navigation {
@@ -63,6 +67,148 @@ struct void_inspector {
 
 }  // namespace navigation
 
+namespace detail {
+
+/// @brief Keeps the @c k closest of the candidates that are pushed into it.
+///
+/// The candidates are stored as a max-heap on the path length in the
+/// candidates cache of the navigator, so that the farthest candidate can be
+/// replaced in O(log k) whenever a closer one is found. Unreachable
+/// candidates are rejected right away. Once all candidates are filled in,
+/// the cache is sorted by a heap sort.
+template <typename candidates_t>
+class top_k_candidates {
+
+    public:
+    using value_type = typename candidates_t::value_type;
+    using scalar_type = typename value_type::scalar_t;
+
+    /// Construct from the @param candidates cache, the maximal number of
+    /// candidates @param k and the @param overstep_tolerance of the track
+    DETRAY_HOST_DEVICE
+    top_k_candidates(candidates_t &candidates, const unsigned int k,
+                     const scalar_type overstep_tolerance)
+        : m_candidates{candidates},
+          m_k{k},
+          m_overstep_tol{overstep_tolerance} {}
+
+    /// Add the candidate @param c, if it is reachable and among the @c k
+    /// closest ones
+    DETRAY_HOST_DEVICE
+    void push_back(const value_type &c) {
+        if (c.status != intersection::status::e_inside or
+            not(c.path < std::numeric_limits<scalar_type>::max()) or
+            c.path < m_overstep_tol) {
+            return;
+        }
+        if (m_candidates.size() < m_k) {
+            m_candidates.push_back(c);
+            sift_up(m_candidates.size() - 1u);
+        } else if (c < m_candidates[0]) {
+            m_candidates[0] = c;
+            sift_down(0u, m_candidates.size());
+        }
+    }
+
+    /// Sort the candidates by path length in ascending order
+    DETRAY_HOST_DEVICE
+    void sort() {
+        for (std::size_t n = m_candidates.size(); n > 1u; --n) {
+            swap(0u, n - 1u);
+            sift_down(0u, n - 1u);
+        }
+    }
+
+    private:
+    /// Move the element at @param i up until the heap property holds
+    DETRAY_HOST_DEVICE
+    void sift_up(std::size_t i) {
+        while (i > 0u) {
+            const std::size_t parent{(i - 1u) / 2u};
+            if (not(m_candidates[parent] < m_candidates[i])) {
+                return;
+            }
+            swap(parent, i);
+            i = parent;
+        }
+    }
+
+    /// Move the element at @param i down in the heap of size @param n
+    DETRAY_HOST_DEVICE
+    void sift_down(std::size_t i, const std::size_t n) {
+        for (std::size_t child{2u * i + 1u}; child < n;
+             child = 2u * i + 1u) {
+            if (child + 1u < n and
+                m_candidates[child] < m_candidates[child + 1u]) {
+                ++child;
+            }
+            if (not(m_candidates[i] < m_candidates[child])) {
+                return;
+            }
+            swap(i, child);
+            i = child;
+        }
+    }
+
+    DETRAY_HOST_DEVICE
+    void swap(const std::size_t i, const std::size_t j) {
+        const value_type tmp{m_candidates[i]};
+        m_candidates[i] = m_candidates[j];
+        m_candidates[j] = tmp;
+    }
+
+    /// The candidates cache
+    candidates_t &m_candidates;
+    /// Maximal number of candidates
+    unsigned int m_k;
+    /// Candidates below this path length are not reachable
+    scalar_type m_overstep_tol;
+};
+
+/// @brief Gathers surfaces that share a mask type, so that they can be
+/// intersected with a single dispatch on the mask type.
+template <typename surface_t, std::size_t N>
+struct surface_batch {
+
+    /// Maximal number of surfaces in the batch
+    static constexpr std::size_t capacity{N};
+
+    darray<surface_t, N> surfaces{};
+    /// Number of surfaces in the batch
+    std::size_t n{0u};
+
+    /// @returns the surface range of the batch
+    /// @{
+    DETRAY_HOST_DEVICE
+    constexpr const surface_t *begin() const { return &surfaces[0]; }
+    DETRAY_HOST_DEVICE
+    constexpr const surface_t *end() const { return &surfaces[0] + n; }
+    /// @}
+
+    /// @returns the mask type of the surfaces in the batch
+    DETRAY_HOST_DEVICE
+    constexpr auto mask_id() const {
+        return detail::get<0>(surfaces[0].mask());
+    }
+
+    /// @returns true if the surface @param sf cannot be added to the batch
+    DETRAY_HOST_DEVICE
+    constexpr bool rejects(const surface_t &sf) const {
+        return n == N or (n > 0u and detail::get<0>(sf.mask()) != mask_id());
+    }
+
+    DETRAY_HOST_DEVICE
+    constexpr bool empty() const { return n == 0u; }
+
+    DETRAY_HOST_DEVICE
+    constexpr void push_back(const surface_t &sf) { surfaces[n++] = sf; }
+
+    DETRAY_HOST_DEVICE
+    constexpr void clear() { n = 0u; }
+};
+
+}  // namespace detail
+
 /// The geometry navigation class.
 ///
 /// The navigator is initialized around a detector object, but is itself
@@ -122,6 +268,7 @@ class navigator {
         // Allow the filling/updateing of candidates
         friend struct intersection_initialize;
         friend struct intersection_update;
+        friend struct intersection_path_update;
 
         using candidate_itr_t =
             typename vector_type<intersection_type>::iterator;
@@ -208,6 +355,35 @@ class navigator {
         DETRAY_HOST
         inline auto &inspector() { return _inspector; }
 
+        /// @returns the navigation inspector - const
+        DETRAY_HOST
+        inline const auto &inspector() const { return _inspector; }
+
+        /// @returns the number of surface intersections the navigator has
+        /// computed for this track so far
+        DETRAY_HOST_DEVICE
+        inline auto n_intersections() const -> unsigned int {
+            return _n_intersections;
+        }
+
+        /// @returns the number of surface intersections the navigator has
+        /// computed for this track so far in cache updates with the trust
+        /// level @param trust (no trust for volume initializations)
+        DETRAY_HOST_DEVICE
+        inline auto n_intersections(const navigation::trust_level trust) const
+            -> unsigned int {
+            switch (trust) {
+                case navigation::trust_level::e_no_trust:
+                    return _n_intersections_no_trust;
+                case navigation::trust_level::e_fair:
+                    return _n_intersections_fair;
+                case navigation::trust_level::e_high:
+                    return _n_intersections_high;
+                default:
+                    return 0u;
+            };
+        }
+
         /// @returns current volume (index) - const
         DETRAY_HOST_DEVICE
         inline auto volume() const -> dindex { return _volume_index; }
@@ -263,6 +439,13 @@ class navigator {
             return _trust_level;
         }
 
+        /// @returns the trust level the candidates cache was last updated
+        /// with (no trust for a volume initialization) - const
+        DETRAY_HOST_DEVICE
+        inline auto update_trust_level() const -> navigation::trust_level {
+            return _update_trust_level;
+        }
+
         /// Update navigation trust level to no trust
         DETRAY_HOST_DEVICE
         inline void set_no_trust() {
@@ -427,6 +610,26 @@ class navigator {
             _status = status;
         }
 
+        /// Count @param n surface intersections towards the cache update
+        /// that is currently running
+        DETRAY_HOST_DEVICE
+        constexpr void count_intersections(const unsigned int n = 1u) {
+            _n_intersections += n;
+            switch (_update_trust_level) {
+                case navigation::trust_level::e_no_trust:
+                    _n_intersections_no_trust += n;
+                    break;
+                case navigation::trust_level::e_fair:
+                    _n_intersections_fair += n;
+                    break;
+                case navigation::trust_level::e_high:
+                    _n_intersections_high += n;
+                    break;
+                default:
+                    break;
+            };
+        }
+
         /// Heartbeat of this navigation flow signals navigation is alive
         bool _heartbeat = false;
 
@@ -462,8 +665,23 @@ class navigator {
         navigation::trust_level _trust_level =
             navigation::trust_level::e_no_trust;
 
+        /// The trust level of the last update of the candidates cache
+        navigation::trust_level _update_trust_level =
+            navigation::trust_level::e_no_trust;
+
         /// Index in the detector volume container of current navigation volume
         dindex _volume_index{0u};
+
+        /// Path length of the track when the safeties of the candidates were
+        /// last computed
+        scalar_type _safety_path_length{0.f};
+
+        /// Number of surface intersections that were computed, in total and
+        /// per trust level of the cache update they were computed in
+        unsigned int _n_intersections{0u};
+        unsigned int _n_intersections_no_trust{0u};
+        unsigned int _n_intersections_fair{0u};
+        unsigned int _n_intersections_high{0u};
     };
 
     /// Helper method to initialize a volume.
@@ -479,24 +697,14 @@ class navigator {
     DETRAY_HOST_DEVICE inline bool init(propagator_state_t &propagation) const {
 
         state &navigation = propagation._navigation;
-        const auto det = navigation.detector();
         const auto &track = propagation._stepping();
-        const auto &volume = det->volume_by_index(navigation.volume());
 
         // Clean up state
         navigation.clear();
         navigation._heartbeat = true;
-        // Get the max number of candidates & run them through the kernel
-        // detail::call_reserve(navigation.candidates(), volume.n_objects());
-        // @TODO: switch to fixed size buffer
-        detail::call_reserve(navigation.candidates(), 20u);
-
-        // Search for neighboring surfaces and fill candidates into cache
-        fill_candidates(det, volume, track, navigation.candidates());
-
-        // Sort all candidates and pick the closest one
-        detail::sequential_sort(navigation.candidates().begin(),
-                                navigation.candidates().end());
+        navigation._update_trust_level = navigation::trust_level::e_no_trust;
+        // Run the surfaces of the volume through the kernel
+        fill_cache(propagation);
 
         navigation.set_next(navigation.candidates().begin());
         // No unreachable candidates in cache after local navigation
@@ -517,6 +725,86 @@ class navigator {
         return navigation._heartbeat;
     }
 
+    /// Helper method that fills the cleared candidates cache with the
+    /// surfaces of the current volume that the track can reach, sorted by
+    /// distance. Only the closest candidates are kept, if the detector is
+    /// configured to do so.
+    ///
+    /// @param propagation contains the stepper and navigator states
+    /// @param excluded surface that is not added to the cache
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void fill_cache(
+        propagator_state_t &propagation,
+        const geometry::barcode excluded = {}) const {
+
+        state &navigation = propagation._navigation;
+        const auto det = navigation.detector();
+        const auto &track = propagation._stepping();
+        const auto &volume = det->volume_by_index(navigation.volume());
+
+        // Get the max number of candidates & run them through the kernel
+        const unsigned int n_max{
+            det->navigation_info(volume.index()).n_max_candidates()};
+        const unsigned int k{det->n_top_candidates()};
+
+        if (k == 0u) {
+            detail::call_reserve(navigation.candidates(), n_max);
+
+            // Search for neighboring surfaces and fill candidates into cache
+            navigation.count_intersections(fill_candidates(
+                det, volume, track, navigation.candidates(), excluded));
+
+            // Sort all candidates and pick the closest one
+            detail::sequential_sort(navigation.candidates().begin(),
+                                    navigation.candidates().end());
+        } else {
+            // Leave room for a candidate that is carried over
+            detail::call_reserve(navigation.candidates(),
+                                 (k < n_max ? k : n_max) + 1u);
+
+            // Keep only the k closest candidates while filling the cache
+            detail::top_k_candidates top_k(navigation.candidates(), k,
+                                           track.overstep_tolerance());
+            navigation.count_intersections(
+                fill_candidates(det, volume, track, top_k, excluded));
+            top_k.sort();
+        }
+
+        // Distance the track can move before a candidate needs an update
+        navigation._safety_path_length = propagation._stepping.path_length();
+        for (auto &candidate : navigation.candidates()) {
+            update_safety(candidate, track, det);
+        }
+    }
+
+    /// Helper method that refills the candidates cache of the current volume
+    /// when the track reached the last candidate on a module, e.g. because
+    /// only the closest candidates are cached. The module is carried over as
+    /// the current candidate, so that it is not reached a second time.
+    ///
+    /// @param propagation contains the stepper and navigator states
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void refill_cache(
+        propagator_state_t &propagation) const {
+
+        state &navigation = propagation._navigation;
+        const intersection_type reached{*navigation.current()};
+
+        navigation.clear();
+        fill_cache(propagation, reached.surface.barcode());
+
+        // Put the module in front of the new candidates
+        auto &candidates = navigation.candidates();
+        candidates.push_back(reached);
+        for (std::size_t i = candidates.size() - 1u; i > 0u; --i) {
+            candidates[i] = candidates[i - 1u];
+        }
+        candidates[0] = reached;
+
+        navigation.set_next(candidates.begin() + 1);
+        navigation.set_last(candidates.end());
+    }
+
     /// Complete update of the nvaigation flow.
     ///
     /// Restores 'full trust' state to the cadidates cache and checks whether
@@ -599,7 +887,10 @@ class navigator {
         if (navigation.trust_level() == navigation::trust_level::e_high or
             navigation.n_candidates() == 1) {
 
+            navigation._update_trust_level = navigation::trust_level::e_high;
+
             // Update next candidate: If not reachable, 'high trust' is broken
+            navigation.count_intersections();
             if (not update_candidate(*navigation.next(), track, det)) {
                 navigation.set_state(navigation::status::e_unknown,
                                      geometry::barcode{},
@@ -626,6 +917,7 @@ class navigator {
 
             // Else: Track is on module.
             // Ready the next candidate after the current module
+            navigation.count_intersections();
             if (update_candidate(*navigation.next(), track, det)) {
                 return;
             }
@@ -640,12 +932,63 @@ class navigator {
         // - do this when your navigation state is stale, but not invalid
         if (navigation.trust_level() == navigation::trust_level::e_fair) {
 
-            for (auto &candidate : navigation) {
-                // Disregard this candidate if it is not reachable
-                if (not update_candidate(candidate, track, det)) {
-                    // Forcefully set dist to numeric max for sorting
-                    candidate.path = std::numeric_limits<scalar_type>::max();
+            navigation._update_trust_level = navigation::trust_level::e_fair;
+
+            // Path length the track moved since the safeties were computed
+            const scalar_type ds{propagation._stepping.path_length() -
+                                 navigation._safety_path_length};
+            navigation._safety_path_length =
+                propagation._stepping.path_length();
+
+            // Only update the candidates that might have been reached and
+            // gather them at the front, move the others along by the step
+            scalar_type min_path{std::numeric_limits<scalar_type>::max()};
+            auto first_skipped = navigation.begin();
+            auto closest_skipped = navigation.end();
+            for (auto itr = navigation.begin(); itr != navigation.end();
+                 ++itr) {
+                itr->safety -= std::abs(ds);
+                if (itr->safety > navigation.tolerance()) {
+                    itr->path -= ds;
+                    if (closest_skipped == navigation.end() or
+                        *itr < *closest_skipped) {
+                        closest_skipped = itr;
+                    }
+                    continue;
                 }
+                const scalar_type path{refresh_candidate(*itr, track, det)};
+                navigation.count_intersections();
+                update_safety(*itr, track, det);
+                min_path = path < min_path ? path : min_path;
+                // Swap with the first skipped candidate (the closest skipped
+                // candidate is only needed if nothing was swapped)
+                const intersection_type updated{*itr};
+                *itr = *first_skipped;
+                *first_skipped = updated;
+                ++first_skipped;
+            }
+            // Make sure there is an updated candidate to compare against
+            if (first_skipped == navigation.begin() and
+                closest_skipped != navigation.end()) {
+                min_path = refresh_candidate(*closest_skipped, track, det);
+                navigation.count_intersections();
+                update_safety(*closest_skipped, track, det);
+                const intersection_type updated{*closest_skipped};
+                *closest_skipped = *first_skipped;
+                *first_skipped = updated;
+                ++first_skipped;
+            }
+            // A skipped candidate that might be closer than the closest
+            // updated one has to be updated, too. All other skipped
+            // candidates keep their decremented safety
+            for (auto itr = first_skipped; itr != navigation.end(); ++itr) {
+                if (itr->safety >= min_path) {
+                    continue;
+                }
+                const scalar_type path{refresh_candidate(*itr, track, det)};
+                navigation.count_intersections();
+                update_safety(*itr, track, det);
+                min_path = path < min_path ? path : min_path;
             }
             // Sort again
             detail::sequential_sort(navigation.begin(), navigation.end());
@@ -695,6 +1038,14 @@ class navigator {
         // portal, in which case the navigation becomes exhausted (the
         // exit-portal is the last reachable surface in every volume)
         if (navigation.is_on_object(*navigation.next(), track)) {
+            // Only the path of the candidate might be up to date: Complete
+            // the intersection data of the surface that was reached
+            intersection_type reached{*navigation.next()};
+            navigation.count_intersections();
+            if (update_candidate<false>(reached, track,
+                                        navigation.detector())) {
+                *navigation.next() = reached;
+            }
             // Set the next object that we want to reach (this function is only
             // called once the cache has been updated to a full trust state).
             // Might lead to exhausted cache.
@@ -712,6 +1063,11 @@ class navigator {
                                  geometry::barcode{},
                                  navigation::trust_level::e_full);
         }
+        // The track reached the last cached candidate, but there are more
+        // surfaces in the volume: continue from the module
+        if (navigation.is_exhausted() and navigation.is_on_module()) {
+            refill_cache(propagation);
+        }
         // Generally happens when after an update no next candidate in the
         // cache is reachable anymore -> triggers init of [new] volume
         if (navigation.is_exhausted()) {
@@ -722,13 +1078,15 @@ class navigator {
     /// Helper method that updates the intersection of a single candidate and
     /// checks reachability
     ///
+    /// @tparam path_only only update the path and status of the candidate,
+    ///                   which is sufficient to sort the candidates
     /// @tparam track_t type of the track parametrization
     ///
     /// @param candidate the intersection to be updated
     /// @param track the track information
     ///
     /// @returns whether the track can reach this candidate.
-    template <typename track_t>
+    template <bool path_only = true, typename track_t>
     DETRAY_HOST_DEVICE inline bool update_candidate(
         intersection_type &candidate, const track_t &track,
         const detector_type *det) const {
@@ -739,9 +1097,57 @@ class navigator {
         const auto &mask_store = det->mask_store();
 
         // Check whether this candidate is reachable by the track
-        return mask_store.template visit<intersection_update>(
-            candidate.surface.mask(), detail::ray(track), candidate,
-            det->transform_store(), 1.f * unit<scalar_type>::um);
+        if constexpr (path_only) {
+            return mask_store.template visit<intersection_path_update>(
+                candidate.surface.mask(), detail::ray(track), candidate,
+                det->transform_store(), 1.f * unit<scalar_type>::um);
+        } else {
+            return mask_store.template visit<intersection_update>(
+                candidate.surface.mask(), detail::ray(track), candidate,
+                det->transform_store(), 1.f * unit<scalar_type>::um);
+        }
+    }
+
+    /// Helper method that updates a candidate and invalidates it, if the
+    /// track cannot reach it
+    ///
+    /// @returns the absolute path to the candidate (numeric max if it is not
+    /// reachable)
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline scalar_type refresh_candidate(
+        intersection_type &candidate, const track_t &track,
+        const detector_type *det) const {
+
+        if (not update_candidate(candidate, track, det)) {
+            // Forcefully set dist to numeric max for sorting
+            candidate.path = std::numeric_limits<scalar_type>::max();
+        }
+        return std::abs(candidate.path);
+    }
+
+    /// Helper method that computes the distance the track can at least move
+    /// before it might reach the surface of a candidate
+    ///
+    /// @param candidate the intersection to be updated
+    /// @param track the track information
+    /// @param det the tracking geometry
+    template <typename track_t>
+    DETRAY_HOST_DEVICE inline void update_safety(
+        intersection_type &candidate, const track_t &track,
+        const detector_type *det) const {
+        constexpr scalar_type mask_tol{1.f * unit<scalar_type>::um};
+        const auto &sf = candidate.surface;
+
+        // Distance to the bounding sphere and to the surface shape
+        const scalar_type sphere_safety{
+            det->bounding_sphere(sf).safety(track.pos(), mask_tol)};
+        const scalar_type shape_safety{
+            det->mask_store().template visit<surface_safety>(
+                sf.mask(), track.pos(), sf, det->transform_store()) -
+            mask_tol};
+
+        candidate.safety =
+            sphere_safety > shape_safety ? sphere_safety : shape_safety;
     }
 
     /// @brief Fill the candidates cache from scratch.
@@ -756,31 +1162,75 @@ class navigator {
     /// @param det the tracking geometry
     /// @param volume the search volume (current nvaigation volume)
     /// @param track the track information
-    /// @param candidates the navigation cache to be filled with the
-    ///                   track-surface intersections
+    /// @param candidates the navigation cache (or a view that selects from
+    ///                   it) to be filled with the track-surface intersections
+    /// @param excluded surface that is not added to the candidates
+    ///
+    /// @returns the number of surfaces that were intersected
     template <int I = static_cast<int>(volume_type::object_id::e_size) - 1,
-              typename track_t>
-    DETRAY_HOST_DEVICE inline void fill_candidates(
+              typename track_t, typename candidates_t>
+    DETRAY_HOST_DEVICE inline unsigned int fill_candidates(
         const detector_type *det, const volume_type &volume,
-        const track_t &track,
-        vector_type<intersection_type> &candidates) const {
+        const track_t &track, candidates_t &candidates,
+        const geometry::barcode excluded = {}) const {
         const auto &surfaces = det->surface_store();
         const auto &link{volume.template link<
             static_cast<typename volume_type::object_id>(I)>()};
+        unsigned int n_intersected{0u};
 
         // Only run the query, if object type is contained in volume
         if (detail::get<1>(link) != dindex_invalid) {
+            constexpr scalar_type mask_tol{1.f * unit<scalar_type>::um};
+            using transform3_t = typename detector_type::transform3;
+
+            const detail::ray<transform3_t> tangent(track);
+            // Portals share the transverse coefficients of the ray
+            const concentric_portal_intersector<transform3_t> portal_intr(
+                tangent);
+
+            // Surfaces are grouped by mask type in the volume: Gather them
+            // and dispatch on the mask type only once per batch
+            detail::surface_batch<typename detector_type::surface_type, 16u>
+                batch{};
+            auto intersect_batch = [&]() {
+                det->mask_store().template visit<intersection_initialize>(
+                    batch.mask_id(), batch, candidates, tangent,
+                    det->transform_store(), mask_tol);
+                batch.clear();
+            };
+
             for (const auto &sf : surfaces.template visit<neighborhood_getter>(
                      link, *det, volume, track)) {
 
-                det->mask_store().template visit<intersection_initialize>(
-                    sf.mask(), candidates, detail::ray(track), sf,
-                    det->transform_store(), 1.f * unit<scalar_type>::um);
+                // Cheap rejection of surfaces that are far from the track
+                if (sf.barcode() == excluded or
+                    not det->bounding_sphere(sf).is_reachable(tangent,
+                                                              mask_tol)) {
+                    continue;
+                }
+                ++n_intersected;
+                if (sf.is_portal()) {
+                    det->mask_store()
+                        .template visit<portal_intersection_initialize>(
+                            sf.mask(), candidates, portal_intr, sf,
+                            det->transform_store(), mask_tol);
+                    continue;
+                }
+                if (batch.rejects(sf)) {
+                    intersect_batch();
+                }
+                batch.push_back(sf);
+            }
+            if (not batch.empty()) {
+                intersect_batch();
             }
         }
         // Check the next surface type
         if constexpr (I > 0) {
-            return fill_candidates<I - 1>(det, volume, track, candidates);
+            return n_intersected + fill_candidates<I - 1>(det, volume, track,
+                                                          candidates, excluded);
+        } else {
+            return n_intersected;
         }
     }
 
@@ -801,10 +1251,27 @@ class navigator {
     }
 };
 
-/// @return the vecmem jagged vector buffer for surface candidates
-// TODO: det.get_n_max_objects_per_volume() is way too many for
-// candidates size allocation. With the local navigation, the size can be
-// restricted to much smaller value
+/// @returns the number of candidates the navigation cache of a single track
+/// needs to hold: The largest candidate count of any volume in the detector
+/// navigation metadata, where every surface finder contributes at most
+/// @c detector_t::max_candidates_per_finder candidates. If the navigator keeps
+/// only the k closest candidates, it holds at most k of them, plus the module
+/// that is carried over when the cache is refilled.
+template <typename detector_t>
+DETRAY_HOST inline std::size_t candidates_capacity(const detector_t &det) {
+    const std::size_t k{det.n_top_candidates()};
+
+    if (k == 0u) {
+        return det.n_max_candidates();
+    }
+    const std::size_t n_max{
+        det.n_max_candidates(std::numeric_limits<unsigned int>::max())};
+
+    return (k < n_max ? k : n_max) + 1u;
+}
+
+/// @return the vecmem jagged vector buffer for surface candidates. Every
+/// track gets the capacity given by @c candidates_capacity
 template <typename detector_t>
 DETRAY_HOST vecmem::data::jagged_vector_buffer<intersection2D<
     typename detector_t::surface_type, typename detector_t::transform3>>
@@ -812,10 +1279,11 @@ create_candidates_buffer(
     const detector_t &det, const std::size_t n_tracks,
     vecmem::memory_resource &device_resource,
     vecmem::memory_resource *host_access_resource = nullptr) {
+    const std::size_t n_candidates{candidates_capacity(det)};
     // Build the buffer from capacities, device and host accessible resources
     return vecmem::data::jagged_vector_buffer<intersection2D<
         typename detector_t::surface_type, typename detector_t::transform3>>(
-        std::vector<std::size_t>(n_tracks, det.n_max_candidates()),
+        std::vector<std::size_t>(n_tracks, n_candidates),
         device_resource, host_access_resource,
         vecmem::data::buffer_type::resizable);
 }
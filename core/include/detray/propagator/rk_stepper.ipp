@@ -130,6 +130,7 @@ void detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
     /// h * mass * mass * qop * getter::perp(vector2{1, mass / p});
 
     this->_jac_transport = D * this->_jac_transport;
+    this->transport_free_noise(D);
 }
 
 template <typename magnetic_field_t, typename transform3_t,
@@ -227,6 +228,7 @@ bool detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
 
     // Adjust initial step size to integration error
     while (!try_rk4(stepping._step_size)) {
+        ++stepping._n_rejected_trials;
 
         step_size_scaling = std::min(
             std::max(0.25f * unit<scalar>::mm,
@@ -269,6 +271,7 @@ bool detray::rk_stepper<magnetic_field_t, transform3_t, constraint_t, policy_t,
 
     // Advance track state
     stepping.advance_track();
+    ++stepping._n_steps;
 
     // Advance jacobian transport
     stepping.advance_jacobian();
@@ -0,0 +1,162 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s).
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/definitions/track_parametrization.hpp"
+#include "detray/definitions/units.hpp"
+#include "detray/intersection/intersection.hpp"
+#include "detray/materials/interaction.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/propagator/base_actor.hpp"
+#include "detray/propagator/navigation_policies.hpp"
+
+// System include(s)
+#include <cmath>
+#include <type_traits>
+
+namespace detray {
+
+/// Stepper policy that applies the homogeneous material of the current volume
+/// continuously along the track.
+///
+/// After every step, the material that the step traversed is treated like a
+/// slab with the thickness of the step length: The mean energy loss is
+/// removed from the track momentum and the variances of the energy loss and
+/// of the multiple scattering angle are added to the stepper as process
+/// noise in free coordinates at the end of the step. The noise is then
+/// transported with the jacobians of the remaining steps only and added to
+/// the bound covariance at the next surface. This way, volumes that are
+/// filled with material (e.g. gas detectors) do not need to be modelled by
+/// many material surfaces. The navigation trust level is then set by the
+/// wrapped policy.
+///
+/// @tparam nav_policy_t the navigation policy that sets the trust level
+template <typename nav_policy_t = stepper_default_policy>
+struct stepper_volume_material_policy : actor {
+
+    struct state : public nav_policy_t::state {
+        /// The particle mass
+        scalar mass{105.7f * unit<scalar>::MeV};
+        /// The particle pdg
+        int pdg = 13;  // default muon
+
+        /// Accumulated mean energy loss
+        scalar e_loss{0.f};
+        /// Accumulated variance of the projected scattering angle
+        scalar scattering_variance{0.f};
+        /// Accumulated variance of q over p
+        scalar qop_variance{0.f};
+
+        bool do_covariance_transport = true;
+        bool do_energy_loss = true;
+        bool do_multiple_scattering = true;
+    };
+
+    /// Applies the volume material for the last step and then sets the
+    /// navigation trust level
+    ///
+    /// @param pol_state the accumulated material effects
+    /// @param propagation state of the propagation
+    template <typename propagator_state_t>
+    DETRAY_HOST_DEVICE inline void operator()(
+        state &pol_state, propagator_state_t &propagation) const {
+
+        nav_policy_t{}(pol_state, propagation);
+
+        auto &stepping = propagation._stepping;
+        const auto &navigation = propagation._navigation;
+
+        using detector_t = std::remove_cv_t<
+            std::remove_pointer_t<decltype(navigation.detector())>>;
+        using scalar_t = typename detector_t::scalar_type;
+        using transform3_t = typename detector_t::transform3;
+        using matrix_operator = typename transform3_t::matrix_actor;
+        using free_matrix = typename matrix_operator::template matrix_type<
+            e_free_size, e_free_size>;
+        using interaction_t = interaction<scalar_t>;
+
+        const scalar_t charge{stepping().charge()};
+        const material_slab<scalar_t> vol_slab(
+            navigation.detector()->volume_material(navigation.volume()),
+            std::abs(stepping.step_size()));
+
+        // Vacuum, zero step or neutral particle: Nothing to do
+        if (not vol_slab or charge == 0.f) {
+            return;
+        }
+
+        // The slab is traversed along the step
+        intersection2D<typename detector_t::surface_type, transform3_t> is{};
+        is.cos_incidence_angle = 1.f;
+
+        const scalar_t qop{stepping().qop()};
+        const scalar_t sign{
+            stepping.direction() == step::direction::e_forward ? 1.f : -1.f};
+
+        // Process noise of this step at the current track position
+        free_matrix noise =
+            matrix_operator().template zero<e_free_size, e_free_size>();
+
+        if (pol_state.do_energy_loss) {
+            const scalar_t e_loss{interaction_t().compute_energy_loss_bethe(
+                is, vol_slab, pol_state.pdg, pol_state.mass, qop, charge)};
+            pol_state.e_loss += e_loss;
+
+            // Remove the energy loss from the track (add it when propagating
+            // backwards)
+            const scalar_t p{stepping().p()};
+            const scalar_t m{pol_state.mass};
+            const scalar_t next_e{std::sqrt(m * m + p * p) - sign * e_loss};
+            // Put particle at rest if energy loss is too large
+            const scalar_t next_p{
+                (m < next_e) ? std::sqrt(next_e * next_e - m * m) : 0.f};
+            stepping().set_qop(charge / next_p);
+
+            if (pol_state.do_covariance_transport) {
+                const scalar_t sigma_qop{
+                    interaction_t().compute_energy_loss_landau_sigma_QOverP(
+                        is, vol_slab, pol_state.pdg, pol_state.mass, qop,
+                        charge)};
+                const scalar_t var_qop{sign * sigma_qop * sigma_qop};
+                pol_state.qop_variance += var_qop;
+
+                matrix_operator().element(noise, e_free_qoverp,
+                                          e_free_qoverp) = var_qop;
+            }
+        }
+
+        if (pol_state.do_multiple_scattering) {
+            const scalar_t theta0{
+                interaction_t().compute_multiple_scattering_theta0(
+                    is, vol_slab, pol_state.pdg, pol_state.mass, qop, charge)};
+            const scalar_t var_theta{sign * theta0 * theta0};
+            pol_state.scattering_variance += var_theta;
+
+            // Same variance in both directions transverse to the track
+            if (pol_state.do_covariance_transport) {
+                const auto dir = stepping().dir();
+                for (unsigned int i = 0u; i < 3u; ++i) {
+                    for (unsigned int j = 0u; j < 3u; ++j) {
+                        const scalar_t delta{i == j ? 1.f : 0.f};
+                        matrix_operator().element(noise, e_free_dir0 + i,
+                                                  e_free_dir0 + j) =
+                            var_theta * (delta - dir[i] * dir[j]);
+                    }
+                }
+            }
+        }
+
+        if (pol_state.do_covariance_transport) {
+            stepping.add_free_noise(noise);
+        }
+    }
+};
+
+}  // namespace detray
@@ -70,6 +70,13 @@ class brute_force_collection {
             -> unsigned int {
             return static_cast<unsigned int>(this->size());
         }
+
+        /// @return the typical number of surface candidates during a
+        /// neighborhood lookup: all surfaces are always returned
+        DETRAY_HOST_DEVICE constexpr auto n_typical_candidates() const
+            -> unsigned int {
+            return n_max_candidates();
+        }
     };
 
     using value_type = brute_forcer;
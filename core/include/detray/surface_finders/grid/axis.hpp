@@ -26,6 +26,9 @@
 
 namespace detray::n_axis {
 
+/// Number of values that are binned together in a batched bin lookup
+inline constexpr std::size_t batch_size{64u};
+
 /// @brief A single axis.
 ///
 /// An axis ties bounds and binning behaviour with the bin edges storage.
@@ -112,6 +115,40 @@ struct single_axis {
         return m_bounds.map(m_binning.bin(v), m_binning.nbins());
     }
 
+    /// Given a value on the axis, find the correct bin, starting the search
+    /// at a guess for the number of lower bin edges below the value.
+    ///
+    /// @note only available for irregular binning
+    ///
+    /// @param v is the value for the bin search
+    /// @param edge_hint the guess for the position of the value
+    ///
+    /// @returns the bin index.
+    DETRAY_HOST_DEVICE
+    inline dindex bin(const scalar_type v, const dindex edge_hint) const {
+        return m_bounds.map(m_binning.bin(v, edge_hint), m_binning.nbins());
+    }
+
+    /// Given a batch of values on the axis, find the correct bins.
+    ///
+    /// @param values the values for the bin search
+    /// @param n the number of values
+    /// @param bin_indices the resulting bin indices
+    DETRAY_HOST_DEVICE
+    inline void bins(const scalar_type *values, const std::size_t n,
+                     dindex *bin_indices) const {
+        const std::size_t n_bins{m_binning.nbins()};
+        int ibins[batch_size];
+        for (std::size_t first = 0u; first < n; first += batch_size) {
+            const std::size_t n_batch{
+                n - first < batch_size ? n - first : batch_size};
+            m_binning.bins(values + first, n_batch, ibins);
+            for (std::size_t i = 0u; i < n_batch; ++i) {
+                bin_indices[first + i] = m_bounds.map(ibins[i], n_bins);
+            }
+        }
+    }
+
     /// Given a value on the axis and a neighborhood, find the correct bin range
     ///
     /// @param v is the value for the bin search
@@ -303,6 +340,29 @@ class multi_axis {
         return bin_indices;
     }
 
+    /// Query the bin indices for a batch of points on the axes.
+    ///
+    /// The points are processed in batches of @c batch_size, which are
+    /// transposed into one array of coordinates per axis first.
+    ///
+    /// @tparam point_t the point in the local coordinate system that is spanned
+    ///                 by the axes.
+    ///
+    /// @param points the points to be looked up
+    /// @param n the number of points
+    /// @param bin_indices the resulting multi bins, one per point
+    template <typename point_t>
+    DETRAY_HOST_DEVICE void bins(const point_t *points, const std::size_t n,
+                                 multi_bin<Dim> *bin_indices) const {
+        for (std::size_t first = 0u; first < n; first += batch_size) {
+            const std::size_t n_batch{
+                n - first < batch_size ? n - first : batch_size};
+            (single_axis(get_axis<axis_ts>(), points + first, n_batch,
+                         bin_indices + first),
+             ...);
+        }
+    }
+
     /// @brief Get a bin range on every axis corresponding to the given point
     /// and the neighborhood around it.
     ///
@@ -330,6 +390,31 @@ class multi_axis {
         return bin_ranges;
     }
 
+    /// @brief Get a bin range on every axis corresponding to the given point
+    /// and a separate neighborhood on every axis.
+    ///
+    /// @param p the point in the local coordinate system of the axes
+    /// @param nhood the neighborhood for every axis in the corresponding entry
+    ///              (e.g. nhood_x in entry 0)
+    ///
+    /// @returns a multi bin range that contains the resulting bin ranges for
+    ///          every axis in the corresponding entry (e.g. rng_x in entry 0)
+    template <typename point_t, typename neighbor_t>
+    DETRAY_HOST_DEVICE multi_bin_range<Dim> bin_ranges(
+        const point_t &p,
+        const std::array<std::array<neighbor_t, 2>, Dim> &nhood) const {
+        // Empty bin ranges to be filled
+        multi_bin_range<Dim> bin_ranges{};
+        // Run the range resolution for every axis in this multi-axis type
+        (single_axis(
+             get_axis<axis_ts>(), p,
+             nhood[axis_reg::to_index(axis_ts::bounds_type::label)],
+             bin_ranges),
+         ...);
+
+        return bin_ranges;
+    }
+
     /// @returns a vecmem view on the axes data. Only allowed if it owning data.
     template <bool owner = is_owning, std::enable_if_t<owner, bool> = true>
     DETRAY_HOST auto get_data() -> view_type {
@@ -380,6 +465,36 @@ class multi_axis {
         bin_indices.indices[loc_idx] = ax.bin(p[loc_idx]);
     }
 
+    /// Perform the bin lookup for a batch of points on a particular axis
+    ///
+    /// @tparam axis_t defines the axis for the lookup (axis types are unique)
+    /// @tparam point_t is the point type in the axes local coordinates.
+    ///
+    /// @param ax the axis that performs the lookup
+    /// @param points the points to be looked up on the axis
+    /// @param n the number of points (at most @c batch_size)
+    /// @param bin_indices the multi-bin objects that are filled with the
+    ///                    results
+    template <typename axis_t, typename point_t>
+    DETRAY_HOST_DEVICE void single_axis(const axis_t &ax,
+                                        const point_t *points,
+                                        const std::size_t n,
+                                        multi_bin<Dim> *bin_indices) const {
+        // Get the index corresponding to the axis label (e.g. bin_x <=> 0)
+        constexpr dindex loc_idx =
+            axis_reg::to_index(axis_t::bounds_type::label);
+
+        scalar_type values[batch_size];
+        dindex ax_bins[batch_size];
+        for (std::size_t i = 0u; i < n; ++i) {
+            values[i] = points[i][loc_idx];
+        }
+        ax.bins(values, n, ax_bins);
+        for (std::size_t i = 0u; i < n; ++i) {
+            bin_indices[i].indices[loc_idx] = ax_bins[i];
+        }
+    }
+
     /// Perform the bin lookup on a particular axis within a given bin
     /// neighborhood
     ///
@@ -78,6 +78,23 @@ struct regular {
         return static_cast<int>((v - span()[0]) / bin_width() + 1.f) - 1;
     }
 
+    /// Access function to the bins of a batch of values
+    ///
+    /// The span and bin width are loaded only once and the loop body is free
+    /// of branches, so that the compiler can vectorize it.
+    ///
+    /// @param values the values for the bin search
+    /// @param n the number of values
+    /// @param bins the resulting bin indices (same as @c bin(v) per value)
+    DETRAY_HOST_DEVICE
+    void bins(const scalar_t *values, const std::size_t n, int *bins) const {
+        const scalar_t min{span()[0]};
+        const scalar_t width{bin_width()};
+        for (std::size_t i = 0u; i < n; ++i) {
+            bins[i] = static_cast<int>((values[i] - min) / width + 1.f) - 1;
+        }
+    }
+
     /// Access function to a range with binned neighborhood
     ///
     /// @param v is the value for the bin search
@@ -222,11 +239,63 @@ struct irregular {
             static_cast<index_type>(detray::detail::get<1>(*m_edges_range));
 
         return static_cast<int>(
-                   detray::detail::lower_bound(bins_begin, bins_end, v) -
+                   detray::detail::upper_bound(bins_begin, bins_end, v) -
                    bins_begin) -
                1;
     }
 
+    /// Access function to a single bin from a value v, starting the search
+    /// at a guess for the number of lower bin edges below v
+    ///
+    /// @param v is the value for the bin search
+    /// @param edge_hint the guess, e.g. from a uniform lookup table
+    ///
+    /// @returns the corresponding bin index (same as @c bin(v))
+    DETRAY_HOST_DEVICE
+    int bin(const scalar_t v, const dindex edge_hint) const {
+        const dindex offset{detray::detail::get<0>(*m_edges_range)};
+        const auto n_edges{static_cast<dindex>(nbins())};
+
+        dindex pos{edge_hint < n_edges ? edge_hint : n_edges};
+        while (pos > 0u and (*m_bin_edges)[offset + pos - 1u] > v) {
+            --pos;
+        }
+        while (pos < n_edges and (*m_bin_edges)[offset + pos] <= v) {
+            ++pos;
+        }
+        return static_cast<int>(pos) - 1;
+    }
+
+    /// Access function to the bins of a batch of values
+    ///
+    /// Uses a branch-free binary search: the number of search steps depends
+    /// only on the number of bin edges and not on the values.
+    ///
+    /// @param values the values for the bin search
+    /// @param n the number of values
+    /// @param bins the resulting bin indices (same as @c bin(v) per value)
+    DETRAY_HOST_DEVICE
+    void bins(const scalar_t *values, const std::size_t n, int *bins) const {
+        const scalar_t *edges{m_bin_edges->data() +
+                              detray::detail::get<0>(*m_edges_range)};
+        const std::size_t n_edges{nbins()};
+
+        for (std::size_t i = 0u; i < n; ++i) {
+            const scalar_t v{values[i]};
+            // Position of the first edge that is greater than v
+            const scalar_t *base{edges};
+            std::size_t len{n_edges};
+            while (len > 1u) {
+                const std::size_t half{len / 2u};
+                base = (base[half] <= v) ? base + half : base;
+                len -= half;
+            }
+            const int pos{static_cast<int>(base - edges) +
+                          ((n_edges > 0u and *base <= v) ? 1 : 0)};
+            bins[i] = pos - 1;
+        }
+    }
+
     /// Access function to a range with binned neighborhood
     ///
     /// @param v is the value for the bin search
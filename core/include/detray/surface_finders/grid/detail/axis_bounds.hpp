@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -72,7 +72,7 @@ struct open {
     DETRAY_HOST_DEVICE
     constexpr auto map(const int ibin, const std::size_t nbins) const noexcept
         -> dindex {
-        if (ibin <= 0) {
+        if (ibin < 0) {
             // underflow bin
             return 0;
         } else if (ibin >= static_cast<int>(nbins)) {
@@ -219,6 +219,10 @@ struct circular {
     DETRAY_HOST_DEVICE
     auto constexpr map(const int lbin, const int ubin,
                        const std::size_t nbins) const noexcept -> dindex_range {
+        // The range covers the entire axis
+        if (ubin - lbin + 1 >= static_cast<int>(nbins)) {
+            return {0u, static_cast<dindex>(nbins - 1u)};
+        }
         dindex min_bin = static_cast<dindex>(wrap(lbin, nbins));
         dindex max_bin = static_cast<dindex>(wrap(ubin, nbins));
         return {min_bin, max_bin};
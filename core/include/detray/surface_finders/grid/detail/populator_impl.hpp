@@ -13,6 +13,14 @@
 #include "detray/utils/invalid_values.hpp"
 #include "detray/utils/ranges.hpp"
 
+// System include(s).
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace detray {
 
 /// @brief base type for the storage element that wraps a bin content in the
@@ -297,105 +305,383 @@ struct regular_attacher {
     }
 };
 
-/// An irregular attach populator that adds the new entry to the collection of
-/// entries in a given bin: each bin is dynamically sized.
+/// @brief bin type for a grid backend storage in compressed sparse row (CSR)
+///        layout.
 ///
-/// @tparam kDIM the dimension of the array in the bin content
-/// @tparam entry_t the type of a single element in the bin content
-/// @tparam kSORT sort the elements in the bin content
+/// Every element of the backend storage holds one slot of the flat entry
+/// column, as well as the offset and the number of entries of the bin with
+/// the same global index. The offset is relative to the position of the
+/// element in the storage, so that the bin storage of a grid can be appended
+/// to a grid collection without rebasing the offsets.
+template <typename entry_t>
+class csr_bin {
+
+    public:
+    using entry_type = entry_t;
+    using content_type = entry_t;
+
+    csr_bin() = default;
+
+    DETRAY_HOST_DEVICE
+    csr_bin(const entry_t &entry, const dindex offset, const dindex n)
+        : m_entry{entry}, m_offset{offset}, m_n_entries{n} {}
+
+    /// @returns the entry in the flat entry column - const
+    DETRAY_HOST_DEVICE
+    auto entry() const -> const entry_t & { return m_entry; }
+
+    /// @returns the entry in the flat entry column
+    DETRAY_HOST_DEVICE
+    auto entry() -> entry_t & { return m_entry; }
+
+    /// @returns the number of entries in the bin
+    DETRAY_HOST_DEVICE
+    constexpr auto n_entries() const -> dindex { return m_n_entries; }
+
+    /// @returns the entry range of the bin, if the element sits at the
+    /// global position @param gbin in the backend storage
+    /// @note relies on unsigned wrap-around for offsets that point backwards
+    DETRAY_HOST_DEVICE
+    constexpr auto range(const dindex gbin) const -> dindex_range {
+        const dindex first{gbin + m_offset};
+        return {first, first + m_n_entries};
+    }
+
+    /// Set the entry range [ @param first, @param last ) of the bin at the
+    /// global position @param gbin
+    DETRAY_HOST_DEVICE
+    constexpr void set_range(const dindex gbin, const dindex first,
+                             const dindex last) {
+        m_offset = first - gbin;
+        m_n_entries = last - first;
+    }
+
+    private:
+    /// Single slot of the flat entry column
+    entry_t m_entry{};
+    /// Offset of the first bin entry relative to the position of this element
+    dindex m_offset{0u};
+    /// Number of entries in the bin
+    dindex m_n_entries{0u};
+};
+
+namespace detail {
+
+/// @brief View on the entry column of a contiguous range of @c csr_bin
+///        elements.
 ///
-/// @note since this type performs a bin search upon insertion and bin lookup,
-/// it is comparatively slow and should only be used if there is a large
-/// difference in the number of elements in the bin entries. Otherwise, use the
-/// @c regular_attacher.
-/// @note the entry type must be default constructible, since its default
-/// entry may be interpreted as the empty element in which to put the new entry.
-/*template <typename entry_t = dindex, std::size_t kDIM = 1, bool kSORT = false,
-          template <typename...> class vector_t = dvector>
-struct irregular_attacher {
+/// Behaves like the @c detray::ranges::subrange that the other populators
+/// return, but only exposes the entries of the storage elements.
+template <typename bin_t>
+class csr_view : public detray::ranges::view_interface<csr_view<bin_t>> {
+
+    using entry_t = std::conditional_t<std::is_const_v<bin_t>,
+                                       const typename bin_t::entry_type,
+                                       typename bin_t::entry_type>;
+
+    /// @brief Nested iterator that dereferences to the entry of a bin
+    struct iterator {
+
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::remove_cv_t<entry_t>;
+        using pointer = entry_t *;
+        using reference = entry_t &;
+        using iterator_category = detray::ranges::random_access_iterator_tag;
+
+        /// @returns true if the iterators point to the same element
+        DETRAY_HOST_DEVICE
+        constexpr auto operator==(const iterator &rhs) const -> bool {
+            return m_bin == rhs.m_bin;
+        }
+
+        /// @returns true if the iterators point to different elements
+        DETRAY_HOST_DEVICE
+        constexpr auto operator!=(const iterator &rhs) const -> bool {
+            return m_bin != rhs.m_bin;
+        }
+
+        /// @returns true if this iterator precedes @param rhs
+        DETRAY_HOST_DEVICE
+        constexpr auto operator<(const iterator &rhs) const -> bool {
+            return m_bin < rhs.m_bin;
+        }
+
+        /// Increment the iterator
+        DETRAY_HOST_DEVICE
+        constexpr auto operator++() -> iterator & {
+            ++m_bin;
+            return *this;
+        }
+
+        /// Decrement the iterator
+        DETRAY_HOST_DEVICE
+        constexpr auto operator--() -> iterator & {
+            --m_bin;
+            return *this;
+        }
+
+        /// Advance the iterator by @param j
+        DETRAY_HOST_DEVICE
+        constexpr auto operator+=(const difference_type j) -> iterator & {
+            m_bin += j;
+            return *this;
+        }
+
+        /// Advance the iterator backwards by @param j
+        DETRAY_HOST_DEVICE
+        constexpr auto operator-=(const difference_type j) -> iterator & {
+            m_bin -= j;
+            return *this;
+        }
+
+        /// @returns an iterator advanced by @param j
+        DETRAY_HOST_DEVICE
+        constexpr auto operator+(const difference_type j) const -> iterator {
+            return {m_bin + j};
+        }
 
-    /// The storage element saves additional information to find the correct
-    /// bin in a 'jagged' memory layout.
-    template <typename T, template <typename> class V>
-    struct indexed_bin
-        : public bin_base<
-              T, V, typename std::enable_if_t<std::is_standard_layout_v<T>>> {
-        using base_type = bin_base<T, V, void>;
-        using view_type = typename base_type::view_type;
-        using const_view_type = typename base_type::view_type;
-        /// The global bin a single entry in a bin content is associated with
-        dindex gbin;
-
-        /// Set to invalid entries by default
-        indexed_bin() : gbin{dindex_invalid} {
-            this->entry = detail::invalid_value<entry_t>();
+        /// @returns an iterator advanced backwards by @param j
+        DETRAY_HOST_DEVICE
+        constexpr auto operator-(const difference_type j) const -> iterator {
+            return {m_bin - j};
         }
+
+        /// @returns the distance to the iterator @param rhs
+        DETRAY_HOST_DEVICE
+        constexpr auto operator-(const iterator &rhs) const
+            -> difference_type {
+            return m_bin - rhs.m_bin;
+        }
+
+        /// @returns the entry of the current bin element
+        DETRAY_HOST_DEVICE
+        constexpr auto operator*() const -> reference {
+            return m_bin->entry();
+        }
+
+        /// @returns a pointer to the entry of the current bin element
+        DETRAY_HOST_DEVICE
+        constexpr auto operator->() const -> pointer {
+            return &(m_bin->entry());
+        }
+
+        /// @returns the entry at the position @param j from the current one
+        DETRAY_HOST_DEVICE
+        constexpr auto operator[](const difference_type j) const
+            -> reference {
+            return m_bin[j].entry();
+        }
+
+        /// Current storage element
+        bin_t *m_bin{nullptr};
     };
 
-    /// Sort the entries contained in a bin entry when fetched
-    static constexpr bool do_sort = kSORT;
+    public:
+    /// Default constructor
+    csr_view() = default;
+
+    /// Construct from the storage elements @param first and @param last
+    DETRAY_HOST_DEVICE
+    constexpr csr_view(bin_t *first, bin_t *last)
+        : m_begin{first}, m_end{last} {}
+
+    /// Copy constructor
+    DETRAY_HOST_DEVICE
+    constexpr csr_view(const csr_view &other)
+        : m_begin{other.m_begin}, m_end{other.m_end} {}
+
+    /// Copy assignment operator
+    DETRAY_HOST_DEVICE
+    csr_view &operator=(const csr_view &other) {
+        m_begin = other.m_begin;
+        m_end = other.m_end;
+        return *this;
+    }
+
+    /// @return start position of the entries
+    DETRAY_HOST_DEVICE
+    constexpr auto begin() const -> iterator { return m_begin; }
+
+    /// @return sentinel of the entries
+    DETRAY_HOST_DEVICE
+    constexpr auto end() const -> iterator { return m_end; }
+
+    private:
+    /// Start and end position of the entries
+    iterator m_begin{}, m_end{};
+};
+
+}  // namespace detail
+
+/// An irregular attach populator that adds the new entry to the collection of
+/// entries in a given bin: each bin is dynamically sized.
+///
+/// The bin storage is kept in compressed sparse row layout (see @c csr_bin),
+/// i.e. an offset per bin into a flat entry column. Dense bins therefore
+/// never drop entries and sparse bins do not waste memory.
+///
+/// @tparam kSORT sort the entries in the bin content
+///
+/// @note the backend storage holds at least as many elements as the grid has
+/// bins, but it grows beyond that when the entry column needs more slots.
+/// Adding a single entry appends it to the back of the storage in O(n) for a
+/// bin with n entries, moving the bin there first if necessary, which leaves
+/// unused slots behind. Filling many entries at once (@c fill) counts the
+/// entries per bin in a first pass and places them in a second pass, which
+/// rebuilds the entire entry column without gaps. The population is
+/// host-only in either case.
+/// @note only owning grids can be populated, since the backend storage is
+/// resized when it does not have enough slots for the entries.
+template <bool kSORT = false>
+struct irregular_attacher {
+
+    /// Sorting is done on insertion
+    static constexpr bool do_sort = false;
 
     template <typename entry_t>
-    using bin_type = bin<vector_t<entry_t, kDIM>, single_iterator>;
+    using bin_type = csr_bin<entry_t>;
 
-    /// Add a new entry to the storage element - move
+    /// Append a new entry to the bin
+    ///
+    /// If the bin entries do not end at the back of the storage, they are
+    /// moved there first. The slots they occupied before are not reused until
+    /// the next call to @c fill, which compacts the entry column.
     ///
     /// @param storage the grid backend storage
-    /// @param gbin the global grid bin to be populated
-    /// @param entry new entry to be added to the vector
-    template<typename bin_storage_t, typename entry_t>
-    DETRAY_HOST
-    void operator()(bin_storage_t &storage,
-                    const dindex &gbin, entry_t &&entry) const {
-        auto last_gbin_entry = detail::upper_bound(storage.begin(),
-storage.end(), entry); *last_gbin_entry = std::move(entry);
+    /// @param gbin the global grid bin index to be populated
+    /// @param entry new entry to add to the bin
+    template <typename bin_storage_t, typename entry_t>
+    DETRAY_HOST void operator()(bin_storage_t &storage, const dindex gbin,
+                                entry_t &&entry) const {
+        using stored_entry_t = typename bin_storage_t::value_type::entry_type;
+        using bin_t = typename bin_storage_t::value_type;
+
+        if (storage.size() <= gbin) {
+            storage.resize(gbin + 1u, init<stored_entry_t>());
+        }
+
+        const dindex_range r = storage[gbin].range(gbin);
+        dindex first{r[0]};
+        if (r[1] != static_cast<dindex>(storage.size())) {
+            // Move the bin entries to the back (copy the entry, since the
+            // storage might be reallocated)
+            first = static_cast<dindex>(storage.size());
+            for (dindex i = r[0]; i < r[1]; ++i) {
+                const stored_entry_t moved{storage[i].entry()};
+                storage.push_back(bin_t{moved, 0u, 0u});
+            }
+        }
+        storage.push_back(bin_t{std::forward<entry_t>(entry), 0u, 0u});
+        const auto last{static_cast<dindex>(storage.size())};
+
+        if constexpr (kSORT) {
+            // The bin is already sorted: insert the new entry
+            for (dindex i = last - 1u;
+                 i > first and storage[i].entry() < storage[i - 1u].entry();
+                 --i) {
+                std::swap(storage[i].entry(), storage[i - 1u].entry());
+            }
+        }
+
+        storage[gbin].set_range(gbin, first, last);
     }
 
-    /// Add a new entry to the storage element - copy
+    /// Add a collection of entries to the bins of a grid in two passes
     ///
     /// @param storage the grid backend storage
-    /// @param gbin the global grid bin to be populated
-    /// @param entry new entry to be added to the vector
-    template<typename bin_storage_t, typename entry_t>
-    DETRAY_HOST
-    void operator()(bin_storage_t &storage,
-                    const dindex gbin, entry_t &entry) const {
-        auto last_gbin_entry = detail::upper_bound(storage.begin(),
-storage.end(), entry); *last_gbin_entry = entry;
+    /// @param bin_entries range of pairs of a global bin index and an entry
+    template <typename bin_storage_t, typename bin_entries_t>
+    DETRAY_HOST static void fill(bin_storage_t &storage,
+                                 const bin_entries_t &bin_entries) {
+        using stored_entry_t = typename bin_storage_t::value_type::entry_type;
+
+        // First pass: count the existing and new entries per bin
+        std::vector<dindex> offsets(storage.size() + 1u, 0u);
+        for (dindex gbin = 0u; gbin < storage.size(); ++gbin) {
+            offsets[gbin + 1u] = storage[gbin].n_entries();
+        }
+        for (const auto &bin_entry : bin_entries) {
+            // Grow the storage, if necessary
+            if (bin_entry.first >= offsets.size() - 1u) {
+                offsets.resize(bin_entry.first + 2u, 0u);
+            }
+            ++offsets[bin_entry.first + 1u];
+        }
+        for (std::size_t i = 1u; i < offsets.size(); ++i) {
+            offsets[i] += offsets[i - 1u];
+        }
+
+        // Second pass: place the entries
+        std::vector<stored_entry_t> entries(offsets.back());
+        std::vector<dindex> next(offsets.begin(), offsets.end() - 1);
+        for (dindex gbin = 0u; gbin < storage.size(); ++gbin) {
+            const dindex_range r = storage[gbin].range(gbin);
+            for (dindex i = r[0]; i < r[1]; ++i) {
+                entries[next[gbin]++] = storage[i].entry();
+            }
+        }
+        for (const auto &bin_entry : bin_entries) {
+            entries[next[bin_entry.first]++] = bin_entry.second;
+        }
+        if constexpr (kSORT) {
+            for (std::size_t gbin = 0u; gbin < next.size(); ++gbin) {
+                std::sort(entries.begin() + offsets[gbin],
+                          entries.begin() + offsets[gbin + 1u]);
+            }
+        }
+
+        // Write the entry column and the bin offsets back to the storage
+        const std::size_t n_slots{
+            std::max(offsets.size() - 1u, entries.size())};
+        if (storage.size() < n_slots) {
+            storage.resize(n_slots, init<stored_entry_t>());
+        }
+        const auto inv_entry{detail::invalid_value<stored_entry_t>()};
+        for (dindex gbin = 0u; gbin < storage.size(); ++gbin) {
+            storage[gbin].entry() =
+                gbin < entries.size() ? entries[gbin] : inv_entry;
+            const dindex first{gbin < next.size() ? offsets[gbin]
+                                                   : offsets.back()};
+            const dindex last{gbin < next.size() ? offsets[gbin + 1u]
+                                                  : offsets.back()};
+            storage[gbin].set_range(gbin, first, last);
+        }
     }
 
-    /// Fetch a bin content from a storage element in the backend storage -
-const
+    /// Fetch a bin from a storage element in the backend storage - const
     ///
     /// @param storage the grid backend storage
-    /// @param gbin the global grid bin to be fetched
-    /// @param sub_idx fetch a single entry from the bin content
+    /// @param gbin the global grid bin index to be viewed
     ///
-    /// @return the sub-content in the global bin
-    template<typename bin_storage_t>
-    DETRAY_HOST_DEVICE
-    auto view(const bin_storage_t &storage,
-               const dindex gbin) const { auto first_gbin_entry =
-detail::lower_bound(storage.begin(), storage.end(), entry); auto last_gbin_entry
-= detail::upper_bound(storage.begin(), storage.end(), entry);
+    /// @return a const iterator view on the bin content
+    template <typename bin_storage_t>
+    DETRAY_HOST_DEVICE auto view(const bin_storage_t &storage,
+                                 const dindex gbin) const {
+        using bin_t = const typename bin_storage_t::value_type;
 
+        const dindex_range r = storage[gbin].range(gbin);
+        return detail::csr_view<bin_t>{storage.data() + r[0],
+                                       storage.data() + r[1]};
     }
 
-    /// @returns an initialized bin entry
-    template<typename entry_t>
-    DETRAY_HOST_DEVICE
-    static constexpr auto init(
-        entry_t content = detail::invalid_value<entry_t>()) -> bin_type<entry_t>
-{
-        // Set capacity the storage element
-        entry_t stored(nentries);
-        std::fill(stored.begin(), stored.end(),
-detail::invalid_value<entry_t>());
+    template <typename bin_storage_t>
+    DETRAY_HOST_DEVICE auto view(bin_storage_t &storage, const dindex gbin) {
+        using bin_t = typename bin_storage_t::value_type;
 
-        stored.at(0) = entry;
+        const dindex_range r = storage[gbin].range(gbin);
+        return detail::csr_view<bin_t>{storage.data() + r[0],
+                                       storage.data() + r[1]};
+    }
 
-        return {stored};
+    /// @returns an initialized storage element that contains @param entry as
+    /// the single entry of the bin
+    template <typename entry_t>
+    DETRAY_HOST_DEVICE static constexpr auto init(
+        entry_t entry = detail::invalid_value<entry_t>()) -> bin_type<entry_t> {
+        const dindex n_elem{entry == detail::invalid_value<entry_t>() ? 0u
+                                                                       : 1u};
+        return {entry, 0u, n_elem};
     }
-};*/
+};
 
-}  // namespace detray
\ No newline at end of file
+}  // namespace detray
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -12,6 +12,9 @@
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/surface_finders/grid/axis.hpp"
 
+// System include(s).
+#include <cstddef>
+
 namespace detray {
 
 /// @brief Transforms a local axis bin index to a global grid bin index and vice
@@ -131,4 +134,445 @@ struct simple_serializer<3> {
     }
 };
 
+namespace detail {
+
+/// @returns the number of bins that the block of side length @param size,
+/// which starts at @param first on an axis with @param n_bins bins, covers
+DETRAY_HOST_DEVICE constexpr auto block_overlap(const dindex first,
+                                                const dindex size,
+                                                const dindex n_bins)
+    -> dindex {
+    return first >= n_bins ? 0u
+                           : (size < n_bins - first ? size : n_bins - first);
+}
+
+/// @returns the bit @param mask of every bin index in @param mbin, packed
+/// into a single bit pattern (axis 0 is the lowest bit)
+template <std::size_t kDIM>
+DETRAY_HOST_DEVICE constexpr auto level_bits(
+    const n_axis::multi_bin<kDIM> &mbin, const dindex mask) -> unsigned int {
+    unsigned int bits{0u};
+    for (std::size_t i = 0u; i < kDIM; ++i) {
+        bits |= ((mbin[i] & mask) ? 1u : 0u) << i;
+    }
+    return bits;
+}
+
+/// @brief Rank and unrank bins along a space filling curve.
+///
+/// The curve is defined on the smallest power of two hypercube that contains
+/// all bins and is subdivided recursively into 2^kDIM child blocks per level.
+/// Only the bins that lie inside the axes ranges are counted, so that the
+/// global bin indices stay dense in [0, nbins) for any number of bins. As
+/// soon as a block lies completely inside the axes ranges, the position in
+/// the block is given by the curve directly.
+///
+/// @tparam curve_t defines the order and orientation of the child blocks
+/// @tparam kDIM the number of axes
+template <typename curve_t, std::size_t kDIM>
+struct space_filling_curve {
+
+    /// Number of child blocks per level
+    static constexpr unsigned int n_children{1u << kDIM};
+
+    /// @returns the position of @param mbin along the curve
+    DETRAY_HOST_DEVICE
+    static constexpr auto rank(const n_axis::multi_bin<kDIM> &n_bins,
+                               const n_axis::multi_bin<kDIM> &mbin) -> dindex {
+        curve_t curve{};
+        n_axis::multi_bin<kDIM> corner{};
+        dindex gbin{0u};
+
+        // Blocks that are cut by the axes ranges: skip the bins of all
+        // preceding child blocks
+        dindex size{block_size(n_bins)};
+        for (; size > 1u and not is_inside(corner, size, n_bins);) {
+            size >>= 1u;
+            const unsigned int bits{level_bits(mbin, size)};
+            const unsigned int child{curve.child_index(bits)};
+            for (unsigned int c = 0u; c < child; ++c) {
+                gbin +=
+                    n_bins_in_block(corner, curve.child_bits(c), size, n_bins);
+            }
+            descend(corner, bits, size);
+            curve.descend(child);
+        }
+
+        return gbin + curve.rank_in_block(mbin, size);
+    }
+
+    /// @returns the bin at position @param gbin along the curve
+    DETRAY_HOST_DEVICE
+    static constexpr auto unrank(const n_axis::multi_bin<kDIM> &n_bins,
+                                 dindex gbin) -> n_axis::multi_bin<kDIM> {
+        curve_t curve{};
+        n_axis::multi_bin<kDIM> corner{};
+
+        // Blocks that are cut by the axes ranges: find the child block that
+        // contains the bin
+        dindex size{block_size(n_bins)};
+        for (; size > 1u and not is_inside(corner, size, n_bins);) {
+            size >>= 1u;
+            for (unsigned int c = 0u; c < n_children; ++c) {
+                const unsigned int bits{curve.child_bits(c)};
+                const dindex n{n_bins_in_block(corner, bits, size, n_bins)};
+                if (gbin < n or c == n_children - 1u) {
+                    descend(corner, bits, size);
+                    curve.descend(c);
+                    break;
+                }
+                gbin -= n;
+            }
+        }
+
+        const n_axis::multi_bin<kDIM> loc_bin{
+            curve.template unrank_in_block<kDIM>(gbin, size)};
+        for (std::size_t i = 0u; i < kDIM; ++i) {
+            corner[i] |= loc_bin[i];
+        }
+
+        return corner;
+    }
+
+    private:
+    /// @returns the side length of the smallest power of two block that
+    /// contains all bins @param n_bins
+    DETRAY_HOST_DEVICE
+    static constexpr auto block_size(const n_axis::multi_bin<kDIM> &n_bins)
+        -> dindex {
+        dindex max_bins{1u};
+        for (std::size_t i = 0u; i < kDIM; ++i) {
+            max_bins = n_bins[i] > max_bins ? n_bins[i] : max_bins;
+        }
+        // Round up to the next power of two
+        dindex size{max_bins - 1u};
+        for (unsigned int shift = 1u; shift < 8u * sizeof(dindex);
+             shift <<= 1u) {
+            size |= size >> shift;
+        }
+        return size + 1u;
+    }
+
+    /// @returns true if the block of side length @param size at
+    /// @param corner lies completely inside the axes ranges
+    DETRAY_HOST_DEVICE
+    static constexpr bool is_inside(const n_axis::multi_bin<kDIM> &corner,
+                                    const dindex size,
+                                    const n_axis::multi_bin<kDIM> &n_bins) {
+        for (std::size_t i = 0u; i < kDIM; ++i) {
+            if (corner[i] + size > n_bins[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @returns the number of bins in the child block of side length
+    /// @param size with the global bit pattern @param bits below the block
+    /// @param corner
+    DETRAY_HOST_DEVICE
+    static constexpr auto n_bins_in_block(
+        const n_axis::multi_bin<kDIM> &corner, const unsigned int bits,
+        const dindex size, const n_axis::multi_bin<kDIM> &n_bins) -> dindex {
+        dindex n{1u};
+        for (std::size_t i = 0u; i < kDIM; ++i) {
+            const dindex first{corner[i] + (((bits >> i) & 1u) ? size : 0u)};
+            n *= block_overlap(first, size, n_bins[i]);
+        }
+        return n;
+    }
+
+    /// Move the @param corner into the child block @param bits of side
+    /// length @param size
+    DETRAY_HOST_DEVICE
+    static constexpr void descend(n_axis::multi_bin<kDIM> &corner,
+                                  const unsigned int bits, const dindex size) {
+        for (std::size_t i = 0u; i < kDIM; ++i) {
+            corner[i] |= ((bits >> i) & 1u) ? size : 0u;
+        }
+    }
+};
+
+/// @brief Z-order: the child blocks are visited in the order of their bits
+struct morton_curve {
+
+    /// @returns the position of the child block @param bits along the curve
+    DETRAY_HOST_DEVICE
+    constexpr auto child_index(const unsigned int bits) const -> unsigned int {
+        return bits;
+    }
+
+    /// @returns the bits of the child block at position @param c
+    DETRAY_HOST_DEVICE
+    constexpr auto child_bits(const unsigned int c) const -> unsigned int {
+        return c;
+    }
+
+    /// The curve looks the same on every level
+    DETRAY_HOST_DEVICE
+    constexpr void descend(const unsigned int /*c*/) const {}
+
+    /// @returns the position of @param mbin in a completely filled block of
+    /// side length @param size: the interleaved bin indices
+    template <std::size_t kDIM>
+    DETRAY_HOST_DEVICE constexpr auto rank_in_block(
+        const n_axis::multi_bin<kDIM> &mbin, const dindex size) const
+        -> dindex {
+        const dindex mask{size - 1u};
+        if constexpr (kDIM == 2u) {
+            if (size <= 0x10000u) {
+                return spread_2D(mbin[0] & mask) |
+                       (spread_2D(mbin[1] & mask) << 1u);
+            }
+        } else if constexpr (kDIM == 3u) {
+            if (size <= 0x400u) {
+                return spread_3D(mbin[0] & mask) |
+                       (spread_3D(mbin[1] & mask) << 1u) |
+                       (spread_3D(mbin[2] & mask) << 2u);
+            }
+        }
+        dindex gbin{0u};
+        for (unsigned int l = 0u; (dindex{1u} << l) < size; ++l) {
+            gbin |= static_cast<dindex>(level_bits(mbin, dindex{1u} << l))
+                    << (l * kDIM);
+        }
+        return gbin;
+    }
+
+    /// @returns the bin at position @param gbin in a completely filled block
+    /// of side length @param size
+    template <std::size_t kDIM>
+    DETRAY_HOST_DEVICE constexpr auto unrank_in_block(const dindex gbin,
+                                                      const dindex size) const
+        -> n_axis::multi_bin<kDIM> {
+        n_axis::multi_bin<kDIM> mbin{};
+        if constexpr (kDIM == 2u) {
+            if (size <= 0x10000u) {
+                mbin[0] = compact_2D(gbin);
+                mbin[1] = compact_2D(gbin >> 1u);
+                return mbin;
+            }
+        } else if constexpr (kDIM == 3u) {
+            if (size <= 0x400u) {
+                mbin[0] = compact_3D(gbin);
+                mbin[1] = compact_3D(gbin >> 1u);
+                mbin[2] = compact_3D(gbin >> 2u);
+                return mbin;
+            }
+        }
+        for (unsigned int l = 0u; (dindex{1u} << l) < size; ++l) {
+            for (std::size_t i = 0u; i < kDIM; ++i) {
+                mbin[i] |= ((gbin >> (l * kDIM + i)) & 1u) << l;
+            }
+        }
+        return mbin;
+    }
+
+    private:
+    /// Insert a zero bit between the lowest 16 bits of @param x
+    DETRAY_HOST_DEVICE
+    static constexpr auto spread_2D(dindex x) -> dindex {
+        x &= 0x0000ffffu;
+        x = (x | (x << 8u)) & 0x00ff00ffu;
+        x = (x | (x << 4u)) & 0x0f0f0f0fu;
+        x = (x | (x << 2u)) & 0x33333333u;
+        x = (x | (x << 1u)) & 0x55555555u;
+        return x;
+    }
+
+    /// Remove every second bit of @param x (inverse of @c spread_2D)
+    DETRAY_HOST_DEVICE
+    static constexpr auto compact_2D(dindex x) -> dindex {
+        x &= 0x55555555u;
+        x = (x | (x >> 1u)) & 0x33333333u;
+        x = (x | (x >> 2u)) & 0x0f0f0f0fu;
+        x = (x | (x >> 4u)) & 0x00ff00ffu;
+        x = (x | (x >> 8u)) & 0x0000ffffu;
+        return x;
+    }
+
+    /// Insert two zero bits between the lowest 10 bits of @param x
+    DETRAY_HOST_DEVICE
+    static constexpr auto spread_3D(dindex x) -> dindex {
+        x &= 0x000003ffu;
+        x = (x | (x << 16u)) & 0x030000ffu;
+        x = (x | (x << 8u)) & 0x0300f00fu;
+        x = (x | (x << 4u)) & 0x030c30c3u;
+        x = (x | (x << 2u)) & 0x09249249u;
+        return x;
+    }
+
+    /// Remove two of three bits of @param x (inverse of @c spread_3D)
+    DETRAY_HOST_DEVICE
+    static constexpr auto compact_3D(dindex x) -> dindex {
+        x &= 0x09249249u;
+        x = (x | (x >> 2u)) & 0x030c30c3u;
+        x = (x | (x >> 4u)) & 0x0300f00fu;
+        x = (x | (x >> 8u)) & 0x030000ffu;
+        x = (x | (x >> 16u)) & 0x000003ffu;
+        return x;
+    }
+};
+
+/// @brief Two dimensional Hilbert curve: the child blocks are visited in the
+/// order (0,0), (0,1), (1,1), (1,0) of the current curve orientation.
+///
+/// The orientation maps the local block bits to the global ones by first
+/// swapping the axes and then flipping them.
+struct hilbert_curve {
+
+    bool swap{false};
+    unsigned int flip{0u};
+
+    /// @returns the position of the child block @param bits along the curve
+    DETRAY_HOST_DEVICE
+    constexpr auto child_index(const unsigned int bits) const -> unsigned int {
+        const unsigned int b{bits ^ flip};
+        const unsigned int u{swap ? (b >> 1u) : (b & 1u)};
+        const unsigned int v{swap ? (b & 1u) : (b >> 1u)};
+        return (3u * u) ^ v;
+    }
+
+    /// @returns the bits of the child block at position @param c
+    DETRAY_HOST_DEVICE
+    constexpr auto child_bits(const unsigned int c) const -> unsigned int {
+        const unsigned int u{c >> 1u};
+        const unsigned int v{(c ^ u) & 1u};
+        return (swap ? (v | (u << 1u)) : (u | (v << 1u))) ^ flip;
+    }
+
+    /// Update the orientation for the child block at position @param c
+    DETRAY_HOST_DEVICE
+    constexpr void descend(const unsigned int c) {
+        // Only the first and last child block are rotated: reflection on the
+        // diagonal (first) or the anti-diagonal (last)
+        if (c == 0u or c == 3u) {
+            swap = not swap;
+            flip ^= (c == 3u ? 3u : 0u);
+        }
+    }
+
+    /// @returns the position of @param mbin in a completely filled block of
+    /// side length @param size
+    template <std::size_t kDIM>
+    DETRAY_HOST_DEVICE constexpr auto rank_in_block(
+        const n_axis::multi_bin<kDIM> &mbin, const dindex size) -> dindex {
+        dindex gbin{0u};
+        for (dindex s = size >> 1u; s > 0u; s >>= 1u) {
+            const unsigned int c{child_index(level_bits(mbin, s))};
+            gbin += c * s * s;
+            descend(c);
+        }
+        return gbin;
+    }
+
+    /// @returns the bin at position @param gbin in a completely filled block
+    /// of side length @param size
+    template <std::size_t kDIM>
+    DETRAY_HOST_DEVICE constexpr auto unrank_in_block(const dindex gbin,
+                                                      const dindex size)
+        -> n_axis::multi_bin<kDIM> {
+        n_axis::multi_bin<kDIM> mbin{};
+        unsigned int shift{0u};
+        while ((dindex{1u} << shift) < size) {
+            shift += 1u;
+        }
+        for (dindex s = size >> 1u; s > 0u; s >>= 1u) {
+            shift -= 1u;
+            const auto c{
+                static_cast<unsigned int>((gbin >> (2u * shift)) & 3u)};
+            const unsigned int bits{child_bits(c)};
+            mbin[0] |= (bits & 1u) ? s : 0u;
+            mbin[1] |= (bits & 2u) ? s : 0u;
+            descend(c);
+        }
+        return mbin;
+    }
+};
+
+}  // namespace detail
+
+/// @brief Serializer that lays out the bins along a Morton (Z-order) curve
+///
+/// Neighbouring bins on all axes stay close in memory, which improves the
+/// cache locality of neighbourhood lookups compared to the row-major
+/// @c simple_serializer. The global bins are dense in [0, nbins) also for
+/// bin numbers that are not a power of two.
+template <std::size_t kDIM>
+struct morton_serializer {
+
+    using curve_type = detail::space_filling_curve<detail::morton_curve, kDIM>;
+
+    /// @brief Create a serial bin from a multi-bin
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param mbin contains a bin index for every axis in the multi-axis.
+    ///
+    /// @returns a dindex for the bin data storage
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t &axes,
+                                       n_axis::multi_bin<kDIM> mbin) const
+        -> dindex {
+        return curve_type::rank(axes.nbins(), mbin);
+    }
+
+    /// @brief Create a bin tuple from a serialized bin
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param gbin the global (serial) bin
+    ///
+    /// @return a multi-bin
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t &axes, dindex gbin) const
+        -> n_axis::multi_bin<kDIM> {
+        return curve_type::unrank(axes.nbins(), gbin);
+    }
+};
+
+/// @brief Serializer that lays out the bins along a Hilbert curve
+///
+/// Consecutive global bins are always neighbours on the grid (for a power of
+/// two number of bins per axis), so that neighbourhood lookups touch fewer
+/// cache lines than with the Morton layout.
+///
+/// @note only available for one and two dimensional grids.
+template <std::size_t kDIM>
+struct hilbert_serializer {};
+
+/// @brief Hilbert serializer specialization for a single axis
+template <>
+struct hilbert_serializer<1> : public simple_serializer<1> {};
+
+/// @brief Hilbert serializer specialization for a 2D multi-axis
+template <>
+struct hilbert_serializer<2> {
+
+    using curve_type = detail::space_filling_curve<detail::hilbert_curve, 2>;
+
+    /// @brief Create a serial bin from a multi-bin - 2D
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param mbin contains a bin index for every axis in the multi-axis.
+    ///
+    /// @returns a dindex for the bin data storage
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t &axes,
+                                       n_axis::multi_bin<2> mbin) const
+        -> dindex {
+        return curve_type::rank(axes.nbins(), mbin);
+    }
+
+    /// @brief Create a bin tuple from a serialized bin - 2D
+    ///
+    /// @param axes contains all axes (multi-axis)
+    /// @param gbin the global (serial) bin
+    ///
+    /// @return a 2-dimensional multi-bin
+    template <typename multi_axis_t>
+    DETRAY_HOST_DEVICE auto operator()(multi_axis_t &axes, dindex gbin) const
+        -> n_axis::multi_bin<2> {
+        return curve_type::unrank(axes.nbins(), gbin);
+    }
+};
+
 }  // namespace detray
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,18 +9,24 @@
 
 // Project include(s).
 #include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/surface_finders/grid/axis.hpp"
 #include "detray/surface_finders/grid/detail/grid_helpers.hpp"
 #include "detray/surface_finders/grid/populator.hpp"
 #include "detray/surface_finders/grid/serializer.hpp"
+#include "detray/utils/invalid_values.hpp"
 
 // VecMem include(s).
 #include <vecmem/memory/memory_resource.hpp>
 
 // System include(s).
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace detray {
 
@@ -33,6 +39,11 @@ namespace detray {
 /// @tparam populator_impl_t is a prescription what to do when a bin gets
 ///                          populated or read. It thus also defines the backend
 ///                          storage type/value type.
+///
+/// @note the backend storage holds at least one element per bin, i.e.
+/// @c nbins() elements, but populators with dynamically sized bins (e.g.
+/// @c irregular_attacher) can grow it beyond that. Only the first @c nbins()
+/// elements correspond to a bin of the grid.
 template <typename multi_axis_t, typename value_t,
           template <std::size_t> class serializer_t, typename populator_impl_t>
 class grid {
@@ -44,8 +55,9 @@ class grid {
     using serializer_type = serializer_t<DIM>;
     // Interface to the populator (determines the bin content and value type).
     using populator_impl = populator_impl_t;
-    using bin_type =
-        typename populator<populator_impl>::template bin_type<value_type>;
+    /// A grid with a const value type shares the bins of the mutable grid
+    using bin_type = typename populator<populator_impl>::template bin_type<
+        std::remove_const_t<value_type>>;
     /// The type of the multi-axis is tied to the type of the grid: a non-
     /// owning grid holds a non-owning multi-axis member.
     using axes_type = multi_axis_t;
@@ -57,10 +69,10 @@ class grid {
     static constexpr std::size_t Dim = axes_type::Dim;
     static constexpr bool is_owning = axes_type::is_owning;
 
-    /// How to define a neighborhood for this grid
+    /// How to define a neighborhood for this grid: lower and upper
+    /// neighborhood (in #bins or value interval) on every axis
     template <typename neighbor_t>
-    using neighborhood_type =
-        typename container_types::template array_type<neighbor_t, Dim>;
+    using neighborhood_type = std::array<std::array<neighbor_t, 2>, Dim>;
 
     /// Backend storage type for the grid
     using bin_storage_type =
@@ -73,9 +85,12 @@ class grid {
     using const_view_type = dmulti_view<dvector_view<const bin_type>,
                                         typename axes_type::const_view_type>;
     /// Grid backend can be owning (single grid) or non-owning (grid collection)
-    using storage_type =
-        std::conditional_t<is_owning, detail::grid_data<bin_storage_type>,
-                           detail::grid_view<bin_storage_type>>;
+    /// and non-owning grids with a const value type only get read access
+    using storage_type = std::conditional_t<
+        is_owning, detail::grid_data<bin_storage_type>,
+        detail::grid_view<std::conditional_t<std::is_const_v<value_type>,
+                                             const bin_storage_type,
+                                             bin_storage_type>>>;
     /// Find the corresponding (non-)owning grid type
     template <bool owning>
     using type = grid<typename multi_axis_t::template type<owning>, value_t,
@@ -227,26 +242,90 @@ class grid {
         return at(m_axes.bins(p));
     }
 
-    /// @brief Return a neighborhood of values from the grid
+    /// Find the global bins of a batch of points
+    ///
+    /// @param points the points in the local frame
+    /// @param n the number of points
+    /// @param gbins the resulting global bin indices, which can be passed to
+    ///              @c at() to access the bin content
+    template <typename point_t>
+    DETRAY_HOST_DEVICE void bins(const point_t *points, const std::size_t n,
+                                 dindex *gbins) const {
+        n_axis::multi_bin<Dim> mbins[n_axis::batch_size];
+        for (std::size_t first = 0u; first < n; first += n_axis::batch_size) {
+            const std::size_t n_batch{n - first < n_axis::batch_size
+                                          ? n - first
+                                          : n_axis::batch_size};
+            m_axes.bins(points + first, n_batch, mbins);
+            for (std::size_t i = 0u; i < n_batch; ++i) {
+                gbins[first + i] = m_serializer(m_axes, mbins[i]);
+            }
+        }
+    }
+
+    /// Find the global bins of a collection of points @param points in the
+    /// local frame
+    ///
+    /// @returns the global bin indices
+    template <typename point_t, typename alloc_t>
+    DETRAY_HOST auto bins(const std::vector<point_t, alloc_t> &points) const
+        -> std::vector<dindex> {
+        std::vector<dindex> gbins(points.size());
+        bins(points.data(), points.size(), gbins.data());
+        return gbins;
+    }
+
+    /// @brief Visit the values in a zone of bins around a point
     ///
-    /// The lookup is done with a neighborhood around the bin which contains the
-    /// point
+    /// The zone is given by a neighborhood around the bin which contains the
+    /// point. On circular axes, the zone wraps around the axis boundary.
     ///
-    /// @tparam sort is a directive whether return a sorted neighborhood
+    /// @param p is point in the local frame
+    /// @param nhood is the binned/scalar neighborhood on every axis
+    /// @param visitor is called with every valid value in the zone
+    template <typename point_t, typename neighbor_t, typename visitor_t,
+              std::enable_if_t<std::is_class_v<point_t>, bool> = true>
+    DETRAY_HOST_DEVICE auto visit_zone(
+        const point_t &p, const neighborhood_type<neighbor_t> &nhood,
+        visitor_t &&visitor) const -> void {
+        n_axis::multi_bin_range<Dim> bin_ranges{};
+        n_axis::multi_bin<Dim> n_zone_bins{};
+        const dindex n_zone{zone_bins(p, nhood, bin_ranges, n_zone_bins)};
+
+        visit_bins(bin_ranges, n_zone_bins, n_zone,
+                   std::forward<visitor_t>(visitor));
+    }
+
+    /// @brief Return the values in a zone of bins around a point
     ///
     /// @param p is point in the local frame
-    /// @param nhood is the binned/scalar neighborhood
+    /// @param nhood is the binned neighborhood on every axis
+    /// @param sort whether to sort the values (arithmetic value types only)
     ///
     /// @return the sequence of values
-    template <typename point_t, typename neighbor_t, bool sort = false,
+    template <typename point_t,
               std::enable_if_t<std::is_class_v<point_t>, bool> = true>
-    DETRAY_HOST_DEVICE auto search(const point_t &p,
-                                   neighborhood_type<neighbor_t> &nhood) const
-        -> void {
-        n_axis::multi_bin_range<Dim> bin_ranges = axes().bin_ranges(p, nhood);
-        // Return iterable over bin values in the multi-range
+    DETRAY_HOST auto search(const point_t &p,
+                            const neighborhood_type<dindex> &nhood,
+                            const bool sort = false) const
+        -> dvector<std::remove_const_t<value_type>> {
+        return zone(p, nhood, sort);
+    }
 
-        // Placeholder
+    /// @brief Return the values in a zone of bins around a point
+    ///
+    /// @param p is point in the local frame
+    /// @param nhood is the scalar neighborhood on every axis
+    /// @param sort whether to sort the values (arithmetic value types only)
+    ///
+    /// @return the sequence of values
+    template <typename point_t,
+              std::enable_if_t<std::is_class_v<point_t>, bool> = true>
+    DETRAY_HOST auto search(const point_t &p,
+                            const neighborhood_type<scalar_type> &nhood,
+                            const bool sort = false) const
+        -> dvector<std::remove_const_t<value_type>> {
+        return zone(p, nhood, sort);
     }
 
     /// Poupulate a bin with a single one of its corresponding values @param v
@@ -293,11 +372,46 @@ class grid {
     }
     /// @}
 
+    /// Populate the grid with a collection of values at once
+    ///
+    /// @param bin_entries range of pairs of a multi bin index and a value
+    ///
+    /// @note depending on the populator, this is considerably faster than
+    /// populating the bins value by value (e.g. @c irregular_attacher)
+    template <typename bin_entries_t>
+    DETRAY_HOST auto populate(const bin_entries_t &bin_entries) -> void {
+        std::vector<std::pair<dindex, value_type>> gbin_entries;
+        gbin_entries.reserve(bin_entries.size());
+        for (const auto &bin_entry : bin_entries) {
+            gbin_entries.emplace_back(
+                m_serializer(m_axes, bin_entry.first) + m_data.offset(),
+                bin_entry.second);
+        }
+        m_populator.fill(*(m_data.bin_data()), gbin_entries);
+    }
+
     /// @return the maximum number of surface candidates during a
-    /// neighborhood lookup
+    /// neighborhood lookup, i.e. the largest number of entries in any bin
     DETRAY_HOST_DEVICE constexpr auto n_max_candidates() const -> unsigned int {
-        // @todo: Hotfix for the toy geometry
-        return 20u;
+        unsigned int n_max{0u};
+        for (dindex gbin = 0u; gbin < n_filled_bins(); ++gbin) {
+            const unsigned int n{n_entries(gbin)};
+            n_max = n > n_max ? n : n_max;
+        }
+        return n_max;
+    }
+
+    /// @return the typical number of surface candidates during a
+    /// neighborhood lookup, i.e. the average number of entries per bin
+    /// (rounded up)
+    DETRAY_HOST_DEVICE constexpr auto n_typical_candidates() const
+        -> unsigned int {
+        const dindex n_bins{n_filled_bins()};
+        unsigned int n_total{0u};
+        for (dindex gbin = 0u; gbin < n_bins; ++gbin) {
+            n_total += n_entries(gbin);
+        }
+        return n_bins == 0u ? 0u : (n_total + n_bins - 1u) / n_bins;
     }
 
     static constexpr auto serializer() -> serializer_t<Dim> { return {}; }
@@ -321,6 +435,114 @@ class grid {
     }
 
     private:
+    /// Resolve the bin ranges of a zone around the point @param p
+    ///
+    /// @param nhood the neighborhood on every axis
+    /// @param bin_ranges the bin range on every axis
+    /// @param n_zone_bins the number of bins in the zone on every axis
+    ///
+    /// @returns the total number of bins in the zone
+    template <typename point_t, typename neighbor_t>
+    DETRAY_HOST_DEVICE auto zone_bins(
+        const point_t &p, const neighborhood_type<neighbor_t> &nhood,
+        n_axis::multi_bin_range<Dim> &bin_ranges,
+        n_axis::multi_bin<Dim> &n_zone_bins) const -> dindex {
+        const n_axis::multi_bin<Dim> n_bins = m_axes.nbins();
+        bin_ranges = m_axes.bin_ranges(p, nhood);
+
+        // Circular ranges can wrap around the axis boundary
+        dindex n_zone{1u};
+        for (dindex i = 0u; i < Dim; ++i) {
+            const dindex lower{bin_ranges[i][0]};
+            const dindex upper{bin_ranges[i][1]};
+            n_zone_bins[i] = (upper >= lower) ? upper - lower + 1u
+                                              : n_bins[i] - lower + upper + 1u;
+            n_zone *= n_zone_bins[i];
+        }
+        return n_zone;
+    }
+
+    /// Call @param visitor on every valid value in the @param n_zone bins of
+    /// a zone, the first axis is the fastest running one
+    template <typename visitor_t>
+    DETRAY_HOST_DEVICE auto visit_bins(
+        const n_axis::multi_bin_range<Dim> &bin_ranges,
+        const n_axis::multi_bin<Dim> &n_zone_bins, const dindex n_zone,
+        visitor_t &&visitor) const -> void {
+        const n_axis::multi_bin<Dim> n_bins = m_axes.nbins();
+
+        n_axis::multi_bin<Dim> mbin{};
+        n_axis::multi_bin<Dim> steps{};
+        for (dindex i = 0u; i < Dim; ++i) {
+            mbin[i] = bin_ranges[i][0];
+        }
+        for (dindex iz = 0u; iz < n_zone; ++iz) {
+            for (const auto &entry : at(mbin)) {
+                if constexpr (std::is_arithmetic_v<value_type>) {
+                    if (entry == detail::invalid_value<value_type>()) {
+                        continue;
+                    }
+                }
+                visitor(entry);
+            }
+            // Advance to the next bin, wrap around on circular axes
+            for (dindex i = 0u; i < Dim; ++i) {
+                if (++steps[i] < n_zone_bins[i]) {
+                    mbin[i] = (mbin[i] + 1u == n_bins[i]) ? 0u : mbin[i] + 1u;
+                    break;
+                }
+                steps[i] = 0u;
+                mbin[i] = bin_ranges[i][0];
+            }
+        }
+    }
+
+    /// Collect the values in a zone of bins around the point @param p
+    template <typename point_t, typename neighbor_t>
+    DETRAY_HOST auto zone(const point_t &p,
+                          const neighborhood_type<neighbor_t> &nhood,
+                          const bool sort) const
+        -> dvector<std::remove_const_t<value_type>> {
+        n_axis::multi_bin_range<Dim> bin_ranges{};
+        n_axis::multi_bin<Dim> n_zone_bins{};
+        const dindex n_zone{zone_bins(p, nhood, bin_ranges, n_zone_bins)};
+
+        dvector<std::remove_const_t<value_type>> values;
+        values.reserve(n_zone);
+        visit_bins(bin_ranges, n_zone_bins, n_zone,
+                   [&values](const value_type &entry) {
+                       values.push_back(entry);
+                   });
+        if constexpr (std::is_arithmetic_v<value_type>) {
+            if (sort) {
+                std::sort(values.begin(), values.end());
+            }
+        }
+        return values;
+    }
+
+    /// @returns the number of bins, or zero if the grid was not filled
+    DETRAY_HOST_DEVICE constexpr auto n_filled_bins() const -> dindex {
+        return data().bin_data()->size() == 0u
+                   ? 0u
+                   : static_cast<dindex>(nbins());
+    }
+
+    /// @returns the number of valid entries in the bin @param gbin
+    DETRAY_HOST_DEVICE constexpr auto n_entries(const dindex gbin) const
+        -> unsigned int {
+        unsigned int n{0u};
+        for (const auto &entry : at(gbin)) {
+            if constexpr (std::is_arithmetic_v<value_type>) {
+                if (entry == detail::invalid_value<value_type>()) {
+                    continue;
+                }
+            }
+            ++n;
+        }
+        return n;
+    }
+
     /// Struct that contains the grid's data state
     storage_type m_data{};
     /// The axes of the grid
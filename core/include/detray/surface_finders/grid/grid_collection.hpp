@@ -17,6 +17,7 @@
 // System include(s).
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace detray {
 
@@ -47,8 +48,7 @@ class grid_collection<
     using grid_type =
         detray::grid<multi_axis_t, value_t, serializer_t, populator_t>;
     using const_grid_type =
-        const detray::grid<const multi_axis_t, const value_t, serializer_t,
-                           populator_t>;
+        detray::grid<multi_axis_t, const value_t, serializer_t, populator_t>;
     using value_type = grid_type;
     using size_type = dindex;
 
@@ -175,21 +175,75 @@ class grid_collection<
     DETRAY_HOST constexpr auto push_back(
         const typename grid_type::template type<true> &gr) noexcept(false)
         -> void {
-        m_offsets.push_back(m_bins.size());
+        m_offsets.push_back(static_cast<size_type>(m_bins.size()));
 
         const auto *grid_bins = gr.data().bin_data();
         m_bins.insert(m_bins.end(), grid_bins->begin(), grid_bins->end());
 
-        const auto *axes_data = gr.axes().data().axes_data();
-        m_axes_data.insert(m_axes_data.end(), axes_data->begin(),
-                           axes_data->end());
+        // The axes of the grid index into its own bin edges
+        append_axes_data(*(gr.axes().data().axes_data()),
+                         static_cast<dindex>(m_bin_edges.size()));
 
         const auto *bin_edges = gr.axes().data().edges();
         m_bin_edges.insert(m_bin_edges.end(), bin_edges->begin(),
                            bin_edges->end());
     }
 
+    /// Append all grids of the collection @param other to this collection
+    DETRAY_HOST auto append(const grid_collection &other) noexcept(false)
+        -> void {
+        const auto bin_offset{static_cast<size_type>(m_bins.size())};
+        for (const size_type offset : other.m_offsets) {
+            m_offsets.push_back(bin_offset + offset);
+        }
+
+        m_bins.insert(m_bins.end(), other.m_bins.begin(), other.m_bins.end());
+
+        append_axes_data(other.m_axes_data,
+                         static_cast<dindex>(m_bin_edges.size()));
+
+        m_bin_edges.insert(m_bin_edges.end(), other.m_bin_edges.begin(),
+                           other.m_bin_edges.end());
+    }
+
     private:
+    /// Append the axes data @param axes_data of one or more grids and shift
+    /// their ranges by @param edges_offset, so that they point into the bin
+    /// edges storage of the collection
+    template <typename storage_t>
+    DETRAY_HOST auto append_axes_data(const storage_t &axes_data,
+                                      const dindex edges_offset) -> void {
+        for (std::size_t i = 0u; i < axes_data.size(); i += grid_type::Dim) {
+            append_axes_data(&axes_data[i], edges_offset,
+                             std::make_index_sequence<grid_type::Dim>{});
+        }
+    }
+
+    /// Unroll the axes of a single grid
+    template <std::size_t... I>
+    DETRAY_HOST auto append_axes_data(const dindex_range *axes_ranges,
+                                      const dindex edges_offset,
+                                      std::index_sequence<I...>) -> void {
+        (append_axis_data<I>(axes_ranges[I], edges_offset), ...);
+    }
+
+    /// Shift the range of the axis @tparam I by @param edges_offset: For
+    /// regular axes, only the first entry is an offset, the second is the
+    /// number of bins
+    template <std::size_t I>
+    DETRAY_HOST auto append_axis_data(dindex_range range,
+                                      const dindex edges_offset) -> void {
+        using axis_t = decltype(
+            std::declval<const multi_axis_t &>().template get_axis<I>());
+
+        detail::get<0>(range) += edges_offset;
+        if constexpr (axis_t::binning_type::type ==
+                      n_axis::binning::e_irregular) {
+            detail::get<1>(range) += edges_offset;
+        }
+        m_axes_data.push_back(range);
+    }
+
     /// Offsets for the respective grids into the bin storage
     vector_type<size_type> m_offsets{};
     /// Contains the bin content for all grids
@@ -13,8 +13,30 @@
 #include "detray/definitions/qualifiers.hpp"
 #include "detray/surface_finders/grid/detail/populator_impl.hpp"
 
+// System include(s)
+#include <type_traits>
+#include <utility>
+
 namespace detray {
 
+namespace detail {
+
+/// Check whether a populator implementation can fill many entries at once
+/// @{
+template <typename impl_t, typename storage_t, typename bin_entries_t,
+          typename = void>
+struct has_fill : public std::false_type {};
+
+template <typename impl_t, typename storage_t, typename bin_entries_t>
+struct has_fill<impl_t, storage_t, bin_entries_t,
+                std::void_t<decltype(impl_t::fill(
+                    std::declval<storage_t &>(),
+                    std::declval<const bin_entries_t &>()))>>
+    : public std::true_type {};
+/// @}
+
+}  // namespace detail
+
 /// Enforce the populator interface and implement some common functionality
 /// @todo remove this interface
 template <typename populator_impl_t>
@@ -44,6 +66,23 @@ class populator {
         }
     }
 
+    /// Populate the bins with a collection of entries at once
+    ///
+    /// @param storage the global bin storage
+    /// @param bin_entries range of pairs of a global bin index and an entry
+    template <typename serialized_storage, typename bin_entries_t>
+    DETRAY_HOST void fill(serialized_storage &storage,
+                          const bin_entries_t &bin_entries) const {
+        if constexpr (detail::has_fill<impl, serialized_storage,
+                                       bin_entries_t>::value) {
+            impl::fill(storage, bin_entries);
+        } else {
+            for (const auto &bin_entry : bin_entries) {
+                (*this)(storage, bin_entry.first, bin_entry.second);
+            }
+        }
+    }
+
     /// Fetch a bin entry from the grid backend storage
     template <typename serialized_storage>
     DETRAY_HOST_DEVICE auto view(const serialized_storage &storage,
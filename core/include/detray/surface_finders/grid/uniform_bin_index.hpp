@@ -0,0 +1,232 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/containers.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/definitions/qualifiers.hpp"
+#include "detray/surface_finders/grid/axis.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+namespace detray {
+
+/// @brief Uniform lookup table that accelerates the bin search on the
+/// irregular axes of a grid.
+///
+/// Every irregular axis is covered by a fine regular binning (the cells),
+/// which is at least as fine as the narrowest bin of the axis. Each cell
+/// stores the number of lower bin edges of the axis that lie below the cell.
+/// A lookup then maps the value to its cell in constant time and corrects
+/// the stored edge position by at most a few steps, instead of running a
+/// binary search over all bin edges. Regular axes are looked up directly.
+///
+/// @note The table has to be rebuilt whenever the bin edges of the axes
+/// change.
+///
+/// @tparam scalar_t the scalar type of the axes
+/// @tparam container_t type collection of the underlying containers
+template <typename scalar_t, typename container_t = host_container_types>
+class uniform_bin_index {
+
+    public:
+    /// Regular index of an axis into the cells table
+    struct axis_index {
+        /// Lower edge of the axis span
+        scalar_t min{0.f};
+        /// Inverse width of the cells
+        scalar_t inv_width{0.f};
+        /// Position of the first cell of this axis in the cells table
+        dindex offset{0u};
+        /// Number of cells, zero if the axis is looked up directly
+        dindex n_cells{0u};
+    };
+
+    template <typename T>
+    using vector_type = typename container_t::template vector_type<T>;
+
+    /// Vecmem based view type
+    using view_type =
+        dmulti_view<dvector_view<axis_index>, dvector_view<dindex>>;
+    using const_view_type =
+        dmulti_view<dvector_view<const axis_index>, dvector_view<const dindex>>;
+
+    /// Default constructor
+    uniform_bin_index() = default;
+
+    /// Constructor with specific vecmem memory resource
+    DETRAY_HOST
+    explicit uniform_bin_index(vecmem::memory_resource &resource)
+        : m_axes(&resource), m_cells(&resource) {}
+
+    /// Device-side construction from a vecmem based view type
+    template <typename view_t,
+              typename std::enable_if_t<
+                  detray::detail::is_device_view_v<view_t>, bool> = true>
+    DETRAY_HOST_DEVICE uniform_bin_index(const view_t &view)
+        : m_axes(detray::detail::get<0>(view.m_view)),
+          m_cells(detray::detail::get<1>(view.m_view)) {}
+
+    /// @returns true if the table has not been built
+    DETRAY_HOST_DEVICE
+    bool empty() const { return m_axes.empty(); }
+
+    /// @returns the total number of cells over all axes
+    DETRAY_HOST_DEVICE
+    std::size_t n_cells() const { return m_cells.size(); }
+
+    /// Build the lookup table for the axes @param axes
+    ///
+    /// @param max_cells the maximal number of cells per irregular axis
+    template <typename multi_axis_t>
+    DETRAY_HOST void build(const multi_axis_t &axes,
+                           const dindex max_cells = 4096u) {
+        m_axes.clear();
+        m_cells.clear();
+        // The axes have not been built
+        if (axes.data().edges()->empty()) {
+            return;
+        }
+        build(axes, max_cells,
+              std::make_index_sequence<std::size_t{multi_axis_t::Dim}>{});
+    }
+
+    /// Query the bin index for every coordinate of the point @param p on
+    /// the axes @param axes, which the table was built for.
+    ///
+    /// @returns a multi bin that contains the resulting bin indices for
+    ///          every axis (the same as @c axes.bins(p))
+    template <typename multi_axis_t, typename point_t>
+    DETRAY_HOST_DEVICE auto bins(const multi_axis_t &axes,
+                                 const point_t &p) const
+        -> n_axis::multi_bin<multi_axis_t::Dim> {
+        n_axis::multi_bin<multi_axis_t::Dim> bin_indices{};
+        bins(axes, p, bin_indices,
+             std::make_index_sequence<std::size_t{multi_axis_t::Dim}>{});
+        return bin_indices;
+    }
+
+    /// @returns a vecmem view on the table data
+    DETRAY_HOST auto get_data() -> view_type {
+        return {detray::get_data(m_axes), detray::get_data(m_cells)};
+    }
+
+    /// @returns a vecmem const view on the table data
+    DETRAY_HOST auto get_data() const -> const_view_type {
+        return {detray::get_data(m_axes), detray::get_data(m_cells)};
+    }
+
+    private:
+    /// Unroll the table construction over all axes
+    template <typename multi_axis_t, std::size_t... I>
+    DETRAY_HOST void build(const multi_axis_t &axes, const dindex max_cells,
+                           std::index_sequence<I...>) {
+        (add_axis(axes.template get_axis<I>(), max_cells), ...);
+    }
+
+    /// Build the cells for a single axis @param ax
+    template <typename axis_t>
+    DETRAY_HOST void add_axis(const axis_t &ax, const dindex max_cells) {
+        axis_index idx{};
+        idx.min = ax.min();
+        idx.offset = static_cast<dindex>(m_cells.size());
+
+        const auto n_bins{static_cast<dindex>(ax.m_binning.nbins())};
+        const scalar_t span{ax.max() - ax.min()};
+
+        if constexpr (axis_t::binning_type::type ==
+                      n_axis::binning::e_irregular) {
+            if (n_bins > 0u and span > 0.f) {
+                // The cells have to resolve the narrowest bin
+                scalar_t min_width{span};
+                for (dindex ib = 0u; ib < n_bins; ++ib) {
+                    const auto edges = ax.bin_edges(ib);
+                    const scalar_t width{edges[1] - edges[0]};
+                    min_width = (width > 0.f and width < min_width)
+                                    ? width
+                                    : min_width;
+                }
+                auto n_cells{static_cast<dindex>(std::ceil(span / min_width))};
+                n_cells = n_cells < n_bins ? n_bins : n_cells;
+                n_cells = n_cells > max_cells ? max_cells : n_cells;
+
+                idx.n_cells = n_cells;
+                idx.inv_width = static_cast<scalar_t>(n_cells) / span;
+
+                // Number of lower bin edges below the lower edge of each cell
+                dindex pos{0u};
+                for (dindex c = 0u; c < n_cells; ++c) {
+                    const scalar_t lower{ax.min() + static_cast<scalar_t>(c) /
+                                                        idx.inv_width};
+                    while (pos < n_bins and ax.bin_edges(pos)[0] <= lower) {
+                        ++pos;
+                    }
+                    m_cells.push_back(pos);
+                }
+            }
+        }
+
+        m_axes.push_back(idx);
+    }
+
+    /// Unroll the bin lookup over all axes
+    template <typename multi_axis_t, typename point_t, std::size_t... I>
+    DETRAY_HOST_DEVICE void bins(
+        const multi_axis_t &axes, const point_t &p,
+        n_axis::multi_bin<multi_axis_t::Dim> &bin_indices,
+        std::index_sequence<I...>) const {
+        (single_axis<multi_axis_t>(axes.template get_axis<I>(), m_axes[I], p,
+                                   bin_indices),
+         ...);
+    }
+
+    /// Perform the bin lookup on a single axis @param ax with the help of
+    /// its table index @param idx
+    template <typename multi_axis_t, typename axis_t, typename point_t>
+    DETRAY_HOST_DEVICE void single_axis(
+        const axis_t &ax, const axis_index &idx, const point_t &p,
+        n_axis::multi_bin<multi_axis_t::Dim> &bin_indices) const {
+        // Get the index corresponding to the axis label (e.g. bin_x <=> 0)
+        constexpr dindex loc_idx{
+            multi_axis_t::axis_reg::to_index(axis_t::bounds_type::label)};
+        const scalar_t v{p[loc_idx]};
+
+        if constexpr (axis_t::binning_type::type ==
+                      n_axis::binning::e_irregular) {
+            if (idx.n_cells > 0u) {
+                const scalar_t f{(v - idx.min) * idx.inv_width};
+                // Clamp to the table (also catches NaN)
+                dindex cell{0u};
+                if (f >= static_cast<scalar_t>(idx.n_cells)) {
+                    cell = idx.n_cells - 1u;
+                } else if (f > 0.f) {
+                    cell = static_cast<dindex>(f);
+                }
+                bin_indices.indices[loc_idx] =
+                    ax.bin(v, m_cells[idx.offset + cell]);
+                return;
+            }
+        }
+        bin_indices.indices[loc_idx] = ax.bin(v);
+    }
+
+    /// Regular index per axis
+    vector_type<axis_index> m_axes;
+    /// Number of lower bin edges per cell for all irregular axes
+    vector_type<dindex> m_cells;
+};
+
+}  // namespace detray
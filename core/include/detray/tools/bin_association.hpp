@@ -1,4 +1,3 @@
-
 /** Detray library, part of the ACTS project (R&D line)
  *
  * (c) 2021-2023 CERN for the benefit of the ACTS project
@@ -10,18 +9,181 @@
 
 // Project include(s)
 #include "detray/definitions/units.hpp"
+#include "detray/surface_finders/grid/detail/axis_helpers.hpp"
 #include "detray/tools/associator.hpp"
 #include "detray/tools/generators.hpp"
 #include "detray/utils/ranges.hpp"
 
 // System include(s)
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace detray {
 
+namespace detail {
+
+/// @brief The contours of a surface in the local frame of a grid.
+///
+/// Calculated once per surface before the bin association is run.
+template <typename surface_t, typename point2_t>
+struct surface_contours {
+    /// The surface that should be associated
+    surface_t sf;
+    /// One or more contours per surface mask (e.g. if the surface is split
+    /// at the phi boundary)
+    std::vector<std::vector<std::vector<point2_t>>> mask_contours{};
+    /// Axis aligned bounding box of all contours: (min_0, min_1, max_0, max_1)
+    std::array<scalar, 4> bbox{
+        std::numeric_limits<scalar>::max(), std::numeric_limits<scalar>::max(),
+        -std::numeric_limits<scalar>::max(),
+        -std::numeric_limits<scalar>::max()};
+};
+
+/// @returns the axis aligned bounding box of a @param contour, enlarged by a
+/// small margin, so that the bounding box check never rejects a surface
+/// that the associators would accept.
+template <typename point2_t>
+inline std::array<scalar, 4> contour_bbox(
+    const std::vector<point2_t> &contour) {
+    std::array<scalar, 4> bbox{
+        std::numeric_limits<scalar>::max(), std::numeric_limits<scalar>::max(),
+        -std::numeric_limits<scalar>::max(),
+        -std::numeric_limits<scalar>::max()};
+    for (const auto &p : contour) {
+        bbox[0] = std::min(p[0], bbox[0]);
+        bbox[1] = std::min(p[1], bbox[1]);
+        bbox[2] = std::max(p[0], bbox[2]);
+        bbox[3] = std::max(p[1], bbox[3]);
+    }
+    for (unsigned int i = 0u; i < 2u; ++i) {
+        const scalar margin{
+            1e-3f * (bbox[i + 2u] - bbox[i]) +
+            1e-4f * std::max(std::abs(bbox[i]), std::abs(bbox[i + 2u])) +
+            1e-4f};
+        bbox[i] -= margin;
+        bbox[i + 2u] += margin;
+    }
+    return bbox;
+}
+
+/// @returns whether the bounding boxes @param a and @param b overlap
+inline bool bbox_overlap(const std::array<scalar, 4> &a,
+                         const std::array<scalar, 4> &b) {
+    return a[0] <= b[2] and b[0] <= a[2] and a[1] <= b[3] and b[1] <= a[3];
+}
+
+/// Associate the precomputed surface contours to the bins of a 2D grid.
+///
+/// The bins are split into blocks that are processed in parallel. Only the
+/// surfaces whose bounding box overlaps with the bin are tested. Afterwards,
+/// the grid is filled in the same order as a sequential loop over the bins
+/// and surfaces would do, so that the resulting grid does not depend on the
+/// number of threads.
+///
+/// @param grid the grid to be filled
+/// @param contours the surface contours in the local frame of the grid
+/// @param bin_contour_fn creates the (tolerance enlarged) contour of a bin
+/// @param n_threads number of threads (0: hardware concurrency)
+template <typename cog_assoc_t, typename edges_assoc_t, typename grid_t,
+          typename contour_t, typename bin_contour_fn_t>
+inline void associate_contours(grid_t &grid,
+                               const std::vector<contour_t> &contours,
+                               const bin_contour_fn_t &bin_contour_fn,
+                               unsigned int n_threads) {
+
+    const auto &axis_0 = grid.template get_axis<0>();
+    const auto &axis_1 = grid.template get_axis<1>();
+    const dindex n_bins_0{static_cast<dindex>(axis_0.nbins())};
+    const dindex n_bins_1{static_cast<dindex>(axis_1.nbins())};
+    const dindex n_bins{n_bins_0 * n_bins_1};
+
+    // Indices of the associated surface contours per bin
+    std::vector<std::vector<dindex>> associations(n_bins);
+
+    // Associate the surfaces to a block of bins
+    auto associate_block = [&](const dindex first, const dindex last) {
+        cog_assoc_t cgs_assoc;
+        edges_assoc_t edges_assoc;
+
+        for (dindex bin = first; bin < last; ++bin) {
+            const auto bin_contour =
+                bin_contour_fn(bin / n_bins_1, bin % n_bins_1);
+            const auto bin_bbox = contour_bbox(bin_contour);
+
+            for (dindex i = 0u; i < contours.size(); ++i) {
+                const contour_t &sf_contours = contours[i];
+                if (not bbox_overlap(bin_bbox, sf_contours.bbox)) {
+                    continue;
+                }
+                // Usually one mask per surface, but design allows - a
+                // single association  is sufficient though
+                bool associated = false;
+                for (const auto &split_contours : sf_contours.mask_contours) {
+                    for (const auto &s_c : split_contours) {
+                        if (cgs_assoc(bin_contour, s_c) or
+                            edges_assoc(bin_contour, s_c)) {
+                            associated = true;
+                            break;
+                        }
+                    }
+                    if (associated) {
+                        break;
+                    }
+                }
+                if (associated) {
+                    associations[bin].push_back(i);
+                }
+            }
+        }
+    };
+
+    if (n_threads == 0u) {
+        n_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    const dindex n_workers{
+        std::min(static_cast<dindex>(n_threads), std::max(n_bins, dindex{1u}))};
+
+    if (n_workers == 1u) {
+        associate_block(0u, n_bins);
+    } else {
+        const dindex block_size{(n_bins + n_workers - 1u) / n_workers};
+        std::vector<std::thread> workers;
+        workers.reserve(n_workers);
+        for (dindex first = 0u; first < n_bins; first += block_size) {
+            workers.emplace_back(associate_block, first,
+                                 std::min(first + block_size, n_bins));
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+
+    // Fill the grid in bin order
+    std::vector<std::pair<n_axis::multi_bin<2>, typename grid_t::value_type>>
+        bin_entries;
+    for (dindex bin = 0u; bin < n_bins; ++bin) {
+        for (const dindex i : associations[bin]) {
+            bin_entries.emplace_back(
+                n_axis::multi_bin<2>{{bin / n_bins_1, bin % n_bins_1}},
+                contours[i].sf);
+        }
+    }
+    grid.populate(bin_entries);
+}
+
+}  // namespace detail
+
 /// Run the bin association of surfaces (via their contour) to a given 2D grid.
 ///
+/// The surface contours are calculated once and the bins are tested against
+/// them in parallel.
+///
 /// @param context is the context to win which the association is done
 /// @param surfaces a range of detector surfaces
 /// @param transforms the transforms that belong to the surfaces
@@ -30,6 +192,7 @@ namespace detray {
 /// @param tolerance is the bin_tolerance in the two local coordinates
 /// @param absolute_tolerance is an indicator if the tolerance is to be
 ///        taken absolute or relative
+/// @param n_threads the number of threads (0: hardware concurrency)
 template <typename context_t, typename surface_container_t,
           typename transform_container_t, typename mask_container_t,
           typename grid_t, std::enable_if_t<grid_t::Dim == 2, bool> = true>
@@ -39,209 +202,174 @@ static inline void bin_association(const context_t & /*context*/,
                                    const mask_container_t &surface_masks,
                                    grid_t &grid,
                                    const std::array<scalar, 2> &bin_tolerance,
-                                   bool absolute_tolerance = true) {
+                                   bool absolute_tolerance = true,
+                                   unsigned int n_threads = 0u) {
 
     using transform_t = typename transform_container_t::value_type;
     using point2_t = typename transform_t::point2;
     using point3_t = typename transform_t::point3;
+    using surface_t = std::decay_t<decltype(*detray::ranges::begin(surfaces))>;
+    using contour_t = detail::surface_contours<surface_t, point2_t>;
 
     const auto &axis_0 = grid.template get_axis<0>();
     const auto &axis_1 = grid.template get_axis<1>();
 
-    // Disk type bin association
-    if constexpr (std::is_same_v<typename grid_t::local_frame,
-                                 polar2<transform_t>>) {
-        // Run with two different associators: center of gravity and edge
-        // intersection
-        center_of_gravity_generic cgs_assoc;
-        edges_intersect_generic edges_assoc;
-
-        // Loop over all bins and associate the surfaces
-        for (unsigned int bin_0 = 0; bin_0 < axis_0.nbins(); ++bin_0) {
-            for (unsigned int bin_1 = 0; bin_1 < axis_1.nbins(); ++bin_1) {
-
-                auto r_borders = axis_0.bin_edges(bin_0);
-                auto phi_borders = axis_1.bin_edges(bin_1);
-
-                scalar r_add =
-                    absolute_tolerance
-                        ? bin_tolerance[0]
-                        : bin_tolerance[0] * (r_borders[1] - r_borders[0]);
-                scalar phi_add =
-                    absolute_tolerance
-                        ? bin_tolerance[1]
-                        : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
-
-                // Create a contour for the bin
-                std::vector<point2_t> bin_contour =
-                    r_phi_polygon<scalar, point2_t>(
-                        r_borders[0] - r_add, r_borders[1] + r_add,
-                        phi_borders[0] - phi_add, phi_borders[1] + phi_add);
-
-                // Run through the surfaces and associate them by contour
-                for (auto sf : surfaces) {
-
-                    // Add only sensitive surfaces to the grid
-                    if (sf.is_portal()) {
-                        continue;
-                    }
+    // Calculate the contours of the surfaces in the local grid frame once
+    std::vector<contour_t> contours;
+    for (const auto &sf : surfaces) {
 
-                    // Unroll the mask container and generate vertices
-                    const auto &transform = transforms[sf.transform()];
-
-                    auto vertices_per_masks =
-                        surface_masks
-                            .template visit<vertexer<point2_t, point3_t>>(
-                                sf.mask());
-
-                    // Usually one mask per surface, but design allows - a
-                    // single association  is sufficient though
-                    for (auto &vertices : vertices_per_masks) {
-                        if (not vertices.empty()) {
-                            // Create a surface contour
-                            std::vector<point2_t> surface_contour;
-                            surface_contour.reserve(vertices.size());
-                            for (const auto &v : vertices) {
-                                auto vg = transform.point_to_global(v);
-                                surface_contour.push_back({vg[0], vg[1]});
-                            }
-                            // The association has worked
-                            if (cgs_assoc(bin_contour, surface_contour) or
-                                edges_assoc(bin_contour, surface_contour)) {
-                                grid.populate({bin_0, bin_1}, sf);
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
+        // Add only sensitive surfaces to the grid
+        if (sf.is_portal()) {
+            continue;
         }
-    } else if constexpr (std::is_same_v<typename grid_t::local_frame,
-                                        cylindrical2<transform_t>>) {
 
-        center_of_gravity_rectangle cgs_assoc;
-        edges_intersect_generic edges_assoc;
+        contour_t sf_contours{sf};
 
-        // Loop over all bins and associate the surfaces
-        for (unsigned int bin_0 = 0; bin_0 < axis_0.nbins(); ++bin_0) {
-            for (unsigned int bin_1 = 0; bin_1 < axis_1.nbins(); ++bin_1) {
+        // Unroll the mask container and generate vertices
+        const auto &transform = transforms[sf.transform()];
 
-                auto z_borders = axis_0.bin_edges(bin_0);
-                auto phi_borders = axis_1.bin_edges(bin_1);
+        auto vertices_per_masks =
+            surface_masks.template visit<vertexer<point2_t, point3_t>>(
+                sf.mask());
 
-                scalar z_add =
-                    absolute_tolerance
-                        ? bin_tolerance[0]
-                        : bin_tolerance[0] * (z_borders[1] - z_borders[0]);
-                scalar phi_add =
-                    absolute_tolerance
-                        ? bin_tolerance[1]
-                        : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
+        for (auto &vertices : vertices_per_masks) {
+            if (vertices.empty()) {
+                continue;
+            }
 
-                scalar z_min = z_borders[0];
-                scalar z_max = z_borders[1];
-                scalar phi_min_rep = phi_borders[0];
-                scalar phi_max_rep = phi_borders[1];
+            // Disk type bin association
+            if constexpr (std::is_same_v<typename grid_t::local_frame,
+                                         polar2<transform_t>>) {
+                // Create a surface contour
+                std::vector<point2_t> surface_contour;
+                surface_contour.reserve(vertices.size());
+                for (const auto &v : vertices) {
+                    auto vg = transform.point_to_global(v);
+                    surface_contour.push_back({vg[0], vg[1]});
+                }
+                sf_contours.mask_contours.push_back({surface_contour});
+
+            } else if constexpr (std::is_same_v<typename grid_t::local_frame,
+                                                cylindrical2<transform_t>>) {
+                // Create a surface contour
+                std::vector<point2_t> surface_contour;
+                surface_contour.reserve(vertices.size());
+                scalar phi_min = std::numeric_limits<scalar>::max();
+                scalar phi_max = -std::numeric_limits<scalar>::max();
+                // We poentially need the split vertices
+                std::vector<point2_t> s_c_neg;
+                std::vector<point2_t> s_c_pos;
+                scalar z_min_neg = std::numeric_limits<scalar>::max();
+                scalar z_max_neg = -std::numeric_limits<scalar>::max();
+                scalar z_min_pos = std::numeric_limits<scalar>::max();
+                scalar z_max_pos = -std::numeric_limits<scalar>::max();
+
+                for (const auto &v : vertices) {
+                    const point3_t vg = transform.point_to_global(v);
+                    scalar phi = std::atan2(vg[1], vg[0]);
+                    phi_min = std::min(phi, phi_min);
+                    phi_max = std::max(phi, phi_max);
+                    surface_contour.push_back({vg[2], phi});
+                    if (phi < 0.) {
+                        s_c_neg.push_back({vg[2], phi});
+                        z_min_neg = std::min(vg[2], z_min_neg);
+                        z_max_neg = std::max(vg[2], z_max_neg);
+                    } else {
+                        s_c_pos.push_back({vg[2], phi});
+                        z_min_pos = std::min(vg[2], z_min_pos);
+                        z_max_pos = std::max(vg[2], z_max_pos);
+                    }
+                }
+                // Check for phi wrapping
+                if (phi_max - phi_min > constant<scalar>::pi and
+                    phi_max * phi_min < 0.) {
+                    s_c_neg.push_back({z_max_neg, -constant<scalar>::pi});
+                    s_c_neg.push_back({z_min_neg, -constant<scalar>::pi});
+                    s_c_pos.push_back({z_max_pos, constant<scalar>::pi});
+                    s_c_pos.push_back({z_min_pos, constant<scalar>::pi});
+                    sf_contours.mask_contours.push_back({s_c_neg, s_c_pos});
+                } else {
+                    sf_contours.mask_contours.push_back({surface_contour});
+                }
+            }
 
-                point2_t p0_bin = {z_min - z_add, phi_min_rep - phi_add};
-                point2_t p1_bin = {z_min - z_add, phi_max_rep + phi_add};
-                point2_t p2_bin = {z_max + z_add, phi_max_rep + phi_add};
-                point2_t p3_bin = {z_max + z_add, phi_min_rep - phi_add};
+            // Bounding box of all contours of the surface
+            for (const auto &s_c : sf_contours.mask_contours.back()) {
+                const auto bbox = detail::contour_bbox(s_c);
+                sf_contours.bbox[0] = std::min(bbox[0], sf_contours.bbox[0]);
+                sf_contours.bbox[1] = std::min(bbox[1], sf_contours.bbox[1]);
+                sf_contours.bbox[2] = std::max(bbox[2], sf_contours.bbox[2]);
+                sf_contours.bbox[3] = std::max(bbox[3], sf_contours.bbox[3]);
+            }
+        }
 
-                std::vector<point2_t> bin_contour = {p0_bin, p1_bin, p2_bin,
-                                                     p3_bin};
+        if (not sf_contours.mask_contours.empty()) {
+            contours.push_back(std::move(sf_contours));
+        }
+    }
 
-                // Loop over the surfaces within a volume
-                for (auto sf : surfaces) {
+    // Disk type bin association
+    if constexpr (std::is_same_v<typename grid_t::local_frame,
+                                 polar2<transform_t>>) {
 
-                    // Add only sensitive surfaces to the grid
-                    if (sf.is_portal()) {
-                        continue;
-                    }
+        // Create a contour for the bin
+        auto bin_contour = [&](const dindex bin_0, const dindex bin_1) {
+            auto r_borders = axis_0.bin_edges(bin_0);
+            auto phi_borders = axis_1.bin_edges(bin_1);
+
+            scalar r_add =
+                absolute_tolerance
+                    ? bin_tolerance[0]
+                    : bin_tolerance[0] * (r_borders[1] - r_borders[0]);
+            scalar phi_add =
+                absolute_tolerance
+                    ? bin_tolerance[1]
+                    : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
+
+            return r_phi_polygon<scalar, point2_t>(
+                r_borders[0] - r_add, r_borders[1] + r_add,
+                phi_borders[0] - phi_add, phi_borders[1] + phi_add);
+        };
 
-                    // Unroll the mask container and generate vertices
-                    const auto &transform = transforms[sf.transform()];
-
-                    auto vertices_per_masks =
-                        surface_masks
-                            .template visit<vertexer<point2_t, point3_t>>(
-                                sf.mask());
-
-                    for (auto &vertices : vertices_per_masks) {
-
-                        if (not vertices.empty()) {
-                            // Create a surface contour
-                            std::vector<point2_t> surface_contour;
-                            surface_contour.reserve(vertices.size());
-                            scalar phi_min = std::numeric_limits<scalar>::max();
-                            scalar phi_max =
-                                -std::numeric_limits<scalar>::max();
-                            // We poentially need the split vertices
-                            std::vector<point2_t> s_c_neg;
-                            std::vector<point2_t> s_c_pos;
-                            scalar z_min_neg =
-                                std::numeric_limits<scalar>::max();
-                            scalar z_max_neg =
-                                -std::numeric_limits<scalar>::max();
-                            scalar z_min_pos =
-                                std::numeric_limits<scalar>::max();
-                            scalar z_max_pos =
-                                -std::numeric_limits<scalar>::max();
-
-                            for (const auto &v : vertices) {
-                                const point3_t vg =
-                                    transform.point_to_global(v);
-                                scalar phi = std::atan2(vg[1], vg[0]);
-                                phi_min = std::min(phi, phi_min);
-                                phi_max = std::max(phi, phi_max);
-                                surface_contour.push_back({vg[2], phi});
-                                if (phi < 0.) {
-                                    s_c_neg.push_back({vg[2], phi});
-                                    z_min_neg = std::min(vg[2], z_min_neg);
-                                    z_max_neg = std::max(vg[2], z_max_neg);
-                                } else {
-                                    s_c_pos.push_back({vg[2], phi});
-                                    z_min_pos = std::min(vg[2], z_min_pos);
-                                    z_max_pos = std::max(vg[2], z_max_pos);
-                                }
-                            }
-                            // Check for phi wrapping
-                            std::vector<std::vector<point2_t>> surface_contours;
-                            if (phi_max - phi_min > constant<scalar>::pi and
-                                phi_max * phi_min < 0.) {
-                                s_c_neg.push_back(
-                                    {z_max_neg, -constant<scalar>::pi});
-                                s_c_neg.push_back(
-                                    {z_min_neg, -constant<scalar>::pi});
-                                s_c_pos.push_back(
-                                    {z_max_pos, constant<scalar>::pi});
-                                s_c_pos.push_back(
-                                    {z_min_pos, constant<scalar>::pi});
-                                surface_contours = {s_c_neg, s_c_pos};
-                            } else {
-                                surface_contours = {surface_contour};
-                            }
-
-                            // Check the association (with potential splits)
-                            bool associated = false;
-                            for (const auto &s_c : surface_contours) {
-                                if (cgs_assoc(bin_contour, s_c) or
-                                    edges_assoc(bin_contour, s_c)) {
-                                    associated = true;
-                                    break;
-                                }
-                            }
-
-                            // Register if associated
-                            if (associated) {
-                                grid.populate({{bin_0, bin_1}}, sf);
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
-        }
+        // Run with two different associators: center of gravity and edge
+        // intersection
+        detail::associate_contours<center_of_gravity_generic,
+                                   edges_intersect_generic>(
+            grid, contours, bin_contour, n_threads);
+
+    } else if constexpr (std::is_same_v<typename grid_t::local_frame,
+                                        cylindrical2<transform_t>>) {
+
+        // Create a contour for the bin
+        auto bin_contour = [&](const dindex bin_0, const dindex bin_1) {
+            auto z_borders = axis_0.bin_edges(bin_0);
+            auto phi_borders = axis_1.bin_edges(bin_1);
+
+            scalar z_add =
+                absolute_tolerance
+                    ? bin_tolerance[0]
+                    : bin_tolerance[0] * (z_borders[1] - z_borders[0]);
+            scalar phi_add =
+                absolute_tolerance
+                    ? bin_tolerance[1]
+                    : bin_tolerance[1] * (phi_borders[1] - phi_borders[0]);
+
+            scalar z_min = z_borders[0];
+            scalar z_max = z_borders[1];
+            scalar phi_min_rep = phi_borders[0];
+            scalar phi_max_rep = phi_borders[1];
+
+            point2_t p0_bin = {z_min - z_add, phi_min_rep - phi_add};
+            point2_t p1_bin = {z_min - z_add, phi_max_rep + phi_add};
+            point2_t p2_bin = {z_max + z_add, phi_max_rep + phi_add};
+            point2_t p3_bin = {z_max + z_add, phi_min_rep - phi_add};
+
+            return std::vector<point2_t>{p0_bin, p1_bin, p2_bin, p3_bin};
+        };
+
+        detail::associate_contours<center_of_gravity_rectangle,
+                                   edges_intersect_generic>(
+            grid, contours, bin_contour, n_threads);
     }
 }
 
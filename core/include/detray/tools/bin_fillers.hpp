@@ -13,6 +13,7 @@
 
 // System include(s)
 #include <cassert>
+#include <utility>
 #include <vector>
 
 namespace detray::detail {
@@ -52,9 +53,14 @@ struct fill_by_bin {
         const mask_container &,
         const typename transform_container::context_type,
         std::vector<bin_data<grid_t>> &bins) const -> void {
+        std::vector<std::pair<n_axis::multi_bin<grid_t::Dim>,
+                              typename grid_t::value_type>>
+            bin_entries;
+        bin_entries.reserve(bins.size());
         for (const bin_data<grid_t> &bd : bins) {
-            grid.populate(bd.local_bin_idx, bd.single_element);
+            bin_entries.emplace_back(bd.local_bin_idx, bd.single_element);
         }
+        grid.populate(bin_entries);
     }
 };
 
@@ -85,6 +91,10 @@ struct fill_by_pos {
         const typename transform_container::context_type ctx, Args &&...) const
         -> void {
 
+        std::vector<std::pair<n_axis::multi_bin<grid_t::Dim>,
+                              typename grid_t::value_type>>
+            bin_entries;
+
         // Fill the volumes surfaces into the grid
         for (const auto &sf : surfaces) {
             // TODO: Remove this check after toy geo is switched to new builders
@@ -99,8 +109,9 @@ struct fill_by_pos {
             // transform to axis coordinate system
             const auto loc_pos = grid.global_to_local(
                 typename transform_container::value_type{}, t, t);
-            grid.populate(loc_pos, sf);
+            bin_entries.emplace_back(grid.axes().bins(loc_pos), sf);
         }
+        grid.populate(bin_entries);
     }
 };
 
@@ -114,6 +114,7 @@ class grid_builder final : public volume_decorator<detector_t> {
         constexpr auto gid{detector_t::sf_finders::template get_id<grid_t>()};
         det.surface_store().template push_back<gid>(m_grid);
         vol_ptr->set_link(gid, det.surface_store().template size<gid>() - 1);
+        det.update_navigation_info(*vol_ptr, ctx);
 
         return vol_ptr;
     }
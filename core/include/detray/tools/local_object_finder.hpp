@@ -41,9 +41,9 @@ struct local_zone_finder {
      * @note return a binned zone around a bin
      **/
     auto operator()(const point2 &p2,
-                    const typename grid_t::template neighborhood<dindex>
-                        &nhood = grid_t::hermit2) const {
-        return _grid.zone(p2, nhood, _sort);
+                    const typename grid_t::template neighborhood_type<dindex>
+                        &nhood = {}) const {
+        return _grid.search(p2, nhood, _sort);
     }
 
     /** Call operator for the object search with scalar neighborhood
@@ -55,10 +55,10 @@ struct local_zone_finder {
      *
      * @note return a binned zone around a bin
      **/
-    auto operator()(
-        const point2 &p2,
-        const typename grid_t::template neighborhood<scalar> &nhood) const {
-        return _grid.zone(p2, nhood, _sort);
+    auto operator()(const point2 &p2,
+                    const typename grid_t::template neighborhood_type<scalar>
+                        &nhood) const {
+        return _grid.search(p2, nhood, _sort);
     }
 
     /** Const access to the grid */
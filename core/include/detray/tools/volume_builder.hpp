@@ -9,6 +9,7 @@
 
 // Project include(s).
 #include "detray/definitions/geometry.hpp"
+#include "detray/geometry/surface.hpp"
 #include "detray/tools/volume_builder_interface.hpp"
 
 // System include(s)
@@ -113,6 +114,7 @@ class volume_builder : public volume_builder_interface<detector_t> {
         // Update mask and transform index of surfaces and set a
         // unique barcode (index of surface in container)
         auto sf_offset = det.surfaces().size();
+        detail::group_by_mask_type(m_surfaces);
         for (auto& sf : m_surfaces) {
             det.mask_store().template visit<detail::mask_index_update>(
                 sf.mask(), sf);
@@ -135,6 +137,8 @@ class volume_builder : public volume_builder_interface<detector_t> {
 
         // Append masks
         det.append_masks(std::move(m_masks));
+
+        det.update_navigation_info(*m_volume, ctx);
     }
 
     typename detector_t::volume_type* m_volume{};
@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2022 CERN for the benefit of the ACTS project
+ * (c) 2022-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -130,4 +130,17 @@ template <typename T, typename... Ts>
 inline constexpr std::size_t get_type_pos_v = get_type_pos<T, Ts...>::value;
 /// @}
 
+/// Check whether a data collection holds grids, e.g. a @c grid_collection
+/// @{
+template <typename T, typename = void>
+struct is_grid_collection : public std::false_type {};
+
+template <typename T>
+struct is_grid_collection<T, std::void_t<typename T::grid_type>>
+    : public std::true_type {};
+
+template <typename T>
+inline constexpr bool is_grid_collection_v = is_grid_collection<T>::value;
+/// @}
+
 }  // namespace detray::detail
\ No newline at end of file
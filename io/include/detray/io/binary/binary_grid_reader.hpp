@@ -0,0 +1,49 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/binary/binary_grids_io.hpp"
+#include "detray/io/common/detail/file_handle.hpp"
+#include "detray/io/common/grid_reader.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <ios>
+#include <string>
+
+namespace detray {
+
+/// @brief Class that reads the grids of a tracking geometry from the binary
+/// file that was written by the @c binary_grid_writer
+template <class detector_t>
+class binary_grid_reader final : public grid_reader<detector_t> {
+
+    using base_reader = grid_reader<detector_t>;
+
+    public:
+    /// File is expected with a fixed @param extension
+    binary_grid_reader() : grid_reader<detector_t>("dat") {}
+
+    /// Reads the grids from the file with a given name
+    virtual void read(detector_t &det, vecmem::memory_resource &resource,
+                      const std::string &name) override {
+        io::detail::file_handle file{
+            name + "_grids", this->m_file_extension,
+            std::ios_base::in | std::ios_base::binary};
+
+        detector_payload det_data;
+        from_binary(*file, det_data);
+
+        base_reader::deserialize(det_data, det, resource);
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,47 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/binary/binary_grids_io.hpp"
+#include "detray/io/common/detail/file_handle.hpp"
+#include "detray/io/common/geometry_writer.hpp"
+
+// System include(s)
+#include <ios>
+#include <string>
+
+namespace detray {
+
+/// @brief Class that writes the volume grid and the surface grids of a
+/// tracking geometry to a compact binary file
+template <class detector_t>
+class binary_grid_writer final : public geometry_writer<detector_t> {
+
+    using base_writer = geometry_writer<detector_t>;
+
+    public:
+    /// File gets created with a fixed @param extension
+    binary_grid_writer() : geometry_writer<detector_t>("dat") {}
+
+    /// Writes the grids to file with a given name
+    virtual void write(const detector_t &det,
+                       const std::string &name) override {
+        // Create a new file
+        io::detail::file_handle file{
+            name + "_grids", this->m_file_extension,
+            std::ios_base::out | std::ios_base::binary};
+
+        detector_payload det_data;
+        base_writer::serialize_grids(det, det_data);
+
+        to_binary(*file, det_data);
+    }
+};
+
+}  // namespace detray
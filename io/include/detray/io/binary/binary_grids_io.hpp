@@ -0,0 +1,196 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/io/common/payloads.hpp"
+
+// System include(s)
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/// @brief Compact binary format for the grid payloads.
+///
+/// All values are written in the native byte order of the host. The bin
+/// content of a grid is stored as the number of entries per bin, followed by
+/// all entries.
+namespace detray {
+
+namespace io::detail {
+
+/// Identifies a binary grid file ("DGRD") and its format version
+inline constexpr std::uint32_t grids_magic{0x44524744u};
+inline constexpr std::uint32_t grids_version{1u};
+
+/// Write the trivially copyable value @param v to the stream @param os
+template <typename T>
+inline void write_binary(std::ostream& os, const T& v) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    os.write(reinterpret_cast<const char*>(&v), sizeof(T));
+}
+
+/// Write the size and the values of the vector @param v to the stream
+/// @param os
+template <typename T>
+inline void write_binary(std::ostream& os, const std::vector<T>& v) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    write_binary(os, static_cast<std::uint64_t>(v.size()));
+    os.write(reinterpret_cast<const char*>(v.data()),
+             static_cast<std::streamsize>(v.size() * sizeof(T)));
+}
+
+/// Read the trivially copyable value @param v from the stream @param is
+template <typename T>
+inline void read_binary(std::istream& is, T& v) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    is.read(reinterpret_cast<char*>(&v), sizeof(T));
+    if (!is) {
+        throw std::runtime_error("ERROR: Unexpected end of binary grid data");
+    }
+}
+
+/// Read the size and the values of the vector @param v from the stream
+/// @param is
+template <typename T>
+inline void read_binary(std::istream& is, std::vector<T>& v) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    std::uint64_t n{0u};
+    read_binary(is, n);
+    v.resize(n);
+    is.read(reinterpret_cast<char*>(v.data()),
+            static_cast<std::streamsize>(n * sizeof(T)));
+    if (!is) {
+        throw std::runtime_error("ERROR: Unexpected end of binary grid data");
+    }
+}
+
+}  // namespace io::detail
+
+inline void to_binary(std::ostream& os, const axis_payload& a) {
+    io::detail::write_binary(os, static_cast<std::uint32_t>(a.label));
+    io::detail::write_binary(os, static_cast<std::uint32_t>(a.bounds));
+    io::detail::write_binary(os, static_cast<std::uint32_t>(a.binning));
+    io::detail::write_binary(os, static_cast<std::uint64_t>(a.bins));
+    io::detail::write_binary(os, a.edges);
+}
+
+inline void from_binary(std::istream& is, axis_payload& a) {
+    std::uint32_t label{0u}, bounds{0u}, binning{0u};
+    std::uint64_t bins{0u};
+    io::detail::read_binary(is, label);
+    io::detail::read_binary(is, bounds);
+    io::detail::read_binary(is, binning);
+    io::detail::read_binary(is, bins);
+    io::detail::read_binary(is, a.edges);
+
+    a.label = static_cast<n_axis::label>(label);
+    a.bounds = static_cast<n_axis::bounds>(bounds);
+    a.binning = static_cast<n_axis::binning>(binning);
+    a.bins = static_cast<std::size_t>(bins);
+}
+
+inline void to_binary(std::ostream& os, const grid_payload& g) {
+    io::detail::write_binary(os, static_cast<std::uint64_t>(g.axes.size()));
+    for (const auto& a : g.axes) {
+        to_binary(os, a);
+    }
+
+    // Flatten the bin content
+    std::vector<std::uint32_t> n_entries;
+    std::vector<std::uint32_t> entries;
+    n_entries.reserve(g.entries.size());
+    for (const auto& bin : g.entries) {
+        n_entries.push_back(static_cast<std::uint32_t>(bin.size()));
+        entries.insert(entries.end(), bin.begin(), bin.end());
+    }
+    io::detail::write_binary(os, n_entries);
+    io::detail::write_binary(os, entries);
+}
+
+inline void from_binary(std::istream& is, grid_payload& g) {
+    std::uint64_t n_axes{0u};
+    io::detail::read_binary(is, n_axes);
+    g.axes.resize(n_axes);
+    for (auto& a : g.axes) {
+        from_binary(is, a);
+    }
+
+    std::vector<std::uint32_t> n_entries;
+    std::vector<std::uint32_t> entries;
+    io::detail::read_binary(is, n_entries);
+    io::detail::read_binary(is, entries);
+
+    g.entries.resize(n_entries.size());
+    std::size_t offset{0u};
+    for (std::size_t gbin = 0u; gbin < n_entries.size(); ++gbin) {
+        if (offset + n_entries[gbin] > entries.size()) {
+            throw std::runtime_error("ERROR: Corrupt binary grid data");
+        }
+        g.entries[gbin].assign(entries.begin() + offset,
+                               entries.begin() + offset + n_entries[gbin]);
+        offset += n_entries[gbin];
+    }
+}
+
+inline void to_binary(std::ostream& os, const surface_grid_payload& g) {
+    io::detail::write_binary(os,
+                             static_cast<std::uint32_t>(g.acc_link.type));
+    io::detail::write_binary(os, static_cast<std::uint64_t>(g.acc_link.index));
+    to_binary(os, g.grid);
+}
+
+inline void from_binary(std::istream& is, surface_grid_payload& g) {
+    std::uint32_t type{0u};
+    std::uint64_t index{0u};
+    io::detail::read_binary(is, type);
+    io::detail::read_binary(is, index);
+    g.acc_link.type = static_cast<acc_links_payload::acc_type>(type);
+    g.acc_link.index = static_cast<std::size_t>(index);
+    from_binary(is, g.grid);
+}
+
+/// Writes the volume grid and the surface grids of the detector payload
+/// @param d (the volumes are not written)
+inline void to_binary(std::ostream& os, const detector_payload& d) {
+    io::detail::write_binary(os, io::detail::grids_magic);
+    io::detail::write_binary(os, io::detail::grids_version);
+
+    to_binary(os, d.volume_grid.grid);
+    io::detail::write_binary(
+        os, static_cast<std::uint64_t>(d.surface_grids.size()));
+    for (const auto& g : d.surface_grids) {
+        to_binary(os, g);
+    }
+}
+
+/// Reads the volume grid and the surface grids into the detector payload
+/// @param d
+inline void from_binary(std::istream& is, detector_payload& d) {
+    std::uint32_t magic{0u}, version{0u};
+    io::detail::read_binary(is, magic);
+    io::detail::read_binary(is, version);
+    if (magic != io::detail::grids_magic or
+        version != io::detail::grids_version) {
+        throw std::runtime_error("ERROR: Not a detray binary grid file");
+    }
+
+    from_binary(is, d.volume_grid.grid);
+    std::uint64_t n_grids{0u};
+    io::detail::read_binary(is, n_grids);
+    d.surface_grids.resize(n_grids);
+    for (auto& g : d.surface_grids) {
+        from_binary(is, g);
+    }
+}
+
+}  // namespace detray
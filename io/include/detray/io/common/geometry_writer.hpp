@@ -12,9 +12,13 @@
 #include "detray/io/common/payloads.hpp"
 #include "detray/materials/material_rod.hpp"
 #include "detray/materials/material_slab.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/type_traits.hpp"
 
 // System include(s)
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace detray {
@@ -46,9 +50,19 @@ class geometry_writer {
             det_data.volumes.push_back(serialize(vol, det));
         }
 
+        serialize_grids(det, det_data);
+
         return det_data;
     }
 
+    /// Serialize the volume grid and all surface grids of a detector @param det
+    /// into the detector io payload @param det_data
+    static void serialize_grids(const detector_t& det,
+                                detector_payload& det_data) {
+        det_data.volume_grid.grid = serialize_grid(det.volume_search_grid());
+        serialize_grids(det_data.surface_grids, det.surface_store());
+    }
+
     /// Serialize a link @param idx into its io payload
     static single_link_payload serialize(const std::size_t idx) {
         single_link_payload link_data;
@@ -145,7 +159,7 @@ class geometry_writer {
     /// Serialize a surface material link @param m into its io payload
     template <class material_t>
     static material_payload serialize(const std::size_t idx) {
-        using scalar_t = typename material_t::scalar_type;
+        using scalar_t = typename detector_t::scalar_type;
         using type_id = material_payload::material_type;
 
         material_payload mat_data;
@@ -231,9 +245,99 @@ class geometry_writer {
         return vol_data;
     }
 
+    /// Serialize the axes and the bin content of a grid @param gr into its
+    /// io payload. Surfaces in the bins are represented by their index.
+    template <typename grid_t>
+    static grid_payload serialize_grid(const grid_t& gr) {
+        using value_t = typename grid_t::value_type;
+
+        grid_payload grid_data;
+
+        // The grid has not been built
+        if (gr.data().bin_data()->empty()) {
+            return grid_data;
+        }
+
+        serialize_axes(gr.axes(), grid_data.axes,
+                       std::make_index_sequence<grid_t::Dim>{});
+
+        grid_data.entries.resize(gr.nbins());
+        for (dindex gbin = 0u; gbin < grid_data.entries.size(); ++gbin) {
+            auto& bin_data = grid_data.entries[gbin];
+            for (const auto& entry : gr.at(gbin)) {
+                if constexpr (std::is_arithmetic_v<value_t>) {
+                    if (entry == detail::invalid_value<value_t>()) {
+                        continue;
+                    }
+                    bin_data.push_back(static_cast<unsigned int>(entry));
+                } else {
+                    bin_data.push_back(
+                        static_cast<unsigned int>(entry.index()));
+                }
+            }
+        }
+
+        return grid_data;
+    }
+
+    /// Serialize a grid axis @param ax into its io payload
+    template <typename axis_t>
+    static axis_payload serialize_axis(const axis_t& ax) {
+        axis_payload axis_data;
+
+        axis_data.binning = ax.binning();
+        axis_data.bounds = ax.bounds();
+        axis_data.label = ax.label();
+        axis_data.bins = ax.m_binning.nbins();
+
+        // Regular binning: only the span, irregular binning: all bin edges
+        if (axis_data.binning == n_axis::binning::e_irregular) {
+            for (dindex ib = 0u; ib < axis_data.bins; ++ib) {
+                axis_data.edges.push_back(ax.bin_edges(ib)[0]);
+            }
+        } else {
+            axis_data.edges.push_back(ax.min());
+        }
+        axis_data.edges.push_back(ax.max());
+
+        return axis_data;
+    }
+
     std::string m_file_extension;
 
     private:
+    /// Serialize every axis of the multi-axis @param axes
+    template <typename multi_axis_t, std::size_t... I>
+    static void serialize_axes(const multi_axis_t& axes,
+                               std::vector<axis_payload>& axes_data,
+                               std::index_sequence<I...>) {
+        (axes_data.push_back(serialize_axis(axes.template get_axis<I>())),
+         ...);
+    }
+
+    /// Serialize all grids of every grid collection in the surface finder
+    /// @param store
+    template <std::size_t I = 0u, typename store_t>
+    static void serialize_grids(std::vector<surface_grid_payload>& grids,
+                                const store_t& store) {
+        constexpr auto id{store_t::value_types::to_id(I)};
+        const auto& coll = store.template get<id>();
+
+        if constexpr (detail::is_grid_collection_v<
+                          std::decay_t<decltype(coll)>>) {
+            for (dindex i = 0u; i < coll.size(); ++i) {
+                surface_grid_payload grid_data;
+                grid_data.acc_link = serialize(id, i);
+                grid_data.grid = serialize_grid(coll[i]);
+                grids.push_back(std::move(grid_data));
+            }
+        }
+
+        if constexpr (I < store_t::value_types::n_types - 1u) {
+            serialize_grids<I + 1u>(grids, store);
+        }
+    }
+
     /// Retrieve @c mask_payload from mask_store element
     struct get_mask_payload {
         template <typename mask_group_t, typename index_t>
@@ -0,0 +1,235 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/definitions/grid_axis.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/io/common/payloads.hpp"
+#include "detray/surface_finders/grid/populator.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+/// @brief Abstract base class for detector grid readers.
+///
+/// Fills the volume grid and the surface grids of a detector from their io
+/// payloads, so that the grids do not have to be rebuilt. The volumes and
+/// surfaces that the grids refer to have to be present in the detector.
+template <class detector_t>
+class grid_reader {
+
+    public:
+    /// All readers must define a file name
+    grid_reader() = delete;
+
+    /// File is expected with a fixed @param extension
+    grid_reader(const std::string& ext) : m_file_extension{ext} {}
+
+    /// Default destructor
+    virtual ~grid_reader() {}
+
+    /// Reads the grids of the detector from a file with a given name
+    virtual void read(detector_t&, vecmem::memory_resource&,
+                      const std::string&) = 0;
+
+    protected:
+    /// Fill the grids in the detector io payload @param det_data into the
+    /// detector @param det
+    ///
+    /// @note The surface grids are appended to the grid collections in the
+    /// order of their indices, so the collections have to be empty. The
+    /// volumes have to be linked to their surface grids already.
+    static void deserialize(const detector_payload& det_data, detector_t& det,
+                            vecmem::memory_resource& resource) {
+        // Volume grid
+        if (not det_data.volume_grid.grid.axes.empty()) {
+            det.add_volume_finder(
+                deserialize<typename detector_t::volume_finder>(
+                    det_data.volume_grid.grid, resource,
+                    [](const std::size_t idx) {
+                        return static_cast<dindex>(idx);
+                    }));
+        }
+
+        // Surface grids
+        for (const auto& grid_data : det_data.surface_grids) {
+            add_surface_grid(grid_data, det, resource);
+        }
+        // The navigation metadata of the volumes depends on their grids
+        if (not det_data.surface_grids.empty()) {
+            det.update_navigation_info();
+        }
+    }
+
+    /// Build a data owning grid of type @tparam grid_t from its io payload
+    /// @param grid_data
+    ///
+    /// @param get_entry converts the io index of a bin entry to the entry
+    template <typename grid_t, typename entry_getter_t>
+    static grid_t deserialize(const grid_payload& grid_data,
+                              vecmem::memory_resource& resource,
+                              const entry_getter_t& get_entry) {
+        using axes_t = typename grid_t::axes_type;
+        using value_t = typename grid_t::value_type;
+        using populator_t = populator<typename grid_t::populator_impl>;
+
+        if (grid_data.axes.size() != grid_t::Dim) {
+            throw std::invalid_argument(
+                "ERROR: Grid payload has the wrong number of axes");
+        }
+
+        // Axes
+        typename axes_t::boundary_storage_type axes_data(&resource);
+        typename axes_t::edges_storage_type bin_edges(&resource);
+        deserialize_axes<axes_t>(grid_data.axes, axes_data, bin_edges,
+                                 std::make_index_sequence<grid_t::Dim>{});
+
+        // Bin content: Open axes have an additional under- and overflow bin
+        std::size_t n_bins{1u};
+        for (const auto& axis_data : grid_data.axes) {
+            n_bins *= axis_data.bins +
+                      (axis_data.bounds == n_axis::bounds::e_open ? 2u : 0u);
+        }
+        if (grid_data.entries.size() != n_bins) {
+            throw std::invalid_argument(
+                "ERROR: Grid payload has the wrong number of bins");
+        }
+
+        typename grid_t::bin_storage_type bin_data(&resource);
+        bin_data.resize(n_bins, populator_t::template init<value_t>());
+
+        grid_t gr(std::move(bin_data),
+                  axes_t(std::move(axes_data), std::move(bin_edges)));
+
+        for (dindex gbin = 0u; gbin < n_bins; ++gbin) {
+            for (const unsigned int idx : grid_data.entries[gbin]) {
+                gr.populate(gbin, get_entry(idx));
+            }
+        }
+
+        return gr;
+    }
+
+    /// Extension that matches the file format of the respective reader
+    std::string m_file_extension;
+
+    private:
+    /// Deserialize every axis of the multi-axis type @tparam axes_t
+    template <typename axes_t, std::size_t... I>
+    static void deserialize_axes(
+        const std::vector<axis_payload>& axes_data_io,
+        typename axes_t::boundary_storage_type& axes_data,
+        typename axes_t::edges_storage_type& bin_edges,
+        std::index_sequence<I...>) {
+        (deserialize_axis<std::decay_t<decltype(
+             std::declval<const axes_t&>().template get_axis<I>())>>(
+             axes_data_io[I], axes_data, bin_edges),
+         ...);
+    }
+
+    /// Add the bin range and the bin edges of the axis payload
+    /// @param axis_data to the axes data of the grid
+    template <typename axis_t, typename boundary_storage_t,
+              typename edges_storage_t>
+    static void deserialize_axis(const axis_payload& axis_data,
+                                 boundary_storage_t& axes_data,
+                                 edges_storage_t& bin_edges) {
+        using scalar_t = typename axis_t::scalar_type;
+
+        if (axis_data.label != axis_t::bounds_type::label or
+            axis_data.bounds != axis_t::bounds_type::type or
+            axis_data.binning != axis_t::binning_type::type) {
+            throw std::invalid_argument(
+                "ERROR: Grid axis payload does not match the axis type");
+        }
+
+        const auto offset{static_cast<dindex>(bin_edges.size())};
+        const auto n_bins{static_cast<dindex>(axis_data.bins)};
+
+        // Regular binning: offset and number of bins, irregular binning:
+        // range of bin edges
+        if constexpr (axis_t::binning_type::type ==
+                      n_axis::binning::e_regular) {
+            if (axis_data.edges.size() != 2u) {
+                throw std::invalid_argument(
+                    "ERROR: Regular axis payload needs exactly two edges");
+            }
+            axes_data.push_back({offset, n_bins});
+        } else {
+            if (axis_data.edges.size() != axis_data.bins + 1u) {
+                throw std::invalid_argument(
+                    "ERROR: Irregular axis payload needs #bins + 1 edges");
+            }
+            axes_data.push_back({offset, offset + n_bins});
+        }
+
+        for (const real_io edge : axis_data.edges) {
+            bin_edges.push_back(static_cast<scalar_t>(edge));
+        }
+    }
+
+    /// Append the surface grid @param grid_data to the grid collection in the
+    /// detector surface store that it is linked to
+    template <std::size_t I = 0u>
+    static void add_surface_grid(const surface_grid_payload& grid_data,
+                                 detector_t& det,
+                                 vecmem::memory_resource& resource) {
+        using store_t = typename detector_t::surface_container;
+        constexpr auto id{store_t::value_types::to_id(I)};
+        using coll_t =
+            std::decay_t<decltype(det.surface_store().template get<id>())>;
+
+        if (static_cast<std::size_t>(grid_data.acc_link.type) ==
+            static_cast<std::size_t>(id)) {
+            if constexpr (detail::is_grid_collection_v<coll_t>) {
+                using grid_t = typename coll_t::grid_type::template type<true>;
+                using value_t = typename grid_t::value_type;
+
+                auto& coll = det.surface_store().template get<id>();
+                if (grid_data.acc_link.index != coll.size()) {
+                    throw std::invalid_argument(
+                        "ERROR: Surface grids have to be read in order");
+                }
+
+                const auto& surfaces = det.surfaces();
+                coll.push_back(deserialize<grid_t>(
+                    grid_data.grid, resource,
+                    [&surfaces](const std::size_t idx) -> value_t {
+                        if constexpr (std::is_arithmetic_v<value_t>) {
+                            return static_cast<value_t>(idx);
+                        } else {
+                            return surfaces[idx];
+                        }
+                    }));
+                return;
+            } else {
+                throw std::invalid_argument(
+                    "ERROR: Surface finder is not a grid collection");
+            }
+        }
+
+        if constexpr (I < store_t::value_types::n_types - 1u) {
+            add_surface_grid<I + 1u>(grid_data, det, resource);
+        } else {
+            throw std::invalid_argument("ERROR: Unknown surface finder type");
+        }
+    }
+};
+
+}  // namespace detray
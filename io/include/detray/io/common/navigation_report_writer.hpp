@@ -0,0 +1,79 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/common/payloads.hpp"
+#include "detray/propagator/navigation_statistics.hpp"
+
+// System include(s)
+#include <string>
+#include <utility>
+
+namespace detray {
+
+/// @brief Abstract base class for navigation statistics report writers.
+///
+/// Converts the aggregated navigation counters of a set of tracks into
+/// their io payload.
+class navigation_report_writer {
+
+    public:
+    /// All writers must define a file name
+    navigation_report_writer() = delete;
+
+    /// File gets created with a fixed @param extension
+    navigation_report_writer(const std::string& ext)
+        : m_file_extension{ext} {}
+
+    /// Default destructor
+    virtual ~navigation_report_writer() {}
+
+    /// Writes the navigation statistics to a file with a given name
+    virtual void write(const navigation_statistics&, const std::string&) = 0;
+
+    /// Serialize the navigation statistics @param stats into their payload
+    static navigation_report_payload serialize(
+        const navigation_statistics& stats) {
+        using counter = navigation::counter;
+
+        navigation_report_payload report;
+        report.n_tracks = stats.n_tracks();
+
+        for (std::size_t c = 0u; c < navigation_statistics::n_counters; ++c) {
+            const auto cnt{static_cast<counter>(c)};
+
+            counter_report_payload counter_data;
+            counter_data.name = navigation::counter_names[c];
+            counter_data.total = stats.total(cnt);
+            counter_data.max = stats.max(cnt);
+
+            // Leave out the empty bins of large counts
+            std::size_t n_bins{0u};
+            for (std::size_t b = 0u; b < navigation_statistics::n_bins; ++b) {
+                if (stats.n_entries(cnt, b) != 0u) {
+                    n_bins = b + 1u;
+                }
+            }
+            counter_data.counts.counts.resize(n_bins);
+            for (std::size_t b = 0u; b < n_bins; ++b) {
+                counter_data.counts.counts[b] = stats.n_entries(cnt, b);
+            }
+
+            report.counters.push_back(std::move(counter_data));
+        }
+
+        return report;
+    }
+
+    protected:
+    /// Extension that matches the file format of the respective writer
+    std::string m_file_extension;
+};
+
+}  // namespace detray
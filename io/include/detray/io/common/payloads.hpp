@@ -176,6 +176,13 @@ struct grid_objects_payload {
     std::optional<transform_payload> transform;
 };
 
+/// @brief A payload for a surface grid and its position in the detector
+/// surface finder store
+struct surface_grid_payload {
+    acc_links_payload acc_link;
+    grid_payload grid;
+};
+
 /// @brief navigation links definition
 struct links_payload {
     std::vector<single_link_payload> single_links;
@@ -189,6 +196,79 @@ struct detector_payload {
     std::string name = "";
     std::vector<volume_payload> volumes = {};
     grid_objects_payload volume_grid;
+    std::vector<surface_grid_payload> surface_grids = {};
+};
+
+/// Detector report payloads
+/// @{
+
+/// @brief Memory footprint of a single data collection
+struct store_report_payload {
+    std::string name = "";
+    /// Number of elements in the collection
+    std::size_t n_elements = 0u;
+    /// Size and alignment of a single element
+    std::size_t element_size = 0u;
+    std::size_t alignment = 0u;
+    /// Bytes per element that are not occupied by its data members
+    std::size_t padding = 0u;
+    /// Bytes that are occupied by the elements and that are allocated
+    std::size_t bytes = 0u;
+    std::size_t capacity_bytes = 0u;
+};
+
+/// @brief Histogram of a count: 'counts[n]' is the number of entries with
+/// value 'n'
+struct histogram_payload {
+    std::vector<std::size_t> counts = {};
+};
+
+/// @brief Surface content and navigation candidates of a volume
+struct volume_report_payload {
+    std::size_t index = 0u;
+    std::size_t n_sensitives = 0u;
+    std::size_t n_portals = 0u;
+    std::size_t n_passives = 0u;
+    std::size_t n_max_candidates = 0u;
+};
+
+/// @brief Bin occupancy of a grid
+struct grid_report_payload {
+    std::string name = "";
+    std::size_t n_bins = 0u;
+    histogram_payload occupancy;
 };
 
+/// @brief A payload for the memory layout report of a detector
+struct detector_report_payload {
+    std::string name = "";
+    std::vector<store_report_payload> stores = {};
+    std::vector<volume_report_payload> volumes = {};
+    /// Distribution of the maximal number of candidates per volume
+    histogram_payload candidates;
+    std::vector<grid_report_payload> grids = {};
+    std::size_t total_bytes = 0u;
+    std::size_t total_capacity_bytes = 0u;
+    std::size_t total_padding_bytes = 0u;
+};
+
+/// @brief Distribution of a navigation counter over a set of tracks:
+/// 'counts[0]' is the number of tracks with a count of zero and 'counts[b]'
+/// the number of tracks with a count in [2^(b-1), 2^b)
+struct counter_report_payload {
+    std::string name = "";
+    std::size_t total = 0u;
+    std::size_t max = 0u;
+    histogram_payload counts;
+};
+
+/// @brief A payload for the navigation statistics of a set of tracks
+struct navigation_report_payload {
+    std::string name = "";
+    std::size_t n_tracks = 0u;
+    std::vector<counter_report_payload> counters = {};
+};
+
+/// @}
+
 }  // namespace detray
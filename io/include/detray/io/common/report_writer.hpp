@@ -0,0 +1,339 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/core/detail/container_views.hpp"
+#include "detray/definitions/geometry.hpp"
+#include "detray/definitions/indexing.hpp"
+#include "detray/geometry/detector_volume.hpp"
+#include "detray/geometry/surface.hpp"
+#include "detray/io/common/payloads.hpp"
+#include "detray/masks/masks.hpp"
+#include "detray/materials/material_rod.hpp"
+#include "detray/materials/material_slab.hpp"
+#include "detray/utils/invalid_values.hpp"
+#include "detray/utils/type_traits.hpp"
+
+// System include(s)
+#include <algorithm>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace detray {
+
+namespace detail {
+
+/// @returns the number of bytes of @tparam T that are occupied by its data
+/// members (only the top level members are considered). Default: no padding
+template <typename T>
+struct data_bytes {
+    static constexpr std::size_t value{sizeof(T)};
+};
+
+template <typename... Ts>
+struct data_bytes<surface<Ts...>> {
+    using sf_t = surface<Ts...>;
+    static constexpr std::size_t value{
+        sizeof(geometry::barcode) + sizeof(typename sf_t::mask_link) +
+        sizeof(typename sf_t::material_link) +
+        sizeof(typename sf_t::transform_link) +
+        sizeof(typename sf_t::source_link)};
+};
+
+/// @note the (empty) shape member of a mask occupies space, too
+template <typename shape_t, typename links_t, typename algebra_t,
+          template <typename, std::size_t> class array_t>
+struct data_bytes<mask<shape_t, links_t, algebra_t, array_t>> {
+    using mask_t = mask<shape_t, links_t, algebra_t, array_t>;
+    static constexpr std::size_t value{sizeof(typename mask_t::mask_values) +
+                                       sizeof(typename mask_t::links_type)};
+};
+
+template <typename ID, typename link_t, typename scalar_t,
+          template <typename, std::size_t> class array_t>
+struct data_bytes<detector_volume<ID, link_t, scalar_t, array_t>> {
+    using volume_t = detector_volume<ID, link_t, scalar_t, array_t>;
+    static constexpr std::size_t value{
+        sizeof(volume_id) + sizeof(array_t<scalar_t, 6>) + sizeof(dindex) +
+        sizeof(typename volume_t::link_type)};
+};
+
+}  // namespace detail
+
+/// @brief Abstract base class for detector memory layout report writers.
+///
+/// Collects the number of bytes that every data collection in the detector
+/// occupies, the padding of the collection elements, the surface content and
+/// navigation candidates of the volumes, as well as the bin occupancy of the
+/// grids.
+template <class detector_t>
+class report_writer {
+
+    public:
+    /// All writers must define a file name
+    report_writer() = delete;
+
+    /// File gets created with a fixed @param extension
+    report_writer(const std::string& ext) : m_file_extension{ext} {}
+
+    /// Default destructor
+    virtual ~report_writer() {}
+
+    /// Writes the report of the detector to a file with a given name
+    virtual void write(const detector_t&, const std::string&) = 0;
+
+    /// Collect the memory layout report of a detector @param det
+    ///
+    /// @param ctx the geometry context of the transforms
+    ///
+    /// @note the heap memory that the magnetic field backend allocates is not
+    /// accounted for
+    static detector_report_payload serialize(
+        const detector_t& det,
+        const typename detector_t::geometry_context& ctx = {}) {
+        detector_report_payload report;
+
+        // Memory footprint of the data stores
+        report.stores.push_back(serialize("volumes", det.volumes()));
+        report.stores.push_back(
+            serialize("transforms", det.transform_store().get(ctx)));
+        serialize_masks(report.stores, det.mask_store());
+        serialize_materials(report.stores, det.material_store());
+        report.stores.push_back(
+            serialize("volume_materials", det.volume_materials()));
+        report.stores.push_back(
+            serialize("bounding_spheres", det.bounding_spheres()));
+        serialize_sf_finders(report.stores, report.grids,
+                             det.surface_store());
+        serialize_view("volume_finder",
+                       detray::get_data(det.volume_search_grid()),
+                       report.stores);
+        report.stores.push_back(
+            serialize<typename detector_t::bfield_type>("bfield", 1u, 1u));
+
+        for (const auto& st : report.stores) {
+            report.total_bytes += st.bytes;
+            report.total_capacity_bytes += st.capacity_bytes;
+            report.total_padding_bytes += st.n_elements * st.padding;
+        }
+
+        // Surfaces and navigation candidates per volume
+        report.volumes.resize(det.volumes().size());
+        for (const auto& vol : det.volumes()) {
+            auto& vol_data = report.volumes[vol.index()];
+            vol_data.index = vol.index();
+            vol_data.n_max_candidates =
+                det.navigation_info(vol.index()).n_max_candidates();
+            fill(report.candidates, vol_data.n_max_candidates);
+        }
+        for (const auto& sf : det.surfaces()) {
+            auto& vol_data = report.volumes[sf.volume()];
+            switch (sf.id()) {
+                case surface_id::e_sensitive:
+                    ++vol_data.n_sensitives;
+                    break;
+                case surface_id::e_portal:
+                    ++vol_data.n_portals;
+                    break;
+                case surface_id::e_passive:
+                    ++vol_data.n_passives;
+                    break;
+            }
+        }
+
+        // Bin occupancy of the volume grid
+        report.grids.push_back(
+            serialize_grid("volume_finder", det.volume_search_grid()));
+
+        return report;
+    }
+
+    protected:
+    /// Extension that matches the file format of the respective writer
+    std::string m_file_extension;
+
+    private:
+    /// Serialize the memory footprint of @param n elements of type @tparam T
+    /// with a total allocated capacity of @param capacity into its io payload
+    template <typename T>
+    static store_report_payload serialize(const std::string& name,
+                                          const std::size_t n,
+                                          const std::size_t capacity) {
+        store_report_payload store_data;
+
+        store_data.name = name;
+        store_data.n_elements = n;
+        store_data.element_size = sizeof(T);
+        store_data.alignment = alignof(T);
+        store_data.padding = sizeof(T) - detail::data_bytes<T>::value;
+        store_data.bytes = n * sizeof(T);
+        store_data.capacity_bytes = capacity * sizeof(T);
+
+        return store_data;
+    }
+
+    /// Serialize the memory footprint of a collection @param coll
+    template <typename collection_t>
+    static store_report_payload serialize(const std::string& name,
+                                          const collection_t& coll) {
+        using value_t = typename collection_t::value_type;
+
+        return serialize<value_t>(name, coll.size(), coll.capacity());
+    }
+
+    /// Serialize the bin occupancy of a grid @param gr into its io payload
+    template <typename grid_t>
+    static grid_report_payload serialize_grid(const std::string& name,
+                                              const grid_t& gr) {
+        using value_t = typename grid_t::value_type;
+
+        grid_report_payload grid_data;
+        grid_data.name = name;
+
+        // The grid has not been built
+        if (gr.data().bin_data()->empty()) {
+            return grid_data;
+        }
+        grid_data.n_bins = gr.nbins();
+
+        for (dindex gbin = 0u; gbin < grid_data.n_bins; ++gbin) {
+            std::size_t n_entries{0u};
+            for (const auto& entry : gr.at(gbin)) {
+                if constexpr (std::is_arithmetic_v<value_t>) {
+                    if (entry == detail::invalid_value<value_t>()) {
+                        continue;
+                    }
+                }
+                ++n_entries;
+            }
+            fill(grid_data.occupancy, n_entries);
+        }
+
+        return grid_data;
+    }
+
+    /// Serialize the memory footprint of every mask type in @param store
+    template <std::size_t I = 0u, typename store_t>
+    static void serialize_masks(std::vector<store_report_payload>& stores,
+                                const store_t& store) {
+        constexpr auto id{store_t::value_types::to_id(I)};
+        const auto& coll = store.template get<id>();
+        using mask_t = typename std::decay_t<decltype(coll)>::value_type;
+
+        stores.push_back(
+            serialize("masks/" + std::string(mask_t::shape::name), coll));
+
+        if constexpr (I < store_t::value_types::n_types - 1u) {
+            serialize_masks<I + 1u>(stores, store);
+        }
+    }
+
+    /// Serialize the memory footprint of every material type in @param store
+    template <std::size_t I = 0u, typename store_t>
+    static void serialize_materials(std::vector<store_report_payload>& stores,
+                                    const store_t& store) {
+        constexpr auto id{store_t::value_types::to_id(I)};
+        const auto& coll = store.template get<id>();
+        using coll_t = std::decay_t<decltype(coll)>;
+        using material_t = typename coll_t::value_type;
+        using scalar_t = typename detector_t::scalar_type;
+
+        std::string name{"materials/"};
+        if constexpr (std::is_same_v<material_t, material_slab<scalar_t>>) {
+            name += "slab";
+        } else if constexpr (std::is_same_v<material_t,
+                                            material_rod<scalar_t>>) {
+            name += "rod";
+        } else {
+            name += std::to_string(I);
+        }
+
+        // Material maps
+        if constexpr (detail::is_grid_collection_v<coll_t>) {
+            serialize_view(name, detray::get_data(coll), stores);
+        } else {
+            stores.push_back(serialize(name, coll));
+        }
+
+        if constexpr (I < store_t::value_types::n_types - 1u) {
+            serialize_materials<I + 1u>(stores, store);
+        }
+    }
+
+    /// Serialize the memory footprint of every surface finder type in
+    /// @param store and the bin occupancy of all surface grids
+    template <std::size_t I = 0u, typename store_t>
+    static void serialize_sf_finders(std::vector<store_report_payload>& stores,
+                                     std::vector<grid_report_payload>& grids,
+                                     const store_t& store) {
+        constexpr auto id{store_t::value_types::to_id(I)};
+        const auto& coll = store.template get<id>();
+        using coll_t = std::decay_t<decltype(coll)>;
+
+        const std::string name{"surface_finders/" + std::to_string(I)};
+        serialize_view(name, detray::get_data(coll), stores);
+
+        if constexpr (detail::is_grid_collection<coll_t>::value) {
+            for (dindex i = 0u; i < coll.size(); ++i) {
+                grids.push_back(
+                    serialize_grid(name + "/" + std::to_string(i), coll[i]));
+            }
+        }
+
+        if constexpr (I < store_t::value_types::n_types - 1u) {
+            serialize_sf_finders<I + 1u>(stores, grids, store);
+        }
+    }
+
+    /// Serialize the memory footprint of the containers behind a vecmem
+    /// vector @param view
+    template <typename T>
+    static void serialize_view(const std::string& name,
+                               const dvector_view<T>& view,
+                               std::vector<store_report_payload>& stores) {
+        stores.push_back(serialize<std::remove_cv_t<T>>(name, view.size(),
+                                                        view.capacity()));
+    }
+
+    /// Serialize the memory footprint of all containers behind a composite
+    /// @param view, one store per contained vecmem view
+    template <typename view_t,
+              std::enable_if_t<std::is_base_of_v<detail::dbase_view, view_t>,
+                               bool> = true>
+    static void serialize_view(const std::string& name, const view_t& view,
+                               std::vector<store_report_payload>& stores) {
+        serialize_view_impl(
+            name, view, stores,
+            std::make_index_sequence<detail::tuple_size_v<
+                std::decay_t<decltype(view.m_view)>>>{});
+    }
+
+    /// Unroll the sub-views of a composite @param view
+    template <typename view_t, std::size_t... I>
+    static void serialize_view_impl(const std::string& name,
+                                    const view_t& view,
+                                    std::vector<store_report_payload>& stores,
+                                    std::index_sequence<I...>) {
+        (serialize_view(name + "/" + std::to_string(I),
+                        detail::get<I>(view.m_view), stores),
+         ...);
+    }
+
+    /// Count the value @param n in the histogram @param hist
+    static void fill(histogram_payload& hist, const std::size_t n) {
+        if (hist.counts.size() <= n) {
+            hist.counts.resize(n + 1u, 0u);
+        }
+        ++hist.counts[n];
+    }
+};
+
+}  // namespace detray
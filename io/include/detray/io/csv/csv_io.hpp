@@ -14,7 +14,9 @@
 #include "detray/io/csv/csv_io_types.hpp"
 #include "detray/surface_finders/brute_force_finder.hpp"
 #include "detray/tools/bin_association.hpp"
+#include "detray/utils/invalid_values.hpp"
 #include "detray/utils/ranges.hpp"
+#include "detray/utils/type_traits.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/memory_resource.hpp>
@@ -22,6 +24,7 @@
 // System include(s)
 #include <climits>
 #include <map>
+#include <type_traits>
 #include <vector>
 
 namespace detray {
@@ -33,40 +36,39 @@ namespace {
 struct grid_writer {
 
     template <typename grid_group_t, typename grid_index_t,
-              typename grid_entry_t, typename writer_t,
-              std::enable_if_t<
-                  not std::is_same_v<typename grid_group_t::grid_type, void>,
-                  bool> = true>
+              typename grid_entry_t, typename writer_t>
     inline void operator()(const grid_group_t &grid_group,
                            const grid_index_t &grid_idx, grid_entry_t &csv_ge,
                            writer_t &sge_writer) const {
-
-        const auto &grid = grid_group.at(grid_idx);
-
-        std::size_t nbins0{grid.axis_p0().bins()};
-        std::size_t nbins1{grid.axis_p1().bins()};
-        for (std::size_t b0 = 0u; b0 < nbins0; ++b0) {
-            for (std::size_t b1 = 0u; b1 < nbins1; ++b1) {
-                csv_ge.detray_bin0 = b0;
-                csv_ge.detray_bin1 = b1;
-                for (auto e : grid.bin(b0, b1)) {
-                    csv_ge.detray_entry = e;
-                    sge_writer.append(csv_ge);
+        // Only 2D grids are written (do nothing for e.g. brute force finder)
+        if constexpr (detail::is_grid_collection_v<grid_group_t>) {
+            using grid_t = typename grid_group_t::grid_type;
+            using value_t = typename grid_t::value_type;
+
+            if constexpr (grid_t::Dim == 2u) {
+                const auto grid = grid_group[grid_idx];
+                const auto n_bins = grid.axes().nbins();
+
+                for (dindex b0 = 0u; b0 < n_bins[0]; ++b0) {
+                    for (dindex b1 = 0u; b1 < n_bins[1]; ++b1) {
+                        csv_ge.detray_bin0 = b0;
+                        csv_ge.detray_bin1 = b1;
+                        for (const auto &e : grid.at(b0, b1)) {
+                            if constexpr (std::is_arithmetic_v<value_t>) {
+                                if (e == detail::invalid_value<value_t>()) {
+                                    continue;
+                                }
+                                csv_ge.detray_entry = e;
+                            } else {
+                                csv_ge.detray_entry = e.index();
+                            }
+                            sge_writer.append(csv_ge);
+                        }
+                    }
                 }
             }
         }
     }
-
-    /// Call for the brute force type (do nothing)
-    template <typename grid_group_t, typename grid_index_t,
-              typename grid_entry_t, typename writer_t,
-              std::enable_if_t<
-                  not std::is_same_v<typename grid_group_t::grid_type, void>,
-                  bool> = true>
-    inline void operator()(const grid_group_t & /*grid_group*/,
-                           const grid_index_t & /*grid_idx*/,
-                           const grid_entry_t & /*csv_ge*/,
-                           writer_t & /*sge_writer*/) {}
 };
 
 }  // anonymous namespace
@@ -0,0 +1,60 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/common/detail/file_handle.hpp"
+#include "detray/io/common/grid_reader.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_serializers.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/memory_resource.hpp>
+
+// System include(s)
+#include <ios>
+#include <string>
+
+namespace detray {
+
+/// @brief Class that reads the grids of a tracking geometry from the json
+/// file that was written by the @c json_geometry_writer
+template <class detector_t>
+class json_grid_reader final : public grid_reader<detector_t> {
+
+    using base_reader = grid_reader<detector_t>;
+
+    public:
+    /// File is expected with a fixed @param extension
+    json_grid_reader() : grid_reader<detector_t>("json") {}
+
+    /// Reads the grids from the geometry file with a given name
+    virtual void read(detector_t &det, vecmem::memory_resource &resource,
+                      const std::string &name) override {
+        // Read json from file
+        io::detail::file_handle file{name + "_geometry", this->m_file_extension,
+                                     std::ios_base::in};
+        nlohmann::ordered_json in_json;
+        *file >> in_json;
+
+        // Only the grids are needed
+        detector_payload det_data;
+        if (in_json.find("volume_grid") != in_json.end()) {
+            det_data.volume_grid = in_json["volume_grid"];
+        }
+        if (in_json.find("surface_grids") != in_json.end()) {
+            for (auto jgrid : in_json["surface_grids"]) {
+                det_data.surface_grids.push_back(jgrid);
+            }
+        }
+
+        base_reader::deserialize(det_data, det, resource);
+    }
+};
+
+}  // namespace detray
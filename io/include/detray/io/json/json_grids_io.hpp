@@ -68,6 +68,16 @@ void from_json(const nlohmann::ordered_json& j, grid_objects_payload& g) {
     }
 }
 
+void to_json(nlohmann::ordered_json& j, const surface_grid_payload& g) {
+    j["acc_link"] = g.acc_link;
+    j["grid"] = g.grid;
+}
+
+void from_json(const nlohmann::ordered_json& j, surface_grid_payload& g) {
+    g.acc_link = j["acc_link"];
+    g.grid = j["grid"];
+}
+
 void to_json(nlohmann::ordered_json& j, const links_payload& l) {
     nlohmann::ordered_json js;
     for (const auto& so : l.single_links) {
@@ -100,6 +110,13 @@ void to_json(nlohmann::ordered_json& j, const detector_payload& d) {
         j["volumes"] = jvolumes;
         j["volume_grid"] = d.volume_grid;
     }
+    if (not d.surface_grids.empty()) {
+        nlohmann::ordered_json jgrids;
+        for (const auto& g : d.surface_grids) {
+            jgrids.push_back(g);
+        }
+        j["surface_grids"] = jgrids;
+    }
 }
 
 void from_json(const nlohmann::ordered_json& j, detector_payload& d) {
@@ -110,6 +127,11 @@ void from_json(const nlohmann::ordered_json& j, detector_payload& d) {
         }
         d.volume_grid = j["volume_grid"];
     }
+    if (j.find("surface_grids") != j.end()) {
+        for (auto jgrid : j["surface_grids"]) {
+            d.surface_grids.push_back(jgrid);
+        }
+    }
 }
 
 }  // namespace detray
\ No newline at end of file
@@ -0,0 +1,58 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/common/detail/file_handle.hpp"
+#include "detray/io/common/navigation_report_writer.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_report_io.hpp"
+
+// System include(s)
+#include <ios>
+#include <string>
+
+namespace detray {
+
+/// @brief Class that writes the navigation statistics of a set of tracks to
+/// json file
+class json_navigation_report_writer final : public navigation_report_writer {
+
+    using base_writer = navigation_report_writer;
+
+    public:
+    /// File gets created with a fixed @param extension
+    json_navigation_report_writer() : navigation_report_writer("json") {}
+
+    /// Writes the navigation statistics to file with a given name
+    virtual void write(const navigation_statistics &stats,
+                       const std::string &name) override {
+        // Create a new file
+        io::detail::file_handle file{name + "_navigation",
+                                     this->m_file_extension,
+                                     std::ios_base::out};
+
+        // Write the navigation statistics into the json stream
+        nlohmann::ordered_json out_json = get_json(stats, name);
+
+        // Write to file
+        *file << std::setw(4) << out_json << std::endl;
+    }
+
+    /// @returns the navigation statistics @param stats with a given
+    /// @param name as json
+    static nlohmann::ordered_json get_json(const navigation_statistics &stats,
+                                           const std::string &name) {
+        navigation_report_payload report = base_writer::serialize(stats);
+        report.name = name;
+
+        return report;
+    }
+};
+
+}  // namespace detray
@@ -0,0 +1,157 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/common/payloads.hpp"
+#include "detray/io/json/json.hpp"
+
+// System include(s)
+#include <vector>
+
+namespace detray {
+
+void to_json(nlohmann::ordered_json& j, const store_report_payload& s) {
+    j["name"] = s.name;
+    j["n_elements"] = s.n_elements;
+    j["element_size"] = s.element_size;
+    j["alignment"] = s.alignment;
+    j["padding"] = s.padding;
+    j["bytes"] = s.bytes;
+    j["capacity_bytes"] = s.capacity_bytes;
+}
+
+void from_json(const nlohmann::ordered_json& j, store_report_payload& s) {
+    s.name = j["name"];
+    s.n_elements = j["n_elements"];
+    s.element_size = j["element_size"];
+    s.alignment = j["alignment"];
+    s.padding = j["padding"];
+    s.bytes = j["bytes"];
+    s.capacity_bytes = j["capacity_bytes"];
+}
+
+void to_json(nlohmann::ordered_json& j, const histogram_payload& h) {
+    j = h.counts;
+}
+
+void from_json(const nlohmann::ordered_json& j, histogram_payload& h) {
+    h.counts = j.get<std::vector<std::size_t>>();
+}
+
+void to_json(nlohmann::ordered_json& j, const volume_report_payload& v) {
+    j["index"] = v.index;
+    j["n_sensitives"] = v.n_sensitives;
+    j["n_portals"] = v.n_portals;
+    j["n_passives"] = v.n_passives;
+    j["n_max_candidates"] = v.n_max_candidates;
+}
+
+void from_json(const nlohmann::ordered_json& j, volume_report_payload& v) {
+    v.index = j["index"];
+    v.n_sensitives = j["n_sensitives"];
+    v.n_portals = j["n_portals"];
+    v.n_passives = j["n_passives"];
+    v.n_max_candidates = j["n_max_candidates"];
+}
+
+void to_json(nlohmann::ordered_json& j, const grid_report_payload& g) {
+    j["name"] = g.name;
+    j["n_bins"] = g.n_bins;
+    j["occupancy"] = g.occupancy;
+}
+
+void from_json(const nlohmann::ordered_json& j, grid_report_payload& g) {
+    g.name = j["name"];
+    g.n_bins = j["n_bins"];
+    g.occupancy = j["occupancy"];
+}
+
+void to_json(nlohmann::ordered_json& j, const detector_report_payload& d) {
+    j["name"] = d.name;
+    j["total_bytes"] = d.total_bytes;
+    j["total_capacity_bytes"] = d.total_capacity_bytes;
+    j["total_padding_bytes"] = d.total_padding_bytes;
+
+    nlohmann::ordered_json jstores;
+    for (const auto& s : d.stores) {
+        jstores.push_back(s);
+    }
+    j["stores"] = jstores;
+
+    nlohmann::ordered_json jvolumes;
+    for (const auto& v : d.volumes) {
+        jvolumes.push_back(v);
+    }
+    j["volumes"] = jvolumes;
+    j["candidates"] = d.candidates;
+
+    nlohmann::ordered_json jgrids;
+    for (const auto& g : d.grids) {
+        jgrids.push_back(g);
+    }
+    j["grids"] = jgrids;
+}
+
+void from_json(const nlohmann::ordered_json& j, detector_report_payload& d) {
+    d.name = j["name"];
+    d.total_bytes = j["total_bytes"];
+    d.total_capacity_bytes = j["total_capacity_bytes"];
+    d.total_padding_bytes = j["total_padding_bytes"];
+
+    for (auto js : j["stores"]) {
+        store_report_payload s = js;
+        d.stores.push_back(s);
+    }
+    for (auto jv : j["volumes"]) {
+        volume_report_payload v = jv;
+        d.volumes.push_back(v);
+    }
+    d.candidates = j["candidates"];
+    for (auto jg : j["grids"]) {
+        grid_report_payload g = jg;
+        d.grids.push_back(g);
+    }
+}
+
+void to_json(nlohmann::ordered_json& j, const counter_report_payload& c) {
+    j["name"] = c.name;
+    j["total"] = c.total;
+    j["max"] = c.max;
+    j["counts"] = c.counts;
+}
+
+void from_json(const nlohmann::ordered_json& j, counter_report_payload& c) {
+    c.name = j["name"];
+    c.total = j["total"];
+    c.max = j["max"];
+    c.counts = j["counts"];
+}
+
+void to_json(nlohmann::ordered_json& j, const navigation_report_payload& n) {
+    j["name"] = n.name;
+    j["n_tracks"] = n.n_tracks;
+
+    nlohmann::ordered_json jcounters;
+    for (const auto& c : n.counters) {
+        jcounters.push_back(c);
+    }
+    j["counters"] = jcounters;
+}
+
+void from_json(const nlohmann::ordered_json& j, navigation_report_payload& n) {
+    n.name = j["name"];
+    n.n_tracks = j["n_tracks"];
+
+    for (auto jc : j["counters"]) {
+        counter_report_payload c = jc;
+        n.counters.push_back(c);
+    }
+}
+
+}  // namespace detray
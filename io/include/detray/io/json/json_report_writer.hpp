@@ -0,0 +1,58 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+#pragma once
+
+// Project include(s)
+#include "detray/io/common/detail/file_handle.hpp"
+#include "detray/io/common/report_writer.hpp"
+#include "detray/io/json/json.hpp"
+#include "detray/io/json/json_report_io.hpp"
+
+// System include(s)
+#include <ios>
+#include <string>
+
+namespace detray {
+
+/// @brief Class that writes the memory layout report of a detector to json
+/// file
+template <class detector_t>
+class json_report_writer final : public report_writer<detector_t> {
+
+    using base_writer = report_writer<detector_t>;
+
+    public:
+    /// File gets created with a fixed @param extension
+    json_report_writer() : report_writer<detector_t>("json") {}
+
+    /// Writes the report to file with a given name
+    virtual void write(const detector_t &det,
+                       const std::string &name) override {
+        // Create a new file
+        io::detail::file_handle file{name + "_report", this->m_file_extension,
+                                     std::ios_base::out};
+
+        // Write the detector report into the json stream
+        nlohmann::ordered_json out_json = get_json(det, name);
+
+        // Write to file
+        *file << std::setw(4) << out_json << std::endl;
+    }
+
+    /// @returns the report of the detector @param det with a given @param name
+    /// as json
+    static nlohmann::ordered_json get_json(const detector_t &det,
+                                           const std::string &name) {
+        detector_report_payload report = base_writer::serialize(det);
+        report.name = name;
+
+        return report;
+    }
+};
+
+}  // namespace detray
@@ -11,3 +11,4 @@
 #include "detray/io/json/json_geometry_io.hpp"
 #include "detray/io/json/json_grids_io.hpp"
 #include "detray/io/json/json_material_io.hpp"
+#include "detray/io/json/json_report_io.hpp"
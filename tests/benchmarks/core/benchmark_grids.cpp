@@ -17,6 +17,16 @@
 #include "detray/grids/grid2.hpp"
 #include "detray/grids/populator.hpp"
 #include "detray/grids/serializer2.hpp"
+#include "detray/masks/masks.hpp"
+#include "detray/surface_finders/grid/axis.hpp"
+#include "detray/surface_finders/grid/grid.hpp"
+#include "detray/surface_finders/grid/populator.hpp"
+#include "detray/surface_finders/grid/serializer.hpp"
+
+// System include(s)
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace detray;
 using namespace __plugin;
@@ -28,37 +38,47 @@ vecmem::host_memory_resource host_mr;
 darray<dindex, 2> zone22 = {2u, 2u};
 
 // TrackML detector has 25 x 60 cells int he detector grid
-using grid2r =
-    grid2<replace_populator, axis::regular, axis::regular, serializer2>;
-grid2r::axis_p0_type xaxisr{25u, 0.f, 25.f, host_mr};
-grid2r::axis_p1_type yaxisr{60u, 0.f, 60.f, host_mr};
-
-grid2r g2r(std::move(xaxisr), std::move(yaxisr), host_mr);
+constexpr dindex n_bins_x{25u};
+constexpr dindex n_bins_y{60u};
 
-// This runs a reference test with a regular grid structure
-static void BM_REGULAR_GRID_BIN(benchmark::State &state) {
-    for (auto _ : state) {
-        for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
-            test::point2<detray::scalar> p = {
-                static_cast<scalar>((rand() % 50)) * 0.5f,
-                static_cast<scalar>((rand() % 120)) * 0.5f};
-            g2r.bin(p);
+/// Fill every bin of a 25 x 60 grid with its (legacy) global bin index
+template <typename grid_t>
+void fill_tml_grid(grid_t &g) {
+    for (dindex ib1 = 0u; ib1 < n_bins_y; ++ib1) {
+        for (dindex ib0 = 0u; ib0 < n_bins_x; ++ib0) {
+            const test::point2<detray::scalar> p = {
+                static_cast<scalar>(ib0) + 0.5f,
+                static_cast<scalar>(ib1) + 0.5f};
+            g.populate(p, ib0 + n_bins_x * ib1);
         }
     }
 }
 
-static void BM_REGULAR_GRID_ZONE(benchmark::State &state) {
-    for (auto _ : state) {
-        for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
-            test::point2<detray::scalar> p = {
-                static_cast<scalar>((rand() % 50)) * 0.5f,
-                static_cast<scalar>((rand() % 120)) * 0.5f};
-            g2r.zone(p, {zone22, zone22});
-        }
-    }
+/// @returns a random point on the 25 x 60 grid
+test::point2<detray::scalar> tml_point() {
+    return {static_cast<scalar>((rand() % 50)) * 0.5f,
+            static_cast<scalar>((rand() % 120)) * 0.5f};
 }
 
-auto construct_irregular_grid() {
+// Legacy grid2 implementation
+using grid2r =
+    grid2<replace_populator, axis::regular, axis::regular, serializer2>;
+using grid2ir =
+    grid2<replace_populator, axis::irregular, axis::irregular, serializer2>;
+using grid2a =
+    grid2<attach_populator, axis::regular, axis::regular, serializer2>;
+
+auto construct_legacy_regular_grid() {
+    grid2r::axis_p0_type xaxisr{n_bins_x, 0.f, 25.f, host_mr};
+    grid2r::axis_p1_type yaxisr{n_bins_y, 0.f, 60.f, host_mr};
+
+    grid2r g(std::move(xaxisr), std::move(yaxisr), host_mr);
+    fill_tml_grid(g);
+
+    return g;
+}
+
+auto construct_legacy_irregular_grid() {
     // Fill a 25 x 60 grid with an "irregular" axis
     dvector<scalar> xboundaries = {};
     xboundaries.reserve(25u);
@@ -72,45 +92,341 @@ auto construct_irregular_grid() {
         yboundaries.push_back(i);
     }
 
-    using grid2ir =
-        grid2<replace_populator, axis::irregular, axis::irregular, serializer2>;
-
     grid2ir::axis_p0_type xaxisir{xboundaries, host_mr};
     grid2ir::axis_p1_type yaxisir{yboundaries, host_mr};
 
-    return grid2ir(std::move(xaxisir), std::move(yaxisir), host_mr);
+    grid2ir g(std::move(xaxisir), std::move(yaxisir), host_mr);
+    fill_tml_grid(g);
+
+    return g;
 }
 
-auto g2irr = construct_irregular_grid();
+auto g2r = construct_legacy_regular_grid();
+auto g2irr = construct_legacy_irregular_grid();
+
+// This runs a reference test with a regular grid structure
+static void BM_LEGACY_REGULAR_GRID_BIN(benchmark::State &state) {
+    for (auto _ : state) {
+        for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
+            benchmark::DoNotOptimize(g2r.bin(tml_point()));
+        }
+    }
+}
+
+static void BM_LEGACY_REGULAR_GRID_ZONE(benchmark::State &state) {
+    for (auto _ : state) {
+        for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
+            benchmark::DoNotOptimize(g2r.zone(tml_point(), {zone22, zone22}));
+        }
+    }
+}
 
 // This runs a reference test with a irregular grid structure
-static void BM_IRREGULAR_GRID_BIN(benchmark::State &state) {
+static void BM_LEGACY_IRREGULAR_GRID_BIN(benchmark::State &state) {
     for (auto _ : state) {
         for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
-            test::point2<detray::scalar> p = {
-                static_cast<scalar>((rand() % 50)) * 0.5f,
-                static_cast<scalar>((rand() % 120)) * 0.5f};
-            g2irr.bin(p);
+            benchmark::DoNotOptimize(g2irr.bin(tml_point()));
         }
     }
 }
 
-static void BM_IRREGULAR_GRID_ZONE(benchmark::State &state) {
+static void BM_LEGACY_IRREGULAR_GRID_ZONE(benchmark::State &state) {
     for (auto _ : state) {
+        for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
+            benchmark::DoNotOptimize(
+                g2irr.zone(tml_point(), {zone22, zone22}));
+        }
+    }
+}
+
+// This fills four entries into every bin of an empty grid
+static void BM_LEGACY_GRID_POPULATE(benchmark::State &state) {
+    for (auto _ : state) {
+        grid2a::axis_p0_type xaxis{n_bins_x, 0.f, 25.f, host_mr};
+        grid2a::axis_p1_type yaxis{n_bins_y, 0.f, 60.f, host_mr};
+        grid2a g(std::move(xaxis), std::move(yaxis), host_mr);
+
+        for (unsigned int i = 0u; i < 4u; ++i) {
+            fill_tml_grid(g);
+        }
+        benchmark::DoNotOptimize(g.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 4 * n_bins_x * n_bins_y);
+}
+
+// Grids with the bin layouts of the different serializers: The neighborhood
+// lookups on a large grid are dominated by the memory access pattern
+constexpr dindex n_bins_nhood{512u};
+
+template <typename binning_t>
+using cartesian_2D = n_axis::multi_axis<
+    true, cartesian2<__plugin::transform3<scalar>>,
+    n_axis::single_axis<n_axis::closed<n_axis::label::e_x>, binning_t>,
+    n_axis::single_axis<n_axis::closed<n_axis::label::e_y>, binning_t>>;
+
+using regular_axes =
+    cartesian_2D<n_axis::regular<host_container_types, scalar>>;
+using irregular_axes =
+    cartesian_2D<n_axis::irregular<host_container_types, scalar>>;
+
+template <typename axes_t, template <std::size_t> class serializer_t>
+using nhood_grid_t = grid<axes_t, dindex, serializer_t, regular_attacher<4>>;
+
+template <typename axes_t, template <std::size_t> class serializer_t>
+auto construct_nhood_grid() {
+    using grid_t = nhood_grid_t<axes_t, serializer_t>;
+
+    dvector<dindex_range> edge_ranges{};
+    dvector<scalar> bin_edges{};
+
+    const auto n{static_cast<scalar>(n_bins_nhood)};
+    if constexpr (std::is_same_v<axes_t, regular_axes>) {
+        edge_ranges = {{0u, n_bins_nhood}, {2u, n_bins_nhood}};
+        bin_edges = {0.f, n, 0.f, n};
+    } else {
+        // Bins that get narrower towards the upper edge
+        edge_ranges = {{0u, n_bins_nhood},
+                       {n_bins_nhood + 1u, 2u * n_bins_nhood + 1u}};
+        for (unsigned int iaxis = 0u; iaxis < 2u; ++iaxis) {
+            for (dindex i = 0u; i <= n_bins_nhood; ++i) {
+                const scalar x{static_cast<scalar>(i) / n};
+                bin_edges.push_back(n * x * (2.f - x));
+            }
+        }
+    }
+    axes_t axes(std::move(edge_ranges), std::move(bin_edges));
+
+    typename grid_t::bin_storage_type bin_data(
+        n_bins_nhood * n_bins_nhood,
+        populator<typename grid_t::populator_impl>::template init<dindex>());
+
+    grid_t g(std::move(bin_data), std::move(axes));
+
+    // Fill every bin with its global index
+    for (dindex gbin = 0u; gbin < g.nbins(); ++gbin) {
+        g.populate(g.serializer()(g.axes(), gbin), dindex{gbin});
+    }
+
+    return g;
+}
+
+// This runs a 3x3 bin neighborhood lookup around random points
+template <typename grid_t>
+static void BM_GRID_NEIGHBORHOOD(benchmark::State &state, const grid_t &g) {
+    const auto n{static_cast<scalar>(n_bins_nhood)};
+    const int max_bin{static_cast<int>(n_bins_nhood) - 1};
+
+    for (auto _ : state) {
+        dindex sum{0u};
         for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
             test::point2<detray::scalar> p = {
-                static_cast<scalar>((rand() % 50)) * 0.5f,
-                static_cast<scalar>((rand() % 120)) * 0.5f};
-            g2irr.zone(p, {zone22, zone22});
+                n * static_cast<scalar>(rand()) / RAND_MAX,
+                n * static_cast<scalar>(rand()) / RAND_MAX};
+            const auto center = g.axes().bins(p);
+
+            for (int i = -1; i <= 1; ++i) {
+                for (int j = -1; j <= 1; ++j) {
+                    const int b0{static_cast<int>(center[0]) + i};
+                    const int b1{static_cast<int>(center[1]) + j};
+                    if (b0 < 0 or b1 < 0 or b0 > max_bin or b1 > max_bin) {
+                        continue;
+                    }
+                    for (const dindex entry :
+                         g.at(static_cast<dindex>(b0),
+                              static_cast<dindex>(b1))) {
+                        sum += entry;
+                    }
+                }
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// Random points on the grid, shared by the single and batched bin lookups
+auto construct_random_points() {
+    const auto n{static_cast<scalar>(n_bins_nhood)};
+    std::vector<test::point2<detray::scalar>> points(1000000u);
+    for (auto &p : points) {
+        p = {n * static_cast<scalar>(rand()) / RAND_MAX,
+             n * static_cast<scalar>(rand()) / RAND_MAX};
+    }
+    return points;
+}
+
+const auto random_points = construct_random_points();
+
+// This runs the global bin lookup point by point
+template <typename grid_t>
+static void BM_GRID_BIN(benchmark::State &state, const grid_t &g) {
+    std::vector<dindex> gbins(random_points.size());
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < random_points.size(); ++i) {
+            gbins[i] =
+                g.serializer()(g.axes(), g.axes().bins(random_points[i]));
+        }
+        benchmark::DoNotOptimize(gbins.data());
+    }
+}
+
+// This runs the batched global bin lookup
+template <typename grid_t>
+static void BM_GRID_BIN_BATCH(benchmark::State &state, const grid_t &g) {
+    std::vector<dindex> gbins(random_points.size());
+    for (auto _ : state) {
+        g.bins(random_points.data(), random_points.size(), gbins.data());
+        benchmark::DoNotOptimize(gbins.data());
+    }
+}
+
+// Counterparts of the legacy grids with the same binning and bin content
+template <typename axes_t, typename populator_impl_t>
+auto construct_tml_grid(const bool fill = true) {
+    using grid_t = grid<axes_t, dindex, simple_serializer, populator_impl_t>;
+
+    dvector<dindex_range> edge_ranges{};
+    dvector<scalar> bin_edges{};
+
+    if constexpr (std::is_same_v<axes_t, regular_axes>) {
+        edge_ranges = {{0u, n_bins_x}, {2u, n_bins_y}};
+        bin_edges = {0.f, 25.f, 0.f, 60.f};
+    } else {
+        edge_ranges = {{0u, n_bins_x},
+                       {n_bins_x + 1u, n_bins_x + 1u + n_bins_y}};
+        for (dindex i = 0u; i <= n_bins_x; ++i) {
+            bin_edges.push_back(static_cast<scalar>(i));
+        }
+        for (dindex i = 0u; i <= n_bins_y; ++i) {
+            bin_edges.push_back(static_cast<scalar>(i));
+        }
+    }
+    axes_t axes(std::move(edge_ranges), std::move(bin_edges));
+
+    typename grid_t::bin_storage_type bin_data(
+        n_bins_x * n_bins_y,
+        populator<populator_impl_t>::template init<dindex>());
+
+    grid_t g(std::move(bin_data), std::move(axes));
+    if (fill) {
+        fill_tml_grid(g);
+    }
+
+    return g;
+}
+
+const auto g_tml_reg = construct_tml_grid<regular_axes, replacer>();
+const auto g_tml_irr = construct_tml_grid<irregular_axes, replacer>();
+
+// This runs the single bin lookup of the grid, the counterpart of
+// BM_LEGACY_*_GRID_BIN
+template <typename grid_t>
+static void BM_TML_GRID_BIN(benchmark::State &state, const grid_t &g) {
+    for (auto _ : state) {
+        for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
+            benchmark::DoNotOptimize(*g.search(tml_point()).begin());
+        }
+    }
+}
+
+// This runs the zone lookup of the grid, the counterpart of
+// BM_LEGACY_*_GRID_ZONE
+template <typename grid_t>
+static void BM_TML_GRID_ZONE(benchmark::State &state, const grid_t &g) {
+    for (auto _ : state) {
+        for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
+            benchmark::DoNotOptimize(g.search(tml_point(), {zone22, zone22}));
+        }
+    }
+}
+
+// This runs the zone lookup without collecting the values in a vector
+template <typename grid_t>
+static void BM_TML_GRID_VISIT_ZONE(benchmark::State &state, const grid_t &g) {
+    for (auto _ : state) {
+        dindex sum{0u};
+        for (unsigned int itest = 0u; itest < 1000000u; ++itest) {
+            g.visit_zone(tml_point(),
+                         typename grid_t::template neighborhood_type<dindex>{
+                             {zone22, zone22}},
+                         [&sum](const dindex entry) { sum += entry; });
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// This fills four entries into every bin of an empty grid, the counterpart
+// of BM_LEGACY_GRID_POPULATE
+template <typename populator_impl_t>
+static void BM_TML_GRID_POPULATE(benchmark::State &state) {
+    for (auto _ : state) {
+        auto g = construct_tml_grid<regular_axes, populator_impl_t>(false);
+        for (unsigned int i = 0u; i < 4u; ++i) {
+            fill_tml_grid(g);
         }
+        benchmark::DoNotOptimize(g.data().bin_data()->data());
     }
+    state.SetItemsProcessed(state.iterations() * 4 * n_bins_x * n_bins_y);
 }
 
+// This fills four entries into every bin of an empty grid at once
+static void BM_TML_GRID_POPULATE_BULK(benchmark::State &state) {
+    std::vector<std::pair<n_axis::multi_bin<2>, dindex>> bin_entries;
+    for (unsigned int i = 0u; i < 4u; ++i) {
+        for (dindex ib1 = 0u; ib1 < n_bins_y; ++ib1) {
+            for (dindex ib0 = 0u; ib0 < n_bins_x; ++ib0) {
+                bin_entries.emplace_back(n_axis::multi_bin<2>{{ib0, ib1}},
+                                         ib0 + n_bins_x * ib1);
+            }
+        }
+    }
+
+    for (auto _ : state) {
+        auto g =
+            construct_tml_grid<regular_axes, irregular_attacher<>>(false);
+        g.populate(bin_entries);
+        benchmark::DoNotOptimize(g.data().bin_data()->data());
+    }
+    state.SetItemsProcessed(state.iterations() * 4 * n_bins_x * n_bins_y);
+}
+
+const auto g_reg_simple =
+    construct_nhood_grid<regular_axes, simple_serializer>();
+const auto g_reg_morton =
+    construct_nhood_grid<regular_axes, morton_serializer>();
+const auto g_reg_hilbert =
+    construct_nhood_grid<regular_axes, hilbert_serializer>();
+const auto g_irr_simple =
+    construct_nhood_grid<irregular_axes, simple_serializer>();
+const auto g_irr_morton =
+    construct_nhood_grid<irregular_axes, morton_serializer>();
+const auto g_irr_hilbert =
+    construct_nhood_grid<irregular_axes, hilbert_serializer>();
+
 // BENCHMARK(BM_RERERENCE_GRID);
-BENCHMARK(BM_REGULAR_GRID_BIN);
-BENCHMARK(BM_REGULAR_GRID_ZONE);
-BENCHMARK(BM_IRREGULAR_GRID_BIN);
-BENCHMARK(BM_IRREGULAR_GRID_ZONE);
+BENCHMARK(BM_LEGACY_REGULAR_GRID_BIN);
+BENCHMARK_CAPTURE(BM_TML_GRID_BIN, regular, g_tml_reg);
+BENCHMARK(BM_LEGACY_REGULAR_GRID_ZONE);
+BENCHMARK_CAPTURE(BM_TML_GRID_ZONE, regular, g_tml_reg);
+BENCHMARK_CAPTURE(BM_TML_GRID_VISIT_ZONE, regular, g_tml_reg);
+BENCHMARK(BM_LEGACY_IRREGULAR_GRID_BIN);
+BENCHMARK_CAPTURE(BM_TML_GRID_BIN, irregular, g_tml_irr);
+BENCHMARK(BM_LEGACY_IRREGULAR_GRID_ZONE);
+BENCHMARK_CAPTURE(BM_TML_GRID_ZONE, irregular, g_tml_irr);
+BENCHMARK_CAPTURE(BM_TML_GRID_VISIT_ZONE, irregular, g_tml_irr);
+BENCHMARK(BM_LEGACY_GRID_POPULATE);
+BENCHMARK_TEMPLATE(BM_TML_GRID_POPULATE, regular_attacher<4>);
+BENCHMARK_TEMPLATE(BM_TML_GRID_POPULATE, irregular_attacher<>);
+BENCHMARK(BM_TML_GRID_POPULATE_BULK);
+BENCHMARK_CAPTURE(BM_GRID_BIN, regular, g_reg_simple);
+BENCHMARK_CAPTURE(BM_GRID_BIN_BATCH, regular, g_reg_simple);
+BENCHMARK_CAPTURE(BM_GRID_BIN, irregular, g_irr_simple);
+BENCHMARK_CAPTURE(BM_GRID_BIN_BATCH, irregular, g_irr_simple);
+BENCHMARK_CAPTURE(BM_GRID_NEIGHBORHOOD, regular_simple, g_reg_simple);
+BENCHMARK_CAPTURE(BM_GRID_NEIGHBORHOOD, regular_morton, g_reg_morton);
+BENCHMARK_CAPTURE(BM_GRID_NEIGHBORHOOD, regular_hilbert, g_reg_hilbert);
+BENCHMARK_CAPTURE(BM_GRID_NEIGHBORHOOD, irregular_simple, g_irr_simple);
+BENCHMARK_CAPTURE(BM_GRID_NEIGHBORHOOD, irregular_morton, g_irr_morton);
+BENCHMARK_CAPTURE(BM_GRID_NEIGHBORHOOD, irregular_hilbert, g_irr_hilbert);
 
 }  // namespace
 
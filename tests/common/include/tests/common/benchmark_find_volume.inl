@@ -60,8 +60,8 @@ static void BM_FIND_VOLUMES(benchmark::State &state) {
     for (auto _ : state) {
         for (unsigned int i1 = 0u; i1 < itest; ++i1) {
             for (unsigned int i0 = 0u; i0 < itest; ++i0) {
-                vector3 rz{static_cast<scalar>(i0) * step0, 0.f,
-                           static_cast<scalar>(i1) * step1};
+                vector3 rz{range0[0] + static_cast<scalar>(i0) * step0, 0.f,
+                           range1[0] + static_cast<scalar>(i1) * step1};
                 const auto &v = d.volume_by_pos(rz);
 
                 benchmark::DoNotOptimize(successful);
@@ -90,4 +90,57 @@ BENCHMARK(BM_FIND_VOLUMES)
     ->Repetitions(gbench_repetitions)
     ->DisplayAggregatesOnly(true);
 
+// Benchmarks the cost of searching a volume by position, when the last
+// volume is passed as a hint
+static void BM_FIND_VOLUMES_HINT(benchmark::State &state) {
+    auto &volume_grid = d.volume_search_grid();
+
+    const auto &axis_r = volume_grid.get_axis<n_axis::label::e_r>();
+    const auto &axis_z = volume_grid.get_axis<n_axis::label::e_z>();
+
+    // Get a rough step size from irregular axes
+    auto range0 = axis_r.span();
+    auto range1 = axis_z.span();
+
+    scalar step0{(range0[1] - range0[0]) / itest};
+    scalar step1{(range1[1] - range1[0]) / itest};
+
+    std::size_t successful{0u};
+    std::size_t unsuccessful{0u};
+
+    dindex volume_hint{dindex_invalid};
+
+    for (auto _ : state) {
+        for (unsigned int i1 = 0u; i1 < itest; ++i1) {
+            for (unsigned int i0 = 0u; i0 < itest; ++i0) {
+                vector3 rz{range0[0] + static_cast<scalar>(i0) * step0, 0.f,
+                           range1[0] + static_cast<scalar>(i1) * step1};
+                const auto &v = d.volume_by_pos(rz, volume_hint);
+
+                benchmark::DoNotOptimize(successful);
+                benchmark::DoNotOptimize(unsuccessful);
+                if (v.index() == dindex_invalid) {
+                    ++unsuccessful;
+                } else {
+                    ++successful;
+                }
+                benchmark::ClobberMemory();
+            }
+        }
+    }
+
+#ifndef DETRAY_BENCHMARKS_MULTITHREAD
+    std::cout << "Successful   : " << successful << std::endl;
+    std::cout << "Unsuccessful : " << unsuccessful << std::endl;
+#endif
+}
+
+BENCHMARK(BM_FIND_VOLUMES_HINT)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+
 BENCHMARK_MAIN();
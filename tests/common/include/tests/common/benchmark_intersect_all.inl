@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2020-2022 CERN for the benefit of the ACTS project
+ * (c) 2020-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -9,6 +9,7 @@
 #include "detray/core/detector.hpp"
 #include "detray/detectors/create_toy_geometry.hpp"
 #include "detray/detectors/detector_metadata.hpp"
+#include "detray/geometry/compact_transform3.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
 #include "detray/simulation/event_generator/track_generators.hpp"
 #include "detray/tracks/tracks.hpp"
@@ -51,14 +52,40 @@ using intersection_t = intersection2D<typename detector_t::surface_type,
 using detray_context = detector_t::geometry_context;
 detray_context geo_context;
 
+using mask_store_t = typename detector_t::mask_container;
 const auto &masks = d.mask_store();
 const auto &transforms = d.transform_store(geo_context);
 
+// The same placements in compact, single precision storage
+using compact_store_t =
+    single_store<compact_transform3<typename detector_t::transform3, float>,
+                 dvector, detray_context>;
+const compact_store_t compact_transforms = [] {
+    compact_store_t store{};
+    for (const auto &trf : transforms.get(geo_context)) {
+        store.push_back(trf, geo_context);
+    }
+    return store;
+}();
+
+/// @returns the transform store the benchmark runs on
+template <bool compact_trfs>
+const auto &get_transforms() {
+    if constexpr (compact_trfs) {
+        return compact_transforms;
+    } else {
+        return transforms;
+    }
+}
+
 namespace __plugin {
 
 // This test runs intersection with all surfaces of the TrackML detector
+template <detail::visit_dispatch dispatch_v, bool compact_trfs = false>
 static void BM_INTERSECT_ALL(benchmark::State &state) {
 
+    const auto &trfs = get_transforms<compact_trfs>();
+
     /*std::ofstream hit_out;
     if (stream_file)
     {
@@ -84,9 +111,13 @@ static void BM_INTERSECT_ALL(benchmark::State &state) {
                 // Loop over all surfaces in volume
                 for (const auto &sf : d.surfaces(v)) {
 
-                    masks.template visit<intersection_initialize>(
-                        sf.mask(), intersections, detail::ray(track), sf,
-                        transforms);
+                    // Resolve the mask type with the given dispatch
+                    masks.data()
+                        ->template visit<intersection_initialize, dispatch_v>(
+                            mask_store_t::value_types::to_index(
+                                detail::get<0>(sf.mask())),
+                            detail::get<1>(sf.mask()), intersections,
+                            detail::ray(track), sf, trfs);
 
                     ++n_surfaces;
 
@@ -121,7 +152,103 @@ static void BM_INTERSECT_ALL(benchmark::State &state) {
     }*/
 }
 
-BENCHMARK(BM_INTERSECT_ALL)
+// This test runs the batched intersection with all surfaces of the TrackML
+// detector: Consecutive surfaces of the same mask type are intersected in
+// one call
+template <bool compact_trfs = false>
+static void BM_INTERSECT_ALL_BATCHED(benchmark::State &state) {
+
+    const auto &trfs = get_transforms<compact_trfs>();
+
+    std::size_t hits{0u};
+    std::size_t missed{0u};
+
+    for (auto _ : state) {
+        point3<detray::scalar> pos{0.f, 0.f, 0.f};
+        std::vector<intersection_t> intersections{};
+
+        // Iterate through uniformly distributed momentum directions
+        for (const auto track :
+             uniform_track_generator<free_track_parameters<transform3<scalar>>>(
+                 theta_steps, phi_steps, pos)) {
+
+            // Loop over volumes
+            for (const auto &v : d.volumes()) {
+                const auto sfs = d.surfaces(v);
+                const auto n_surfaces{static_cast<dindex>(sfs.size())};
+
+                // Loop over all runs of surfaces with the same mask type
+                dindex first{0u};
+                for (dindex i = 1u; i <= n_surfaces; ++i) {
+                    const auto mask_id{detail::get<0>(sfs[first].mask())};
+                    if (i < n_surfaces and
+                        detail::get<0>(sfs[i].mask()) == mask_id) {
+                        continue;
+                    }
+                    masks.data()->template visit<intersection_initialize>(
+                        mask_store_t::value_types::to_index(mask_id),
+                        detray::ranges::subrange(sfs, dindex_range{first, i}),
+                        intersections, detail::ray(track), trfs);
+                    first = i;
+                }
+                benchmark::DoNotOptimize(hits);
+                benchmark::DoNotOptimize(missed);
+
+                hits += intersections.size();
+                missed += n_surfaces - intersections.size();
+
+                intersections.clear();
+            }
+        }
+    }
+
+#ifndef DETRAY_BENCHMARKS_MULTITHREAD
+    std::cout << "[detray] hits / missed / total = " << hits << " / " << missed
+              << " / " << hits + missed << std::endl;
+#endif
+}
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_ALL, detail::visit_dispatch::e_linear)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_ALL, detail::visit_dispatch::e_jump_table)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_ALL, detail::visit_dispatch::e_switch)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_ALL, detail::visit_dispatch::e_linear, true)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_ALL_BATCHED, false)
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+
+BENCHMARK_TEMPLATE(BM_INTERSECT_ALL_BATCHED, true)
 #ifdef DETRAY_BENCHMARKS_MULTITHREAD
     ->ThreadPerCpu()
 #endif
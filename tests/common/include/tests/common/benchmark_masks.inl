@@ -7,9 +7,12 @@
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 #include "detray/intersection/intersection.hpp"
 #include "detray/masks/masks.hpp"
@@ -31,6 +34,13 @@ const unsigned int steps_x2 =
     static_cast<unsigned int>(std::sqrt(steps_x3 * steps_y3 * steps_z3));
 const unsigned int steps_y2 = steps_x2;
 
+/// Number of points per benchmark iteration
+constexpr std::int64_t n_points{static_cast<std::int64_t>(steps_x3) *
+                                steps_y3 * steps_z3};
+
+/// Number of points that are checked against a mask at once
+constexpr std::size_t batch_size{16u};
+
 bool screen_output = false;
 
 using transform_t = __plugin::transform3<detray::scalar>;
@@ -77,6 +87,9 @@ static void BM_RECTANGLE_2D_MASK(benchmark::State &state) {
         }
     }
 
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            n_points);
+
     if (screen_output) {
         std::cout << "Rectangle : Inside/outside ... " << inside << " / "
                   << outside << " = "
@@ -123,6 +136,9 @@ static void BM_TRAPEZOID_2D_MASK(benchmark::State &state) {
         }
     }
 
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            n_points);
+
     if (screen_output) {
         std::cout << "Trapezoid : Inside/outside ..." << inside << " / "
                   << outside << " = "
@@ -168,6 +184,9 @@ static void BM_RING_2D_MASK(benchmark::State &state) {
             }
         }
     }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            n_points);
+
     if (screen_output) {
         std::cout << "Disc : Inside/outside ..." << inside << " / " << outside
                   << " = "
@@ -213,6 +232,9 @@ static void BM_DISC_2D_MASK(benchmark::State &state) {
             }
         }
     }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            n_points);
+
     if (screen_output) {
         std::cout << "Ring : Inside/outside ..." << inside << " / " << outside
                   << " = "
@@ -257,6 +279,9 @@ static void BM_CYLINDER_2D_MASK(benchmark::State &state) {
             }
         }
     }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            n_points);
+
     if (screen_output) {
         std::cout << "Cylinder : Inside/outside ..." << inside << " / "
                   << outside << " = "
@@ -302,6 +327,9 @@ static void BM_ANNULUS_2D_MASK(benchmark::State &state) {
             }
         }
     }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            n_points);
+
     if (screen_output) {
         std::cout << "Annulus : Inside/outside ..." << inside << " / "
                   << outside << " = "
@@ -310,6 +338,71 @@ static void BM_ANNULUS_2D_MASK(benchmark::State &state) {
     }
 }
 
+/// @returns the grid of @c steps_x3 x @c steps_y3 points in the local frame
+/// of the mask @param m that are used in the boundary check benchmarks
+template <typename mask_t>
+std::vector<typename mask_t::loc_point_t> local_points(const mask_t &m) {
+    constexpr scalar world{10.f};
+
+    constexpr scalar sx{world / steps_x3};
+    constexpr scalar sy{world / steps_y3};
+
+    std::vector<typename mask_t::loc_point_t> points;
+    points.reserve(steps_x3 * steps_y3);
+    for (unsigned int ix = 0u; ix < steps_x3; ++ix) {
+        scalar x{-0.5f * world + static_cast<scalar>(ix) * sx};
+        for (unsigned int iy = 0u; iy < steps_y3; ++iy) {
+            scalar y{-0.5f * world + static_cast<scalar>(iy) * sy};
+            points.push_back(m.to_local_frame(trf, {x, y, 0.f}));
+        }
+    }
+    return points;
+}
+
+// This runs a benchmark on the boundary check of a mask, point by point
+template <typename mask_t>
+static void BM_MASK_CHECK(benchmark::State &state, const mask_t &m) {
+    const auto points = local_points(m);
+
+    unsigned long inside = 0u;
+
+    for (auto _ : state) {
+        for (const auto &loc_p : points) {
+            inside += static_cast<unsigned long>(
+                m.is_inside(loc_p) == intersection::status::e_inside);
+        }
+        benchmark::DoNotOptimize(inside);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(points.size()));
+}
+
+// This runs a benchmark on the boundary check of a mask, with batches of
+// points that are checked at once
+template <typename mask_t>
+static void BM_MASK_CHECK_BATCHED(benchmark::State &state, const mask_t &m) {
+    using point_t = typename mask_t::loc_point_t;
+
+    const auto points = local_points(m);
+    const std::size_t n_batches{points.size() / batch_size};
+
+    darray<point_t, batch_size> batch{};
+    darray<bool, batch_size> is_inside{};
+    unsigned long inside = 0u;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0u; i < n_batches; ++i) {
+            std::copy_n(points.begin() + static_cast<std::ptrdiff_t>(
+                                             i * batch_size),
+                        batch_size, batch.begin());
+            inside += m.is_inside(batch, is_inside);
+        }
+        benchmark::DoNotOptimize(inside);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                            static_cast<std::int64_t>(n_batches * batch_size));
+}
+
 BENCHMARK(BM_RECTANGLE_2D_MASK)
 #ifdef DETRAY_BENCHMARKS_MULTITHREAD
     ->ThreadPerCpu()
@@ -353,6 +446,100 @@ BENCHMARK(BM_ANNULUS_2D_MASK)
     ->Repetitions(gbench_repetitions)
     ->DisplayAggregatesOnly(true);
 
+BENCHMARK_CAPTURE(BM_MASK_CHECK, rectangle2D, mask<rectangle2D<>>{0u, 3.f, 4.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK, trapezoid2D,
+                  mask<trapezoid2D<>>{0u, 2.f, 3.f, 4.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK, disc2D, mask<ring2D<>>{0u, 0.f, 5.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK, ring2D, mask<ring2D<>>{0u, 2.f, 5.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK, cylinder2D,
+                  mask<cylinder2D<>>{0u, 3.f, 5.f, 0.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK, annulus2D,
+                  mask<annulus2D<>>{0u, 2.5f, 5.f, -0.64299f, 4.13173f, 1.f,
+                                    0.5f, 0.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK_BATCHED, rectangle2D,
+                  mask<rectangle2D<>>{0u, 3.f, 4.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK_BATCHED, trapezoid2D,
+                  mask<trapezoid2D<>>{0u, 2.f, 3.f, 4.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK_BATCHED, disc2D, mask<ring2D<>>{0u, 0.f, 5.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK_BATCHED, ring2D, mask<ring2D<>>{0u, 2.f, 5.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK_BATCHED, cylinder2D,
+                  mask<cylinder2D<>>{0u, 3.f, 5.f, 0.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+BENCHMARK_CAPTURE(BM_MASK_CHECK_BATCHED, annulus2D,
+                  mask<annulus2D<>>{0u, 2.5f, 5.f, -0.64299f, 4.13173f, 1.f,
+                                    0.5f, 0.f})
+#ifdef DETRAY_BENCHMARKS_MULTITHREAD
+    ->ThreadPerCpu()
+#endif
+    ->Unit(benchmark::kMillisecond)
+    ->Repetitions(gbench_repetitions)
+    ->DisplayAggregatesOnly(true);
+
 }  // namespace
 
 BENCHMARK_MAIN();
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <sstream>
+#include <vector>
 #include <vecmem/memory/host_memory_resource.hpp>
 
 #include "detray/definitions/units.hpp"
@@ -121,6 +122,69 @@ TEST(ALGEBRA_PLUGIN, straight_line_navigation) {
     }
 }
 
+/// This test compares the straight line navigation through the toy detector
+/// when only the closest candidates are kept in the navigation cache with the
+/// navigation that keeps all candidates.
+TEST(ALGEBRA_PLUGIN, straight_line_navigation_top_k) {
+
+    // Detector configuration
+    constexpr std::size_t n_brl_layers{4u};
+    constexpr std::size_t n_edc_layers{7u};
+    vecmem::host_memory_resource host_mr;
+    auto det = create_toy_geometry(host_mr, n_brl_layers, n_edc_layers);
+
+    using detector_t = decltype(det);
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, transform3_t>;
+    using object_tracer_t =
+        object_tracer<intersection_t, dvector, status::e_on_module,
+                      status::e_on_portal>;
+    using inspector_t = aggregate_inspector<object_tracer_t, print_inspector>;
+    using navigator_t = navigator<detector_t, inspector_t>;
+    using stepper_t = line_stepper<transform3_t>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    propagator_t prop(stepper_t{}, navigator_t{});
+
+    constexpr std::size_t theta_steps{50u};
+    constexpr std::size_t phi_steps{50u};
+
+    const point3 ori{0.f, 0.f, 0.f};
+
+    for (const auto ray :
+         uniform_track_generator<ray_type>(theta_steps, phi_steps, ori)) {
+
+        free_track_parameters_type track(ray.pos(), 0.f, ray.dir(), -1.f);
+
+        // Reference: keep all candidates
+        det.set_n_top_candidates(0u);
+        propagator_t::state ref_propagation(track, det);
+        ASSERT_TRUE(prop.propagate(ref_propagation));
+        const auto &ref_trace = ref_propagation._navigation.inspector()
+                                    .template get<object_tracer_t>()
+                                    .object_trace;
+
+        // Keep only the three closest candidates
+        det.set_n_top_candidates(3u);
+        propagator_t::state propagation(track, det);
+
+        auto &inspector = propagation._navigation.inspector();
+        auto &debug_printer = inspector.template get<print_inspector>();
+
+        ASSERT_TRUE(prop.propagate(propagation)) << debug_printer.to_string();
+
+        const auto &trace =
+            inspector.template get<object_tracer_t>().object_trace;
+
+        ASSERT_EQ(trace.size(), ref_trace.size()) << debug_printer.to_string();
+        for (std::size_t i = 0u; i < trace.size(); ++i) {
+            EXPECT_EQ(trace[i].surface.barcode(),
+                      ref_trace[i].surface.barcode())
+                << debug_printer.to_string();
+        }
+    }
+}
+
 /// Check the Runge-Kutta based navigation against a helix trajectory as ground
 /// truth
 TEST(ALGEBRA_PLUGIN, helix_navigation) {
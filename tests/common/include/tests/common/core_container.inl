@@ -146,3 +146,78 @@ TEST(container, vector_multi_type_store) {
     EXPECT_EQ(vector_store.visit<test_func>(std::make_pair(1u, 0u)), 3u);
     EXPECT_EQ(vector_store.visit<test_func>(std::make_pair(2u, 0u)), 4u);
 }
+
+namespace {
+
+/// Returns the type ID a collection was visited with
+template <std::size_t I>
+struct tagged {
+    static constexpr std::size_t id{I};
+};
+
+struct id_func {
+    template <typename tagged_t>
+    auto operator()(const tagged_t& /*element*/, const unsigned int offset) {
+        return tagged_t::id + offset;
+    }
+};
+
+struct void_func {
+    template <typename tagged_t>
+    void operator()(const tagged_t& /*element*/, std::size_t& visited) {
+        visited = tagged_t::id;
+    }
+};
+
+}  // anonymous namespace
+
+TEST(container, visit_dispatch) {
+
+    // More than one block of switch cases
+    using tuple_t =
+        detail::tuple_container<std::tuple, tagged<0>, tagged<1>, tagged<2>,
+                                tagged<3>, tagged<4>, tagged<5>, tagged<6>,
+                                tagged<7>, tagged<8>, tagged<9>, tagged<10>>;
+
+    const tuple_t container{};
+
+    constexpr auto linear = detail::visit_dispatch::e_linear;
+    constexpr auto table = detail::visit_dispatch::e_jump_table;
+    constexpr auto swtch = detail::visit_dispatch::e_switch;
+
+    for (std::size_t i = 0u; i < container.size(); ++i) {
+        EXPECT_EQ((container.visit<id_func, linear>(i, 100u)), i + 100u);
+        EXPECT_EQ((container.visit<id_func, table>(i, 100u)), i + 100u);
+        EXPECT_EQ((container.visit<id_func, swtch>(i, 100u)), i + 100u);
+
+        std::size_t visited{0u};
+        container.visit<void_func, table>(i, visited);
+        EXPECT_EQ(visited, i);
+        visited = 0u;
+        container.visit<void_func, swtch>(i, visited);
+        EXPECT_EQ(visited, i);
+    }
+
+    // Unknown type ID: default result
+    EXPECT_EQ((container.visit<id_func, table>(11u, 100u)), 0u);
+    EXPECT_EQ((container.visit<id_func, swtch>(11u, 100u)), 0u);
+    EXPECT_EQ((container.visit<id_func, swtch>(42u, 100u)), 0u);
+
+    // Stores that use a jump table
+    vecmem::host_memory_resource resource;
+
+    regular_jump_table_store<std::size_t, empty_context, std::tuple,
+                             vecmem::vector, std::size_t, float, double>
+        vector_store(resource);
+
+    static_assert(decltype(vector_store)::dispatch == table,
+                  "Store does not use jump table");
+
+    vector_store.push_back<0>(1u);
+    vector_store.push_back<1>(3.1f);
+    vector_store.push_back<1>(4.5f);
+
+    EXPECT_EQ(vector_store.visit<test_func>(std::make_pair(0u, 0u)), 1u);
+    EXPECT_EQ(vector_store.visit<test_func>(std::make_pair(1u, 0u)), 2u);
+    EXPECT_EQ(vector_store.visit<test_func>(std::make_pair(2u, 0u)), 0u);
+}
@@ -8,9 +8,14 @@
 // Project include(s)
 #include "detray/core/detector.hpp"
 #include "detray/detectors/detector_metadata.hpp"
+#include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_intersection_kernel.hpp"
+#include "detray/intersection/intersection_kernel.hpp"
 #include "detray/materials/predefined_materials.hpp"
+#include "detray/tools/grid_builder.hpp"
 #include "detray/tools/surface_factory.hpp"
 #include "detray/tools/volume_builder.hpp"
+#include "detray/tracks/tracks.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -20,6 +25,7 @@
 
 // System include(s)
 #include <memory>
+#include <vector>
 
 namespace {
 
@@ -701,3 +707,465 @@ TEST(detector, detector_volume_construction) {
     volume_links = {0u, 1u};
     check_mask<detector_t, mask_id::e_trapezoid2>(d, volume_links);
 }
+
+/// This tests the grouping of the surfaces of a volume by mask type
+TEST(detector, group_by_mask_type) {
+
+    using namespace detray;
+
+    using detector_t =
+        detector<detector_registry::default_detector, covfie::field>;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+    using surface_t = typename detector_t::surface_type;
+
+    auto make_surface = [](const dindex trf, const mask_id id,
+                           const surface_id sf_id) {
+        return surface_t{trf, {id, 0u}, {material_id::e_slab, 0u}, 0u,
+                         0u,  sf_id};
+    };
+
+    // Portals, then sensitives with interleaved mask types, then passives
+    typename detector_t::surface_container_t surfaces{
+        make_surface(0u, mask_id::e_portal_cylinder2, surface_id::e_portal),
+        make_surface(1u, mask_id::e_portal_ring2, surface_id::e_portal),
+        make_surface(2u, mask_id::e_portal_cylinder2, surface_id::e_portal),
+        make_surface(3u, mask_id::e_trapezoid2, surface_id::e_sensitive),
+        make_surface(4u, mask_id::e_rectangle2, surface_id::e_sensitive),
+        make_surface(5u, mask_id::e_trapezoid2, surface_id::e_sensitive),
+        make_surface(6u, mask_id::e_rectangle2, surface_id::e_sensitive),
+        make_surface(7u, mask_id::e_trapezoid2, surface_id::e_sensitive),
+        make_surface(8u, mask_id::e_cylinder2, surface_id::e_passive)};
+
+    detail::group_by_mask_type(surfaces);
+
+    // The kinds stay in place, the mask types are ordered by their first
+    // surface and the surfaces keep their order within a group
+    const std::vector<dindex> expected_order{0u, 2u, 1u, 3u, 5u,
+                                             7u, 4u, 6u, 8u};
+    ASSERT_EQ(surfaces.size(), expected_order.size());
+    for (std::size_t i = 0u; i < surfaces.size(); ++i) {
+        EXPECT_EQ(surfaces[i].transform(), expected_order[i])
+            << "error at index: " << i;
+    }
+}
+
+/// This tests the reordering of the detector data for memory locality
+TEST(detector, optimize_layout) {
+
+    using namespace detray;
+
+    using detector_t =
+        detector<detector_registry::default_detector, covfie::field>;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+    using mask_link_t = typename detector_t::mask_link;
+    using material_link_t = typename detector_t::material_link;
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+    auto geo_ctx = typename detector_t::geometry_context{};
+    detray::empty_context empty_ctx{};
+
+    prefill_detector(d, geo_ctx);
+
+    // Add a volume, in which the surfaces link their data in reverse order
+    auto& vol = d.new_volume(volume_id::e_cylinder,
+                             {10.f, 20.f, -5.f, 5.f, -constant<scalar>::pi,
+                              constant<scalar>::pi});
+
+    typename detector_t::transform_container trfs(host_mr);
+    typename detector_t::surface_container_t surfaces{};
+    typename detector_t::mask_container masks(host_mr);
+    typename detector_t::material_container materials(host_mr);
+
+    constexpr dindex n_sf{4u};
+    for (dindex i = 0u; i < n_sf; ++i) {
+        const auto s{static_cast<scalar>(i)};
+        trfs.emplace_back(geo_ctx, point3{s, s, s});
+        masks.template emplace_back<mask_id::e_rectangle2>(empty_ctx, 1u,
+                                                           s + 1.f, s + 2.f);
+        materials.template emplace_back<material_id::e_slab>(
+            empty_ctx, detray::silicon<scalar>(), s + 1.f);
+    }
+    for (dindex i = 0u; i < n_sf; ++i) {
+        const dindex j{n_sf - 1u - i};
+        surfaces.emplace_back(j, mask_link_t{mask_id::e_rectangle2, j},
+                              material_link_t{material_id::e_slab, j}, 1u,
+                              dindex_invalid, surface_id::e_sensitive);
+    }
+    d.add_objects_per_volume(geo_ctx, vol, surfaces, masks, trfs, materials);
+
+    // Record the data every surface sees
+    const auto& rectangles =
+        d.mask_store().template get<mask_id::e_rectangle2>();
+    const auto& slabs = d.material_store().template get<material_id::e_slab>();
+
+    std::vector<point3> translations;
+    std::vector<std::string> rect_masks;
+    std::vector<scalar> thicknesses;
+    for (const auto& sf : d.surfaces()) {
+        translations.push_back(
+            d.transform_store()[sf.transform()].translation());
+        if (sf.mask().id() == mask_id::e_rectangle2) {
+            rect_masks.push_back(rectangles[sf.mask().index()].to_string());
+        }
+        if (sf.material().id() == material_id::e_slab) {
+            thicknesses.push_back(slabs[sf.material().index()].thickness());
+        }
+    }
+
+    d.optimize_layout(geo_ctx);
+
+    // The surfaces still see the same data, but now in surface order
+    std::size_t n_rect{0u};
+    std::size_t n_slab{0u};
+    for (const auto [i, sf] : detray::views::enumerate(d.surfaces())) {
+        EXPECT_EQ(sf.index(), i);
+        EXPECT_EQ(sf.transform(), i);
+
+        const auto& t = d.transform_store()[sf.transform()].translation();
+        EXPECT_NEAR(t[0], translations[i][0], tol);
+        EXPECT_NEAR(t[1], translations[i][1], tol);
+        EXPECT_NEAR(t[2], translations[i][2], tol);
+
+        if (sf.mask().id() == mask_id::e_rectangle2) {
+            EXPECT_EQ(sf.mask().index(), n_rect);
+            EXPECT_EQ(rectangles[sf.mask().index()].to_string(),
+                      rect_masks[n_rect]);
+            ++n_rect;
+        }
+        if (sf.material().id() == material_id::e_slab) {
+            EXPECT_EQ(sf.material().index(), n_slab);
+            EXPECT_NEAR(slabs[sf.material().index()].thickness(),
+                        thicknesses[n_slab], tol);
+            ++n_slab;
+        }
+    }
+    EXPECT_EQ(n_rect, n_sf + 1u);
+    EXPECT_EQ(n_slab, n_sf + 2u);
+}
+
+namespace {
+
+/// Metadata with a cylinder surface grid collection
+struct surface_grid_metadata
+    : public detray::detector_registry::default_detector {
+
+    enum class sf_finder_ids {
+        e_brute_force = 0,
+        e_cylinder_grid = 1,
+        e_default = e_brute_force,
+    };
+
+    template <template <typename...> class tuple_t = detray::dtuple,
+              typename container_t = detray::host_container_types>
+    using surface_finder_store = detray::multi_store<
+        sf_finder_ids, detray::empty_context, tuple_t,
+        detray::brute_force_collection<surface_type, container_t>,
+        detray::grid_collection<
+            detray::cylinder_sf_grid<surface_type, container_t>>>;
+};
+
+}  // anonymous namespace
+
+/// This tests the reordering of the detector data for the grid bin locality
+TEST(detector, optimize_layout_grid) {
+
+    using namespace detray;
+
+    using detector_t = detector<surface_grid_metadata, covfie::field>;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+    using mask_link_t = typename detector_t::mask_link;
+    using material_link_t = typename detector_t::material_link;
+
+    constexpr auto grid_id{detector_t::sf_finders::id::e_cylinder_grid};
+    using cyl_grid_t =
+        typename detector_t::surface_container::template get_type<grid_id>;
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+    auto geo_ctx = typename detector_t::geometry_context{};
+    detray::empty_context empty_ctx{};
+
+    auto& vol = d.new_volume(volume_id::e_cylinder,
+                             {10.f, 20.f, -5.f, 5.f, -constant<scalar>::pi,
+                              constant<scalar>::pi});
+
+    typename detector_t::transform_container trfs(host_mr);
+    typename detector_t::surface_container_t surfaces{};
+    typename detector_t::mask_container masks(host_mr);
+    typename detector_t::material_container materials(host_mr);
+
+    // Modules on a cylinder: surface i lies in the grid bin bins[i], while
+    // it links its data in reverse order
+    constexpr dindex n_sf{4u};
+    constexpr std::array<dindex, n_sf> bins{2u, 0u, 3u, 1u};
+    for (dindex j = 0u; j < n_sf; ++j) {
+        const dindex b{bins[n_sf - 1u - j]};
+        const scalar y{b % 2u == 0u ? -15.f : 15.f};
+        const scalar z{b < 2u ? -2.5f : 2.5f};
+        const auto s{static_cast<scalar>(j)};
+
+        trfs.emplace_back(geo_ctx, point3{0.f, y, z});
+        masks.template emplace_back<mask_id::e_rectangle2>(empty_ctx, 1u,
+                                                           s + 1.f, s + 2.f);
+        materials.template emplace_back<material_id::e_slab>(
+            empty_ctx, detray::silicon<scalar>(), s + 1.f);
+    }
+    for (dindex i = 0u; i < n_sf; ++i) {
+        const dindex j{n_sf - 1u - i};
+        surfaces.emplace_back(j, mask_link_t{mask_id::e_rectangle2, j},
+                              material_link_t{material_id::e_slab, j}, 0u,
+                              dindex_invalid, surface_id::e_sensitive);
+    }
+    d.add_objects_per_volume(geo_ctx, vol, surfaces, masks, trfs, materials);
+
+    // Fill the surfaces into a grid with two bins in phi and z each
+    auto gbuilder =
+        grid_builder<detector_t, cyl_grid_t, detail::fill_by_pos>{};
+    gbuilder.init_grid(mask<cylinder2D<>>{0u, 15.f, -5.f, 5.f}, {2u, 2u});
+    gbuilder.fill_grid(d, vol, geo_ctx);
+    d.surface_store().template push_back<grid_id>(gbuilder());
+    vol.set_link(grid_id, 0u);
+
+    // Record the data every surface sees
+    const auto& rectangles =
+        d.mask_store().template get<mask_id::e_rectangle2>();
+    const auto& slabs = d.material_store().template get<material_id::e_slab>();
+
+    std::vector<point3> translations;
+    std::vector<std::string> rect_masks;
+    std::vector<scalar> thicknesses;
+    for (const auto& sf : d.surfaces()) {
+        translations.push_back(
+            d.transform_store()[sf.transform()].translation());
+        rect_masks.push_back(rectangles[sf.mask().index()].to_string());
+        thicknesses.push_back(slabs[sf.material().index()].thickness());
+    }
+
+    d.optimize_layout(geo_ctx);
+
+    // The data is laid out in the order of the grid bins
+    const auto gr = d.surface_store().template get<grid_id>()[0u];
+    ASSERT_EQ(gr.nbins(), n_sf);
+
+    dindex n_entries{0u};
+    for (dindex gbin = 0u; gbin < gr.nbins(); ++gbin) {
+        for (const auto& sf : gr.at(gbin)) {
+            EXPECT_EQ(sf.transform(), n_entries);
+            EXPECT_EQ(sf.mask().index(), n_entries);
+            EXPECT_EQ(sf.material().index(), n_entries);
+
+            // The grid entry matches the surface in the surface store
+            ASSERT_LT(sf.index(), n_sf);
+            EXPECT_EQ(bins[sf.index()], gbin);
+            EXPECT_EQ(sf, d.surfaces()[sf.index()]);
+            ++n_entries;
+        }
+    }
+    EXPECT_EQ(n_entries, n_sf);
+
+    // The surfaces still see the same data
+    for (const auto [i, sf] : detray::views::enumerate(d.surfaces())) {
+        EXPECT_EQ(sf.index(), i);
+
+        const auto& t = d.transform_store()[sf.transform()].translation();
+        EXPECT_NEAR(t[0], translations[i][0], tol);
+        EXPECT_NEAR(t[1], translations[i][1], tol);
+        EXPECT_NEAR(t[2], translations[i][2], tol);
+        EXPECT_EQ(rectangles[sf.mask().index()].to_string(), rect_masks[i]);
+        EXPECT_NEAR(slabs[sf.material().index()].thickness(), thicknesses[i],
+                    tol);
+    }
+}
+
+/// This tests the navigation metadata that is computed per volume
+TEST(detector, navigation_info) {
+
+    using namespace detray;
+
+    using detector_t =
+        detector<detector_registry::default_detector, covfie::field>;
+    using mask_id = typename detector_t::masks::id;
+    using material_id = typename detector_t::materials::id;
+    using mask_link_t = typename detector_t::mask_link;
+    using material_link_t = typename detector_t::material_link;
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+    auto geo_ctx = typename detector_t::geometry_context{};
+    detray::empty_context empty_ctx{};
+
+    // The prefilled volume is not built with 'add_objects_per_volume': Its
+    // navigation metadata exists, but is empty until it is computed
+    prefill_detector(d, geo_ctx);
+    ASSERT_EQ(d.navigation_info().size(), 1u);
+    EXPECT_EQ(d.navigation_info(0u).n_max_candidates(), 0u);
+    d.update_navigation_info(geo_ctx);
+
+    ASSERT_EQ(d.navigation_info().size(), 1u);
+    EXPECT_EQ(d.navigation_info(0u).n_max_candidates(), 3u);
+    EXPECT_EQ(d.navigation_info(0u).n_typical_candidates(), 3u);
+    EXPECT_EQ(d.navigation_info(0u).n_portals, 0u);
+
+    // Add a volume with four shifted rectangles and one portal
+    auto& vol = d.new_volume(volume_id::e_cylinder,
+                             {10.f, 20.f, -5.f, 5.f, -constant<scalar>::pi,
+                              constant<scalar>::pi});
+
+    typename detector_t::transform_container trfs(host_mr);
+    typename detector_t::surface_container_t surfaces{};
+    typename detector_t::mask_container masks(host_mr);
+    typename detector_t::material_container materials(host_mr);
+
+    constexpr dindex n_sf{5u};
+    for (dindex i = 0u; i < n_sf; ++i) {
+        const auto s{static_cast<scalar>(i)};
+        trfs.emplace_back(geo_ctx, point3{s, s, s});
+        masks.template emplace_back<mask_id::e_rectangle2>(empty_ctx, 1u,
+                                                           s + 1.f, s + 2.f);
+        materials.template emplace_back<material_id::e_slab>(
+            empty_ctx, detray::silicon<scalar>(), 1.f);
+        surfaces.emplace_back(
+            i, mask_link_t{mask_id::e_rectangle2, i},
+            material_link_t{material_id::e_slab, i}, 1u, dindex_invalid,
+            i == n_sf - 1u ? surface_id::e_portal : surface_id::e_sensitive);
+    }
+    d.add_objects_per_volume(geo_ctx, vol, surfaces, masks, trfs, materials);
+
+    ASSERT_EQ(d.navigation_info().size(), 2u);
+    const auto& info = d.navigation_info(1u);
+    EXPECT_EQ(info.n_max_candidates(), n_sf);
+    EXPECT_EQ(info.n_typical_candidates(), n_sf);
+    EXPECT_EQ(info.n_portals, 1u);
+    EXPECT_EQ(d.n_max_candidates(), n_sf);
+
+    // The extent is spanned by the first and the last rectangle
+    constexpr scalar env{1e-4f};
+    EXPECT_NEAR(info.extent[0], -1.f, env);
+    EXPECT_NEAR(info.extent[1], -2.f, env);
+    EXPECT_NEAR(info.extent[2], 0.f, env);
+    EXPECT_NEAR(info.extent[3], 9.f, env);
+    EXPECT_NEAR(info.extent[4], 10.f, env);
+    EXPECT_NEAR(info.extent[5], 4.f, env);
+
+    // Bounding spheres of the rectangles: centred on the surface origin
+    ASSERT_EQ(d.bounding_spheres().size(), d.surfaces().size());
+    const auto& sf = d.surfaces().back();
+    const auto sphere = d.bounding_sphere(sf);
+    EXPECT_NEAR(sphere.center[0], 4.f, env);
+    EXPECT_NEAR(sphere.center[1], 4.f, env);
+    EXPECT_NEAR(sphere.center[2], 4.f, env);
+    EXPECT_NEAR(sphere.radius, std::sqrt(5.f * 5.f + 6.f * 6.f), env);
+
+    // Rays that pass through the sphere, miss it or start behind it
+    using ray_t = detail::ray<typename detector_t::transform3>;
+    const ray_t hit{point3{4.f, 4.f, -10.f}, 0.f, vector3{0.f, 0.f, 1.f},
+                    0.f};
+    const ray_t miss{point3{20.f, 4.f, -10.f}, 0.f, vector3{0.f, 0.f, 1.f},
+                     0.f};
+    const ray_t behind{point3{4.f, 4.f, 20.f}, 0.f, vector3{0.f, 0.f, 1.f},
+                       0.f};
+    EXPECT_TRUE(sphere.is_reachable(hit));
+    EXPECT_FALSE(sphere.is_reachable(miss));
+    EXPECT_FALSE(sphere.is_reachable(behind));
+    // Unbounded surfaces are never rejected
+    EXPECT_TRUE(typename detector_t::bounding_sphere_type{}.is_reachable(miss));
+
+    // Safety distance to the sphere: zero inside of it
+    EXPECT_NEAR(sphere.safety(point3{4.f, 4.f, -10.f}),
+                14.f - std::sqrt(5.f * 5.f + 6.f * 6.f), 1e-3f);
+    EXPECT_FLOAT_EQ(sphere.safety(point3{4.f, 4.f, 5.f}), 0.f);
+    EXPECT_FLOAT_EQ(typename detector_t::bounding_sphere_type{}.safety(
+                        point3{20.f, 4.f, -10.f}),
+                    0.f);
+}
+
+namespace {
+
+/// Metadata that stores the surface placements in compact form
+struct compact_transform_metadata
+    : public detray::detector_registry::default_detector {
+    template <template <typename...> class vector_t = detray::dvector>
+    using transform_store = detray::single_store<
+        detray::compact_transform3<__plugin::transform3<detray::scalar>,
+                                   float>,
+        vector_t, detray::geometry_context>;
+};
+
+}  // anonymous namespace
+
+/// This tests a detector with compact transform storage
+TEST(detector, compact_transforms) {
+
+    using namespace detray;
+
+    using detector_t =
+        detector<detector_registry::default_detector, covfie::field>;
+    using compact_detector_t =
+        detector<compact_transform_metadata, covfie::field>;
+
+    static_assert(std::is_same_v<typename compact_detector_t::transform3,
+                                 typename detector_t::transform3>,
+                  "Compact detector has wrong algebra transform type");
+
+    vecmem::host_memory_resource host_mr;
+    detector_t d(host_mr);
+    compact_detector_t cd(host_mr);
+    auto geo_ctx = typename detector_t::geometry_context{};
+
+    prefill_detector(d, geo_ctx);
+    prefill_detector(cd, geo_ctx);
+
+    ASSERT_EQ(cd.transform_store().size(), d.transform_store().size());
+
+    using transform3 = typename compact_detector_t::transform3;
+
+    const point3 glob_pos{4.f, 7.f, 4.f};
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+    for (const auto& sf : d.surfaces()) {
+        const auto& trf = d.transform_store()[sf.transform()];
+        const auto& c_trf = cd.transform_store()[sf.transform()];
+        // Expand to the full transform
+        const auto e_trf = static_cast<transform3>(c_trf);
+
+        const point3 loc = trf.point_to_local(glob_pos);
+        const point3 c_loc = c_trf.point_to_local(glob_pos);
+        const point3 e_loc = e_trf.point_to_local(glob_pos);
+        for (unsigned int i = 0u; i < 3u; ++i) {
+            EXPECT_NEAR(loc[i], c_loc[i], tol);
+            EXPECT_NEAR(loc[i], e_loc[i], tol);
+        }
+    }
+
+    // The intersection kernels accept the compact transform store
+    using intersection_t =
+        intersection2D<typename detector_t::surface_type, transform3>;
+
+    const free_track_parameters<transform3> track(
+        point3{0.f, 0.f, 0.f}, 0.f, vector3{1.f, 1.f, 1.f}, -1.f);
+    const detail::ray<transform3> ray(track);
+    const detail::helix<transform3> hlx(track, &B);
+
+    std::vector<intersection_t> ray_is, c_ray_is, hlx_is, c_hlx_is;
+    for (const auto& sf : d.surfaces()) {
+        d.mask_store().template visit<intersection_initialize>(
+            sf.mask(), ray_is, ray, sf, d.transform_store());
+        cd.mask_store().template visit<intersection_initialize>(
+            sf.mask(), c_ray_is, ray, sf, cd.transform_store());
+        d.mask_store().template visit<helix_intersection_initialize>(
+            sf.mask(), hlx_is, hlx, sf, d.transform_store());
+        cd.mask_store().template visit<helix_intersection_initialize>(
+            sf.mask(), c_hlx_is, hlx, sf, cd.transform_store());
+    }
+    ASSERT_EQ(ray_is.size(), c_ray_is.size());
+    ASSERT_EQ(hlx_is.size(), c_hlx_is.size());
+    for (std::size_t i = 0u; i < ray_is.size(); ++i) {
+        EXPECT_NEAR(ray_is[i].path, c_ray_is[i].path, 1e-4f);
+    }
+    for (std::size_t i = 0u; i < hlx_is.size(); ++i) {
+        EXPECT_NEAR(hlx_is[i].path, c_hlx_is[i].path, 1e-4f);
+    }
+}
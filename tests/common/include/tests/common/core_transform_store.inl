@@ -1,6 +1,6 @@
 /** Detray library, part of the ACTS project (R&D line)
  *
- * (c) 2021-2022 CERN for the benefit of the ACTS project
+ * (c) 2021-2023 CERN for the benefit of the ACTS project
  *
  * Mozilla Public License Version 2.0
  */
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include "detray/core/detail/single_store.hpp"
+#include "detray/geometry/compact_transform3.hpp"
 
 /// @note __plugin has to be defined with a preprocessor command
 
@@ -48,3 +49,71 @@ TEST(ALGEBRA_PLUGIN, static_transform_store) {
     static_store.emplace_back(ctx0);
     ASSERT_EQ(static_store.size(ctx0), 5u);
 }
+
+// This tests the compact transform representation in a transform store
+TEST(ALGEBRA_PLUGIN, compact_transform_store) {
+    using namespace detray;
+    using transform3 = __plugin::transform3<detray::scalar>;
+    using point3 = __plugin::point3<detray::scalar>;
+    using vector3 = __plugin::vector3<detray::scalar>;
+
+    using compact_t = compact_transform3<transform3, float>;
+    using transform_store_t = single_store<compact_t>;
+
+    constexpr scalar tol{1e-5f};
+
+    static_assert(std::is_same_v<detail::algebra_transform_t<compact_t>,
+                                 transform3>,
+                  "Wrong algebra transform type");
+    static_assert(
+        std::is_same_v<detail::algebra_transform_t<transform3>, transform3>,
+        "Wrong algebra transform type");
+
+    // Rotated and translated placement
+    const vector3 z = vector::normalize(vector3{1.f, 1.f, 1.f});
+    const vector3 x = vector::normalize(vector3{1.f, 0.f, -1.f});
+    const transform3 trf{point3{1.f, -2.f, 3.f}, z, x};
+
+    transform_store_t store;
+    typename transform_store_t::context_type ctx{};
+
+    store.push_back(trf, ctx);
+    store.emplace_back(ctx, point3{2.f, 0.f, 0.f});
+    store.emplace_back(ctx);
+    ASSERT_EQ(store.size(ctx), 3u);
+
+    const point3 p{4.f, 5.f, -6.f};
+    const compact_t& ctrf = store[0u];
+
+    // Compare to the full transform
+    const point3 glob = ctrf.point_to_global(p);
+    const point3 loc = ctrf.point_to_local(p);
+    const vector3 glob_v = ctrf.vector_to_global(p);
+    const vector3 loc_v = ctrf.vector_to_local(p);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(glob[i], trf.point_to_global(p)[i], tol);
+        EXPECT_NEAR(loc[i], trf.point_to_local(p)[i], tol);
+        EXPECT_NEAR(glob_v[i], trf.vector_to_global(p)[i], tol);
+        EXPECT_NEAR(loc_v[i], trf.vector_to_local(p)[i], tol);
+    }
+
+    // Round trip
+    const point3 rt = ctrf.point_to_local(ctrf.point_to_global(p));
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(rt[i], p[i], tol);
+    }
+
+    // Conversion to the full transform
+    const auto expanded = static_cast<transform3>(store[0u]);
+    for (unsigned int i = 0u; i < 3u; ++i) {
+        EXPECT_NEAR(expanded.translation()[i], trf.translation()[i], tol);
+        EXPECT_NEAR(expanded.z()[i], trf.z()[i], tol);
+        EXPECT_NEAR(expanded.point_to_local(p)[i], trf.point_to_local(p)[i],
+                    tol);
+    }
+
+    // Translation only and identity
+    EXPECT_NEAR(store[1u].point_to_local(p)[0], 2.f, tol);
+    EXPECT_TRUE(store[2u] == compact_t{});
+    EXPECT_NEAR(store[2u].point_to_global(p)[2], p[2], tol);
+}
@@ -7,11 +7,11 @@
 
 // Project include(s).
 #include "detray/definitions/units.hpp"
+#include "detray/intersection/helix_plane_intersector.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/masks/unbounded.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/axis_rotation.hpp"
-#include "tests/common/tools/intersectors/helix_plane_intersector.hpp"
 
 // google-test include(s).
 #include <gtest/gtest.h>
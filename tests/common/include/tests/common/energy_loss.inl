@@ -8,15 +8,23 @@
 using namespace detray;
 
 // Project include(s).
+#include "detray/detectors/create_toy_geometry.hpp"
 #include "detray/geometry/surface.hpp"
 #include "detray/materials/interaction.hpp"
+#include "detray/materials/interaction_table.hpp"
 #include "detray/materials/material.hpp"
 #include "detray/materials/material_slab.hpp"
 #include "detray/materials/predefined_materials.hpp"
 
+// Vecmem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
 // GTest include(s).
 #include <gtest/gtest.h>
 
+// System include(s).
+#include <cmath>
+
 using sf_handle_t = surface<>;
 
 // Test class for MUON energy loss with Bethe function
@@ -193,3 +201,108 @@ INSTANTIATE_TEST_SUITE_P(Landau_10GeV_Silicon, EnergyLossLandauValidation,
                          ::testing::Values(std::make_tuple(
                              silicon<scalar>(), 10.f * unit<scalar>::GeV,
                              0.525f, 0.13f)));
+
+// Validate the tabulated energy loss against the analytic formulas
+TEST(energy_loss, interaction_table) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // muon
+    constexpr int pdg = pdg_particle::eMuon;
+    constexpr scalar m{105.7f * unit<scalar>::MeV};
+
+    interaction_table<scalar> table(host_mr, m);
+    table.add(hydrogen_liquid<scalar>());
+    table.add(silicon<scalar>());
+    table.add(argon_gas<scalar>());
+    table.add(tungsten<scalar>());
+    // Duplicates and vacuum are not tabulated
+    table.add(silicon<scalar>());
+    table.add(vacuum<scalar>());
+    ASSERT_EQ(table.size(), 4u);
+    EXPECT_EQ(table.find(argon_gas<scalar>()), 2u);
+    EXPECT_EQ(table.find(gold<scalar>()), dindex_invalid);
+
+    interaction<scalar> I;
+    intersection2D<sf_handle_t> is;
+    is.cos_incidence_angle = 0.8f;
+
+    for (const material<scalar>& mat :
+         {material<scalar>{hydrogen_liquid<scalar>()},
+          material<scalar>{silicon<scalar>()},
+          material<scalar>{argon_gas<scalar>()},
+          material<scalar>{tungsten<scalar>()}}) {
+        const material_slab<scalar> slab(mat, 2.f * unit<scalar>::mm);
+
+        for (const scalar q : {-1.f, 1.f, 2.f}) {
+            // From 20 MeV to 10 TeV
+            for (scalar p = 20.f * unit<scalar>::MeV;
+                 p < 10.f * unit<scalar>::TeV; p *= 1.37f) {
+                const scalar qop{q / p};
+
+                // The density effect correction sets in at beta*gamma = 10
+                const scalar bg{p / m};
+                const scalar tol{(bg > 9.f and bg < 11.f) ? 0.02f : 1e-3f};
+
+                const scalar e_loss{
+                    I.compute_energy_loss_bethe(is, slab, pdg, m, qop, q)};
+                EXPECT_NEAR(
+                    table.compute_energy_loss_bethe(is, slab, pdg, m, qop, q),
+                    e_loss, tol * e_loss)
+                    << "p: " << p << ", q: " << q;
+
+                const scalar sigma_qop{
+                    I.compute_energy_loss_landau_sigma_QOverP(is, slab, pdg, m,
+                                                              qop, q)};
+                EXPECT_NEAR(table.compute_energy_loss_landau_sigma_QOverP(
+                                is, slab, pdg, m, qop, q),
+                            sigma_qop, 1e-3f * sigma_qop)
+                    << "p: " << p << ", q: " << q;
+            }
+        }
+    }
+
+    // Fall back to the analytic formulas outside of the table
+    const material_slab<scalar> gold_slab(gold<scalar>(), 1.f);
+    const material_slab<scalar> si_slab(silicon<scalar>(), 1.f);
+    const scalar qop{-1.f / (1.f * unit<scalar>::GeV)};
+    // Unknown material
+    EXPECT_FLOAT_EQ(
+        table.compute_energy_loss_bethe(is, gold_slab, pdg, m, qop, -1.f),
+        I.compute_energy_loss_bethe(is, gold_slab, pdg, m, qop, -1.f));
+    // Different mass
+    constexpr scalar m_e{constant<scalar>::m_e};
+    EXPECT_FLOAT_EQ(
+        table.compute_energy_loss_bethe(is, si_slab, pdg, m_e, qop, -1.f),
+        I.compute_energy_loss_bethe(is, si_slab, pdg, m_e, qop, -1.f));
+    // Beta * gamma below the table range
+    const scalar low_qop{-1.f / (1.f * unit<scalar>::MeV)};
+    EXPECT_FLOAT_EQ(
+        table.compute_energy_loss_bethe(is, si_slab, pdg, m, low_qop, -1.f),
+        I.compute_energy_loss_bethe(is, si_slab, pdg, m, low_qop, -1.f));
+
+    // A table constructed from the view reads the same values
+    const interaction_table<scalar, device_container_types> device_table(
+        table.get_data());
+    ASSERT_EQ(device_table.size(), table.size());
+    EXPECT_EQ(device_table.find(argon_gas<scalar>()), 2u);
+    EXPECT_FLOAT_EQ(
+        device_table.compute_energy_loss_bethe(is, si_slab, pdg, m, qop, -1.f),
+        table.compute_energy_loss_bethe(is, si_slab, pdg, m, qop, -1.f));
+}
+
+// Tabulate the materials of a detector
+TEST(energy_loss, interaction_table_from_detector) {
+
+    vecmem::host_memory_resource host_mr;
+
+    const auto toy_det = create_toy_geometry(host_mr);
+
+    interaction_table<scalar> table(host_mr, 105.7f * unit<scalar>::MeV);
+    table.add_materials(toy_det.material_store());
+
+    // Only silicon and beryllium (tml) are used in the toy detector
+    EXPECT_EQ(table.size(), 2u);
+    EXPECT_NE(table.find(silicon_tml<scalar>()), dindex_invalid);
+    EXPECT_NE(table.find(beryllium_tml<scalar>()), dindex_invalid);
+}
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <limits>
+#include <vector>
 
 // detray test
 #include <vecmem/containers/device_vector.hpp>
@@ -421,3 +422,38 @@ TEST(grid, multi_axis) {
     auto z_axis_device = axes_device.get_axis<label::e_z>();
     EXPECT_EQ(z_axis_device.nbins(), 50u);
 }
+
+TEST(grid, batched_bin_lookup) {
+
+    // Mixed binnings and bounds
+    using axes_t = multi_axis<
+        true, cylindrical3<__plugin::transform3<scalar>>,
+        single_axis<closed<label::e_r>, irregular<>>,
+        single_axis<circular<label::e_phi>, regular<>>,
+        single_axis<open<label::e_z>, regular<>>>;
+
+    // Irregular r-axis with 7 bins, 10 phi bins, 25 z bins (+ 2 overflow)
+    vecmem::vector<scalar> bin_edges = {0.f,  1.f,  3.f,  4.f,    8.f,  9.f,
+                                        13.f, 20.f, -3.f, 3.f, -100.f, 100.f};
+    vecmem::vector<dindex_range> edge_ranges = {
+        {0u, 7u}, {8u, 10u}, {10u, 25u}};
+
+    axes_t axes(std::move(edge_ranges), std::move(bin_edges));
+
+    // Not a multiple of the batch size, including the bin edges and values
+    // outside of the axis spans
+    std::vector<point3> points;
+    for (unsigned int i = 0u; i < 3u * batch_size + 5u; ++i) {
+        const auto x{static_cast<scalar>(i)};
+        points.push_back({0.1f * x - 2.f, 0.05f * x - 4.f, 2.f * x - 110.f});
+    }
+    points.push_back({3.f, -3.f, -100.f});
+    points.push_back({20.f, 3.f, 100.f});
+
+    std::vector<multi_bin<3>> mbins(points.size());
+    axes.bins(points.data(), points.size(), mbins.data());
+
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        EXPECT_EQ(mbins[i], axes.bins(points[i])) << "point " << i;
+    }
+}
@@ -10,6 +10,8 @@
 // Detray include(s)
 #include "detray/definitions/indexing.hpp"
 #include "detray/masks/cuboid3D.hpp"
+#include "detray/masks/cylinder2D.hpp"
+#include "detray/masks/rectangle2D.hpp"
 #include "detray/surface_finders/grid/axis.hpp"
 #include "detray/surface_finders/grid/grid.hpp"
 #include "detray/surface_finders/grid/populator.hpp"
@@ -24,6 +26,8 @@
 // System include(s)
 #include <algorithm>
 #include <limits>
+#include <utility>
+#include <vector>
 
 using namespace detray;
 using namespace detray::n_axis;
@@ -180,6 +184,39 @@ TEST(grid, search) {
     EXPECT_NEAR(*grid_3D.at(mbin), scalar{42}, tol);*/
 }
 
+/// Test the global bin lookup for a batch of points
+TEST(grid, batched_search) {
+
+    // Non-owning, 3-dimensional, replacing grid
+    using grid_t =
+        grid<cartesian_3D<is_n_owning>, scalar, simple_serializer, replacer>;
+
+    grid_t::bin_storage_type bin_data{};
+    bin_data.resize(40'000u);
+    std::generate_n(
+        bin_data.begin(), 40'000u,
+        bin_content_sequence<populator<grid_t::populator_impl>, scalar>());
+
+    grid_t g3(&bin_data, ax_n_own);
+
+    // Points inside and outside of the grid
+    vecmem::vector<point3> points;
+    for (unsigned int i = 0u; i < 200u; ++i) {
+        const auto x{static_cast<scalar>(i)};
+        points.push_back({0.15f * x - 15.f, 0.3f * x - 30.f, 0.6f * x - 10.f});
+    }
+
+    const std::vector<dindex> gbins = g3.bins(points);
+    ASSERT_EQ(gbins.size(), points.size());
+
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        const dindex gbin{
+            g3.serializer()(g3.axes(), g3.axes().bins(points[i]))};
+        EXPECT_EQ(gbins[i], gbin);
+        EXPECT_NEAR(g3.at(gbins[i])[0], g3.search(points[i])[0], tol);
+    }
+}
+
 /// Integration test: Test replace population
 TEST(grid, replace_population) {
 
@@ -405,6 +442,159 @@ TEST(grid, regular_attach_population) {
      EXPECT_EQ(zone_test, zone_expected);*/
 }
 
+/// Test bin entry retrieval
+TEST(grid, irregular_attach_population) {
+
+    // Non-owning, 3D cartesian, CSR layout (sorted)
+    using grid_t = grid<cartesian_3D<is_n_owning>, scalar, simple_serializer,
+                        irregular_attacher<true>>;
+
+    // init
+    grid_t::bin_storage_type bin_data{};
+    bin_data.resize(40'000u, populator<grid_t::populator_impl>::init<scalar>());
+
+    // Create non-owning grid
+    grid_t g3ia(&bin_data, ax_n_own);
+
+    // Test the initialization: all bins are empty
+    EXPECT_EQ(g3ia.n_max_candidates(), 0u);
+    point3 p = {-4.5f, -4.5f, 4.5f};
+    EXPECT_TRUE(g3ia.search(p).empty());
+
+    // Fill and read
+    g3ia.populate(p, 5.f);
+    g3ia.populate(p, 2.f);
+    std::vector<scalar> expected{2.f, 5.f};
+    EXPECT_EQ(g3ia.search(p).size(), 2u);
+    test_content(g3ia, p, expected);
+
+    // Fill many entries at once: no entry gets dropped in the dense bin
+    const auto mbin = g3ia.axes().bins(p);
+    std::vector<std::pair<multi_bin<3>, scalar>> bin_entries;
+    for (unsigned int i = 0u; i < 20u; ++i) {
+        bin_entries.emplace_back(mbin, static_cast<scalar>(20u - i));
+    }
+    const point3 p2 = {4.5f, 4.5f, 4.5f};
+    bin_entries.emplace_back(g3ia.axes().bins(p2), 7.f);
+    g3ia.populate(bin_entries);
+
+    expected.clear();
+    for (unsigned int i = 1u; i <= 20u; ++i) {
+        expected.push_back(static_cast<scalar>(i));
+    }
+    expected.insert(expected.begin() + 2, 2.f);
+    expected.insert(expected.begin() + 6, 5.f);
+    EXPECT_EQ(g3ia.search(p).size(), 22u);
+    test_content(g3ia, p, expected);
+
+    EXPECT_EQ(g3ia.search(p2).size(), 1u);
+    EXPECT_NEAR(g3ia.search(p2)[0], 7.f, tol);
+    EXPECT_EQ(g3ia.n_max_candidates(), 22u);
+
+    // The storage grew by the two entries that were appended behind the
+    // bins, the bulk fill only reuses the existing slots
+    EXPECT_EQ(bin_data.size(), 40'002u);
+}
+
+/// Test the zone search around a bin
+TEST(grid, zone_search) {
+
+    using point2 = __plugin::point2<scalar>;
+    using rect_axes_t = coordinate_axes<rectangle2D<>::axes<>, is_owning>;
+    using cyl_axes_t = coordinate_axes<cylinder2D<>::axes<>, is_owning>;
+    using rect_grid_t =
+        grid<rect_axes_t, dindex, simple_serializer, regular_attacher<1>>;
+    using cyl_grid_t =
+        grid<cyl_axes_t, dindex, simple_serializer, regular_attacher<1>>;
+
+    vecmem::host_memory_resource host_mr;
+
+    // 2D cartesian grid with 10x10 bins in [-5, 5]
+    typename rect_axes_t::boundary_storage_type rect_axes_data(&host_mr);
+    typename rect_axes_t::edges_storage_type rect_edges(&host_mr);
+    rect_axes_data.push_back({0u, 10u});
+    rect_axes_data.push_back({2u, 10u});
+    rect_edges.insert(rect_edges.end(), {-5.f, 5.f, -5.f, 5.f});
+
+    typename rect_grid_t::bin_storage_type rect_bins(&host_mr);
+    rect_bins.resize(
+        100u, populator<rect_grid_t::populator_impl>::init<dindex>());
+    rect_grid_t g2(
+        std::move(rect_bins),
+        rect_axes_t(std::move(rect_axes_data), std::move(rect_edges)));
+
+    dindex counter{100u};
+    for (unsigned int ib0 = 0u; ib0 < 10u; ++ib0) {
+        for (unsigned int ib1 = 0u; ib1 < 10u; ++ib1) {
+            g2.populate(point2{-4.5f + static_cast<scalar>(ib0),
+                               -4.5f + static_cast<scalar>(ib1)},
+                        counter++);
+        }
+    }
+
+    // A zone test w/o neighbourhood
+    point2 p = {-4.5f, -4.5f};
+    dvector<dindex> expected = {100u};
+    EXPECT_EQ(g2.search(p, rect_grid_t::neighborhood_type<dindex>{}),
+              expected);
+
+    // A zone test with binned neighbourhood
+    p = {0.5f, 0.5f};
+    const darray<dindex, 2> zone11 = {1u, 1u};
+    const darray<dindex, 2> zone22 = {2u, 2u};
+    expected = {143u, 144u, 145u, 146u, 147u, 153u, 154u, 155u,
+                156u, 157u, 163u, 164u, 165u, 166u, 167u};
+    EXPECT_EQ(g2.search(p, {zone11, zone22}, true), expected);
+
+    // A zone test with scalar neighbourhood
+    const darray<scalar, 2> szone10 = {1.f, 0.f};
+    expected = {144u, 145u, 154u, 155u};
+    EXPECT_EQ(g2.search(p, {szone10, szone10}, true), expected);
+
+    // The zone is clipped at the closed axis boundaries
+    p = {-4.5f, -4.5f};
+    expected = {100u, 101u, 110u, 111u};
+    EXPECT_EQ(g2.search(p, {zone11, zone11}, true), expected);
+
+    // The zone can be visited without allocating
+    dindex n_entries{0u};
+    g2.visit_zone(p, rect_grid_t::neighborhood_type<dindex>{{zone22, zone22}},
+                  [&n_entries](const dindex) { ++n_entries; });
+    EXPECT_EQ(n_entries, 9u);
+
+    // 2D cylindrical grid with 4 circular and 5 closed bins
+    typename cyl_axes_t::boundary_storage_type cyl_axes_data(&host_mr);
+    typename cyl_axes_t::edges_storage_type cyl_edges(&host_mr);
+    cyl_axes_data.push_back({0u, 4u});
+    cyl_axes_data.push_back({2u, 5u});
+    cyl_edges.insert(cyl_edges.end(), {-2.f, 2.f, 0.f, 5.f});
+
+    typename cyl_grid_t::bin_storage_type cyl_bins(&host_mr);
+    cyl_bins.resize(20u,
+                    populator<cyl_grid_t::populator_impl>::init<dindex>());
+    cyl_grid_t g2cc(std::move(cyl_bins),
+                    cyl_axes_t(std::move(cyl_axes_data), std::move(cyl_edges)));
+
+    counter = 0u;
+    for (unsigned int icl = 0u; icl < 5u; ++icl) {
+        for (unsigned int ici = 0u; ici < 4u; ++ici) {
+            g2cc.populate(point2{-1.5f + static_cast<scalar>(ici),
+                                 0.5f + static_cast<scalar>(icl)},
+                          counter++);
+        }
+    }
+
+    // A zone test for circular testing: wraps around in phi
+    p = {1.5f, 2.5f};
+    expected = {4u, 6u, 7u, 8u, 10u, 11u, 12u, 14u, 15u};
+    EXPECT_EQ(g2cc.search(p, {zone11, zone11}, true), expected);
+
+    // The zone covers the full circle: no bin is visited twice
+    expected = {8u, 9u, 10u, 11u};
+    EXPECT_EQ(g2cc.search(p, {zone22, darray<dindex, 2>{0u, 0u}}, true),
+              expected);
+}
+
 /*TEST(grids, irregular_replace_population) {
 
     // Non-owning, 3D cartesian, replacing grid
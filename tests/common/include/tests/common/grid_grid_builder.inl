@@ -10,10 +10,12 @@
 // Detray include(s)
 #include "detray/core/detector.hpp"
 #include "detray/definitions/indexing.hpp"
+#include "detray/detectors/create_toy_geometry.hpp"
 #include "detray/detectors/detector_metadata.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/surface_finders/grid/populator.hpp"
 #include "detray/surface_finders/grid/serializer.hpp"
+#include "detray/tools/bin_association.hpp"
 #include "detray/tools/grid_builder.hpp"
 #include "detray/tools/surface_factory.hpp"
 #include "detray/tools/volume_builder.hpp"
@@ -22,7 +24,9 @@
 #include <vecmem/memory/host_memory_resource.hpp>
 
 // System include(s)
+#include <algorithm>
 #include <limits>
+#include <vector>
 
 using namespace detray;
 using namespace detray::n_axis;
@@ -319,4 +323,58 @@ TEST(grid, decorator_grid_builder) {
             EXPECT_EQ(sf.transform(), trf_idx++);
         }
     }*/
-}
\ No newline at end of file
+}
+
+/// Unittest: Test the bin association of surfaces to a grid
+TEST(grid, bin_association) {
+
+    vecmem::host_memory_resource host_mr;
+    const auto toy_det = create_toy_geometry(host_mr);
+    using surface_t = typename decltype(toy_det)::surface_type;
+    const typename decltype(toy_det)::geometry_context ctx{};
+
+    auto gr_factory =
+        grid_factory<surface_t, simple_serializer, irregular_attacher<>>{
+            host_mr};
+
+    // Innermost endcap layer
+    const auto& vol = toy_det.volumes()[1];
+    const auto surfaces = toy_det.surfaces(vol);
+    const auto disc_mask = mask<ring2D<>>{0u, 27.f, 180.f};
+
+    // The result does not depend on the number of threads
+    auto disc_grid = gr_factory.new_grid(disc_mask, {10u, 30u});
+    auto disc_grid_mt = gr_factory.new_grid(disc_mask, {10u, 30u});
+    bin_association(ctx, surfaces, toy_det.transform_store(),
+                    toy_det.mask_store(), disc_grid, {0.1f, 0.1f}, false, 1u);
+    bin_association(ctx, surfaces, toy_det.transform_store(),
+                    toy_det.mask_store(), disc_grid_mt, {0.1f, 0.1f}, false,
+                    4u);
+
+    std::vector<dindex> associated_sfs;
+    for (dindex gbin = 0u; gbin < disc_grid.nbins(); ++gbin) {
+        const auto bin_content = disc_grid.at(gbin);
+        const auto bin_content_mt = disc_grid_mt.at(gbin);
+        ASSERT_EQ(bin_content.size(), bin_content_mt.size());
+        const auto n_entries{static_cast<dindex>(bin_content_mt.size())};
+        for (dindex i = 0u; i < n_entries; ++i) {
+            EXPECT_TRUE(bin_content[i] == bin_content_mt[i]);
+            associated_sfs.push_back(bin_content[i].index());
+        }
+    }
+
+    // Every sensitive surface was associated to at least one bin
+    std::sort(associated_sfs.begin(), associated_sfs.end());
+    associated_sfs.erase(
+        std::unique(associated_sfs.begin(), associated_sfs.end()),
+        associated_sfs.end());
+    std::size_t n_sensitives{0u};
+    for (const auto& sf : surfaces) {
+        if (sf.is_sensitive()) {
+            ++n_sensitives;
+            EXPECT_TRUE(std::binary_search(associated_sfs.begin(),
+                                           associated_sfs.end(), sf.index()));
+        }
+    }
+    EXPECT_EQ(n_sensitives, 108u);
+}
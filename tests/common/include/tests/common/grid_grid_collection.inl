@@ -17,9 +17,14 @@
 #include "detray/surface_finders/grid/serializer.hpp"
 #include "detray/tools/grid_builder.hpp"
 
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
 // System include(s)
 #include <algorithm>
 #include <climits>
+#include <utility>
+#include <vector>
 
 using namespace detray;
 using namespace detray::n_axis;
@@ -124,4 +129,97 @@ TEST(grid, grid_collection) {
         std::is_same_v<decltype(const_coll_view),
                        typename grid_collection<grid_t>::const_view_type>,
         "Grid collection const view incorrectly assembled");
-}
\ No newline at end of file
+
+    // The grids of a const collection only grant read access to the bins
+    auto const_grid = const_coll[2];
+    static_assert(std::is_const_v<typename decltype(const_grid)::value_type>,
+                  "Grid from const collection can modify its bins");
+    EXPECT_EQ(const_grid.at(101u)[0u], 102u + 72u);
+    EXPECT_EQ(const_grid.at(101u)[1u], 42u);
+}
+
+/// Unittest: Test a collection of grids in compressed sparse row layout
+TEST(grid, csr_grid_collection) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Non-owning grid type with a variable number of entries per bin
+    using cylindrical_3D =
+        coordinate_axes<cylinder3D::axes<>, is_n_owning, host_container_types>;
+    using grid_t =
+        grid<cylindrical_3D, dindex, simple_serializer, irregular_attacher<>>;
+    using grid_owning_t = grid_t::template type<is_owning>;
+    using axes_owning_t = grid_owning_t::axes_type;
+    using bin_t = grid_t::bin_type;
+
+    // Two data owning grids with 48 and 24 bins, respectively
+    axes_owning_t axes0({{0u, 2u}, {2u, 4u}, {4u, 6u}},
+                        {-10.f, 10.f, -20.f, 20.f, 0.f, 120.f});
+    axes_owning_t axes1({{0u, 1u}, {2u, 3u}, {4u, 8u}},
+                        {-5.f, 5.f, -15.f, 15.f, 0.f, 50.f});
+
+    dvector<bin_t> bins0(48u, populator<irregular_attacher<>>::init<dindex>());
+    dvector<bin_t> bins1(24u, populator<irregular_attacher<>>::init<dindex>());
+    grid_owning_t grid0(std::move(bins0), std::move(axes0));
+    grid_owning_t grid1(std::move(bins1), std::move(axes1));
+
+    // Fill a dense bin in the first grid
+    std::vector<std::pair<multi_bin<3>, dindex>> bin_entries;
+    for (dindex i = 0u; i < 12u; ++i) {
+        bin_entries.emplace_back(multi_bin<3>{{0u, 0u, 0u}}, i);
+    }
+    bin_entries.emplace_back(multi_bin<3>{{1u, 3u, 5u}}, 42u);
+    grid0.populate(bin_entries);
+
+    grid1.populate(3u, 7u);
+    grid1.populate(3u, 8u);
+    grid1.populate(0u, 9u);
+
+    // Transcribe the grids into the collection
+    grid_collection<grid_t> grid_coll(&host_mr);
+    grid_coll.push_back(grid0);
+    grid_coll.push_back(grid1);
+
+    // The single entries of the second grid were appended behind its bins
+    EXPECT_EQ(grid_coll.size(), 2u);
+    EXPECT_EQ(grid_coll.bin_storage().size(), 75u);
+
+    // The bin offsets are still valid in the collection
+    auto bin_view = grid_coll[0].at(0u, 0u, 0u);
+    EXPECT_EQ(bin_view.size(), 12u);
+    for (dindex i = 0u; i < 12u; ++i) {
+        EXPECT_EQ(bin_view[i], i);
+    }
+    EXPECT_EQ(grid_coll[0].at(1u, 3u, 5u).size(), 1u);
+    EXPECT_EQ(grid_coll[0].at(1u, 3u, 5u)[0u], 42u);
+    EXPECT_TRUE(grid_coll[0].at(1u, 0u, 0u).empty());
+
+    EXPECT_EQ(grid_coll[1].at(3u).size(), 2u);
+    EXPECT_EQ(grid_coll[1].at(3u)[0u], 7u);
+    EXPECT_EQ(grid_coll[1].at(3u)[1u], 8u);
+    EXPECT_EQ(grid_coll[1].at(0u).size(), 1u);
+    EXPECT_EQ(grid_coll[1].at(0u)[0u], 9u);
+    EXPECT_TRUE(grid_coll[1].at(23u).empty());
+
+    EXPECT_EQ(grid_coll[0].n_max_candidates(), 12u);
+    EXPECT_EQ(grid_coll[1].n_max_candidates(), 2u);
+
+    // The axes of both grids point to their own bin edges
+    EXPECT_FLOAT_EQ(grid_coll[0].get_axis<label::e_z>().max(), 120.f);
+    EXPECT_FLOAT_EQ(grid_coll[1].get_axis<label::e_z>().max(), 50.f);
+    EXPECT_EQ(grid_coll[1].get_axis<label::e_z>().nbins(), 8u);
+
+    // Append the collection to another collection
+    grid_collection<grid_t> other_coll(&host_mr);
+    other_coll.push_back(grid1);
+    other_coll.append(grid_coll);
+
+    EXPECT_EQ(other_coll.size(), 3u);
+    EXPECT_EQ(other_coll.bin_storage().size(), 102u);
+    EXPECT_EQ(other_coll[1].at(0u, 0u, 0u).size(), 12u);
+    EXPECT_EQ(other_coll[2].at(3u).size(), 2u);
+    EXPECT_EQ(other_coll[2].at(3u)[1u], 8u);
+    EXPECT_FLOAT_EQ(other_coll[0].get_axis<label::e_z>().max(), 50.f);
+    EXPECT_FLOAT_EQ(other_coll[1].get_axis<label::e_z>().max(), 120.f);
+    EXPECT_FLOAT_EQ(other_coll[2].get_axis<label::e_z>().max(), 50.f);
+}
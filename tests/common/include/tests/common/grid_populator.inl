@@ -9,6 +9,9 @@
 
 #include <algorithm>
 #include <climits>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 // detray core
 #include "detray/definitions/indexing.hpp"
@@ -176,3 +179,107 @@ TEST(grid, regular_attach_populator) {
     EXPECT_EQ(bin_data[41].content(), stored);
     test_content(sort_reg_attach_populator, bin_data, 41, stored);
 }
+
+/// Irregular attach populator
+TEST(grid, irregular_attach_populator) {
+
+    // No sorting, dindex entries in backend storage, CSR layout
+    using populator_t = populator<irregular_attacher<>>;
+    populator_t irr_attach_populator{};
+
+    // Create some bin data
+    dvector<populator_t::template bin_type<dindex>> bin_data{};
+    std::generate_n(std::back_inserter(bin_data), 50,
+                    increment<populator_t, dindex>());
+
+    // Check test setup
+    std::vector<dindex> stored = {3u};
+    EXPECT_EQ(irr_attach_populator.view(bin_data, 2).size(), 1u);
+    test_content(irr_attach_populator, bin_data, 2, stored);
+    stored = {43u};
+    EXPECT_EQ(irr_attach_populator.view(bin_data, 42).size(), 1u);
+    test_content(irr_attach_populator, bin_data, 42, stored);
+
+    // Attach some bin entries
+    dindex entry1{15}, entry2{8};
+
+    stored = {3u, 15u, 8u};
+    irr_attach_populator(bin_data, 2, entry1);
+    irr_attach_populator(bin_data, 2, entry2);
+    EXPECT_EQ(irr_attach_populator.view(bin_data, 2).size(), 3u);
+    test_content(irr_attach_populator, bin_data, 2, stored);
+
+    stored = {43u, 15u, 8u, 16u};
+    irr_attach_populator(bin_data, 42, entry1);
+    irr_attach_populator(bin_data, 42, entry2);
+    irr_attach_populator(bin_data, 42, entry1 + 1);
+    EXPECT_EQ(irr_attach_populator.view(bin_data, 42).size(), 4u);
+    test_content(irr_attach_populator, bin_data, 42, stored);
+
+    // The neighbouring bins are untouched
+    stored = {4u};
+    test_content(irr_attach_populator, bin_data, 3, stored);
+    stored = {50u};
+    test_content(irr_attach_populator, bin_data, 49, stored);
+
+    // Fill many entries at once: the bins are not limited in size
+    std::vector<std::pair<dindex, dindex>> bin_entries;
+    stored = {1u};
+    for (dindex i = 0u; i < 12u; ++i) {
+        bin_entries.emplace_back(0u, 100u + i);
+        stored.push_back(100u + i);
+    }
+    bin_entries.emplace_back(5u, 99u);
+    irr_attach_populator.fill(bin_data, bin_entries);
+    EXPECT_EQ(irr_attach_populator.view(bin_data, 0).size(), 13u);
+    test_content(irr_attach_populator, bin_data, 0, stored);
+    stored = {6u, 99u};
+    test_content(irr_attach_populator, bin_data, 5, stored);
+    stored = {43u, 15u, 8u, 16u};
+    test_content(irr_attach_populator, bin_data, 42, stored);
+
+    // The storage grows with the number of entries
+    EXPECT_EQ(bin_data.size(), 68u);
+
+    // Do sorting, dindex entries in backend storage, CSR layout
+    populator<irregular_attacher<true>> sort_irr_attach_populator;
+
+    stored = {2u, 8u, 9u, 15u};
+    sort_irr_attach_populator(bin_data, 1, entry1);
+    sort_irr_attach_populator(bin_data, 1, entry2);
+    sort_irr_attach_populator(bin_data, 1, entry2 + 1);
+    test_content(sort_irr_attach_populator, bin_data, 1, stored);
+
+    // Empty bins
+    dvector<populator_t::template bin_type<dindex>> empty_bin_data(
+        10u, populator_t::template init<dindex>());
+    EXPECT_TRUE(irr_attach_populator.view(empty_bin_data, 0).empty());
+
+    stored = {3u, 1u, 2u};
+    irr_attach_populator(empty_bin_data, 9, 3u);
+    irr_attach_populator(empty_bin_data, 9, 1u);
+    irr_attach_populator(empty_bin_data, 9, 2u);
+    EXPECT_TRUE(irr_attach_populator.view(empty_bin_data, 0).empty());
+    EXPECT_TRUE(irr_attach_populator.view(empty_bin_data, 8).empty());
+    test_content(irr_attach_populator, empty_bin_data, 9, stored);
+    // The first entry is appended behind the bins, the others in place
+    EXPECT_EQ(empty_bin_data.size(), 13u);
+
+    // Interleaved insertion moves the bin entries to the back
+    stored = {3u, 1u, 2u, 7u};
+    irr_attach_populator(empty_bin_data, 0, 5u);
+    irr_attach_populator(empty_bin_data, 9, 7u);
+    test_content(irr_attach_populator, empty_bin_data, 9, stored);
+    stored = {5u};
+    test_content(irr_attach_populator, empty_bin_data, 0, stored);
+    EXPECT_EQ(empty_bin_data.size(), 18u);
+
+    // A bulk fill compacts the entry column
+    std::vector<std::pair<dindex, dindex>> no_entries{};
+    irr_attach_populator.fill(empty_bin_data, no_entries);
+    test_content(irr_attach_populator, empty_bin_data, 0, stored);
+    stored = {3u, 1u, 2u, 7u};
+    test_content(irr_attach_populator, empty_bin_data, 9, stored);
+    EXPECT_EQ(empty_bin_data[0].entry(), 5u);
+    EXPECT_EQ(empty_bin_data[4].entry(), 7u);
+}
@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <climits>
+#include <vector>
 
 // detray test
 #include <vecmem/containers/vector.hpp>
@@ -106,3 +107,105 @@ TEST(grid, serializer3D) {
     expected_mbin = {{1u, 1u, 1u}};
     EXPECT_EQ(serializer(axes, 13u), expected_mbin);
 }
+
+TEST(grid, morton_serializer2D) {
+
+    // Offsets into edges container and #bins for all axes
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 4u}, {2u, 4u}};
+    // Not needed for serializer test
+    vecmem::vector<scalar> bin_edges{};
+
+    polar_axes axes(std::move(edge_ranges), std::move(bin_edges));
+
+    morton_serializer<2> serializer{};
+
+    // Z-order on a power of two grid
+    multi_bin<2> mbin{{0u, 0u}};
+    EXPECT_EQ(serializer(axes, mbin), 0u);
+    mbin = {{1u, 0u}};
+    EXPECT_EQ(serializer(axes, mbin), 1u);
+    mbin = {{0u, 1u}};
+    EXPECT_EQ(serializer(axes, mbin), 2u);
+    mbin = {{2u, 0u}};
+    EXPECT_EQ(serializer(axes, mbin), 4u);
+    mbin = {{3u, 3u}};
+    EXPECT_EQ(serializer(axes, mbin), 15u);
+
+    multi_bin<2> expected_mbin{{1u, 1u}};
+    EXPECT_EQ(serializer(axes, 3u), expected_mbin);
+    expected_mbin = {{2u, 2u}};
+    EXPECT_EQ(serializer(axes, 12u), expected_mbin);
+}
+
+TEST(grid, hilbert_serializer2D) {
+
+    // Offsets into edges container and #bins for all axes
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 8u}, {2u, 8u}};
+    // Not needed for serializer test
+    vecmem::vector<scalar> bin_edges{};
+
+    polar_axes axes(std::move(edge_ranges), std::move(bin_edges));
+
+    hilbert_serializer<2> serializer{};
+
+    // Hilbert order of the first quadrant
+    multi_bin<2> mbin{{0u, 0u}};
+    EXPECT_EQ(serializer(axes, mbin), 0u);
+    mbin = {{0u, 1u}};
+    EXPECT_EQ(serializer(axes, mbin), 1u);
+    mbin = {{1u, 1u}};
+    EXPECT_EQ(serializer(axes, mbin), 2u);
+    mbin = {{1u, 0u}};
+    EXPECT_EQ(serializer(axes, mbin), 3u);
+    mbin = {{7u, 0u}};
+    EXPECT_EQ(serializer(axes, mbin), 63u);
+
+    // Consecutive bins are neighbours
+    for (dindex gbin = 1u; gbin < 64u; ++gbin) {
+        const multi_bin<2> prev = serializer(axes, gbin - 1u);
+        const multi_bin<2> next = serializer(axes, gbin);
+        const dindex dist{(prev[0] > next[0] ? prev[0] - next[0]
+                                              : next[0] - prev[0]) +
+                          (prev[1] > next[1] ? prev[1] - next[1]
+                                              : next[1] - prev[1])};
+        EXPECT_EQ(dist, 1u) << "gbin " << gbin;
+    }
+}
+
+TEST(grid, space_filling_curve_round_trip) {
+
+    // Numbers of bins that are not a power of two
+    vecmem::vector<dindex_range> edge_ranges = {{0u, 7u}, {2u, 13u}};
+    vecmem::vector<scalar> bin_edges{};
+    polar_axes axes2D(std::move(edge_ranges), std::move(bin_edges));
+
+    edge_ranges = {{0u, 5u}, {2u, 3u}, {4u, 6u}};
+    bin_edges = {};
+    cylinder_axes axes3D(std::move(edge_ranges), std::move(bin_edges));
+
+    // Every global bin is mapped onto exactly one bin in [0, nbins)
+    auto check_round_trip = [](const auto &axes, const auto &serializer) {
+        const auto n_bins = axes.nbins();
+        dindex n_total{1u};
+        for (const dindex n : n_bins.indices) {
+            n_total *= n;
+        }
+
+        std::vector<bool> seen(n_total, false);
+        for (dindex gbin = 0u; gbin < n_total; ++gbin) {
+            const auto mbin = serializer(axes, gbin);
+            for (std::size_t i = 0u; i < n_bins.indices.size(); ++i) {
+                ASSERT_LT(mbin[i], n_bins[i]);
+            }
+            const dindex rank{serializer(axes, mbin)};
+            ASSERT_LT(rank, n_total);
+            EXPECT_EQ(rank, gbin);
+            EXPECT_FALSE(seen[rank]);
+            seen[rank] = true;
+        }
+    };
+
+    check_round_trip(axes2D, morton_serializer<2>{});
+    check_round_trip(axes2D, hilbert_serializer<2>{});
+    check_round_trip(axes3D, morton_serializer<3>{});
+}
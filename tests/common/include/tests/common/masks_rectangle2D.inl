@@ -61,6 +61,34 @@ TEST(mask, rectangle2D) {
     ASSERT_NEAR(loc_bounds[cuboid3D<>::e_max_z], envelope, tol);
 }
 
+/// This tests the batched boundary checks of a rectangle
+TEST(mask, rectangle2D_batched) {
+    using mask_t = mask<rectangle2D<>>;
+    using point_t = typename mask_t::loc_point_t;
+
+    // One mask against many points
+    const mask_t r2{0u, hx, hy};
+    const darray<point_t, 4> points{point_t{0.5f, -9.f}, point_t{1.f, 9.3f},
+                                    point_t{1.5f, -9.f}, point_t{0.f, 9.5f}};
+    darray<bool, 4> inside{};
+
+    ASSERT_EQ(r2.is_inside(points, inside), 2u);
+    for (std::size_t i = 0u; i < points.size(); ++i) {
+        ASSERT_EQ(inside[i],
+                  r2.is_inside(points[i]) == intersection::status::e_inside);
+    }
+    // Move outside points inside using a tolerance
+    ASSERT_EQ(r2.is_inside(points, inside, 1.f), 4u);
+
+    // Many masks against one point
+    const darray<mask_t, 3> masks{mask_t{0u, hx, hy}, mask_t{0u, 0.1f, hy},
+                                  mask_t{0u, hx, 0.1f}};
+    ASSERT_EQ(is_inside(masks, point_t{0.5f, -9.f}, inside, 0.f), 1u);
+    ASSERT_TRUE(inside[0]);
+    ASSERT_FALSE(inside[1]);
+    ASSERT_FALSE(inside[2]);
+}
+
 /// This tests the basic functionality of a cuboid3D
 TEST(mask, cuboid3D) {
     using point_t = typename mask<cuboid3D<>>::loc_point_t;
@@ -81,6 +109,8 @@ TEST(mask, cuboid3D) {
     ASSERT_TRUE(c3.is_inside(p2_in) == intersection::status::e_inside);
     ASSERT_TRUE(c3.is_inside(p2_edge) == intersection::status::e_inside);
     ASSERT_TRUE(c3.is_inside(p2_out) == intersection::status::e_outside);
+    ASSERT_TRUE(c3.is_inside(point_t{0.5f, 8.0f, -0.55f}) ==
+                intersection::status::e_outside);
     // Move outside point inside using a tolerance
     ASSERT_TRUE(c3.is_inside(p2_out, 1.f) == intersection::status::e_inside);
 
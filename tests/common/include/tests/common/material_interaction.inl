@@ -6,9 +6,11 @@
  */
 
 // Project include(s).
+#include "detray/core/detector.hpp"
 #include "detray/definitions/pdg_particle.hpp"
 #include "detray/definitions/units.hpp"
 #include "detray/detectors/create_telescope_detector.hpp"
+#include "detray/detectors/detector_metadata.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/masks/unbounded.hpp"
 #include "detray/materials/interaction.hpp"
@@ -23,7 +25,9 @@
 #include "detray/propagator/navigator.hpp"
 #include "detray/propagator/propagator.hpp"
 #include "detray/propagator/rk_stepper.hpp"
+#include "detray/propagator/volume_material_policy.hpp"
 #include "detray/simulation/random_scatterer.hpp"
+#include "detray/tools/grid_factory.hpp"
 #include "detray/utils/statistics.hpp"
 #include "tests/common/tools/inspectors.hpp"
 
@@ -38,6 +42,19 @@ using namespace detray;
 using transform3 = __plugin::transform3<scalar>;
 using matrix_operator = typename transform3::matrix_actor;
 
+namespace {
+
+/// Provides the track parameters to the material interactor kernel
+struct stepping_mock {
+    free_track_parameters<transform3> track{};
+
+    const free_track_parameters<transform3>& operator()() const {
+        return track;
+    }
+};
+
+}  // anonymous namespace
+
 // Material interaction test with telescope Geometry
 TEST(material_interaction, telescope_geometry_energy_loss) {
 
@@ -322,3 +339,226 @@ TEST(material_interaction, telescope_geometry_scattering_angle) {
     // To make sure that the variances are not zero
     EXPECT_TRUE(ref_phi_variance > 1e-9f && ref_theta_variance > 1e-9f);
 }
+
+// Material interaction with a binned material map on a cylinder surface
+TEST(material_interaction, material_map) {
+
+    using detector_t = detector<detector_registry::default_detector>;
+    using material_id = typename detector_t::materials::id;
+    using material_link_t = typename detector_t::material_link;
+    using interactor_t = pointwise_material_interactor<transform3>;
+
+    vecmem::host_memory_resource host_mr;
+    typename detector_t::material_container materials(host_mr);
+
+    // Material map on a cylinder with 4 bins in r * phi and 2 bins in z
+    grid_factory<material_slab<scalar>, simple_serializer, replacer> factory{};
+    auto mat_map = factory.new_grid(
+        mask<cylinder2D<>>{0u, 10.f * unit<scalar>::mm,
+                           -100.f * unit<scalar>::mm, 100.f * unit<scalar>::mm},
+        {4u, 2u});
+
+    const material_slab<scalar> si_slab(silicon<scalar>(),
+                                        0.15f * unit<scalar>::mm);
+    const material_slab<scalar> be_slab(beryllium<scalar>(),
+                                        0.8f * unit<scalar>::mm);
+    for (dindex i = 0u; i < 4u; ++i) {
+        mat_map.populate(n_axis::multi_bin<2>{{i, 0u}}, si_slab);
+        if (i != 3u) {
+            mat_map.populate(n_axis::multi_bin<2>{{i, 1u}}, be_slab);
+        }
+    }
+
+    // The surface links to the second map in the collection
+    auto& map_coll = materials.template get<material_id::e_cylinder_map>();
+    map_coll.push_back(mat_map);
+    map_coll.push_back(mat_map);
+    ASSERT_EQ(map_coll.size(), 2u);
+    const material_link_t mat_link{material_id::e_cylinder_map, 1u};
+
+    // Track parameters
+    constexpr scalar q{-1.f};
+    stepping_mock stepping{};
+    stepping.track = {{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, q};
+
+    interactor_t::state interactor_state{};
+    const int pdg{interactor_state.pdg};
+    const scalar mass{interactor_state.mass};
+    const scalar qop{stepping().qop()};
+
+    intersection2D<typename detector_t::surface_type, transform3> is;
+    is.cos_incidence_angle = 1.f;
+
+    // Look up the silicon slab (negative z)
+    is.p2 = {1.f * unit<scalar>::mm, -50.f * unit<scalar>::mm};
+    ASSERT_TRUE(materials.template visit<interactor_t::kernel>(
+        mat_link, is, interactor_state, stepping));
+
+    interaction<scalar> I;
+    EXPECT_FLOAT_EQ(
+        interactor_state.e_loss,
+        I.compute_energy_loss_bethe(is, si_slab, pdg, mass, qop, q));
+    EXPECT_FLOAT_EQ(
+        interactor_state.projected_scattering_angle,
+        I.compute_multiple_scattering_theta0(is, si_slab, pdg, mass, qop, q));
+
+    // Look up the beryllium slab (positive z)
+    interactor_state.reset();
+    is.p2 = {1.f * unit<scalar>::mm, 50.f * unit<scalar>::mm};
+    ASSERT_TRUE(materials.template visit<interactor_t::kernel>(
+        mat_link, is, interactor_state, stepping));
+
+    EXPECT_FLOAT_EQ(
+        interactor_state.e_loss,
+        I.compute_energy_loss_bethe(is, be_slab, pdg, mass, qop, q));
+    EXPECT_FLOAT_EQ(
+        interactor_state.projected_scattering_angle,
+        I.compute_multiple_scattering_theta0(is, be_slab, pdg, mass, qop, q));
+
+    // Empty bin: No material interaction
+    interactor_state.reset();
+    is.p2 = {20.f * unit<scalar>::mm, 50.f * unit<scalar>::mm};
+    EXPECT_FALSE(materials.template visit<interactor_t::kernel>(
+        mat_link, is, interactor_state, stepping));
+    EXPECT_FLOAT_EQ(interactor_state.e_loss, 0.f);
+
+    // Tabulated material interaction for the materials in the maps
+    interaction_table<scalar> table(host_mr, mass);
+    table.add_materials(materials);
+    ASSERT_EQ(table.size(), 2u);
+
+    interactor_state.reset();
+    interactor_state.table = table.get_data();
+    is.p2 = {1.f * unit<scalar>::mm, 50.f * unit<scalar>::mm};
+    ASSERT_TRUE(materials.template visit<interactor_t::kernel>(
+        mat_link, is, interactor_state, stepping));
+
+    const scalar e_loss{
+        I.compute_energy_loss_bethe(is, be_slab, pdg, mass, qop, q)};
+    EXPECT_NEAR(interactor_state.e_loss, e_loss, 1e-3f * e_loss);
+    EXPECT_FLOAT_EQ(
+        interactor_state.projected_scattering_angle,
+        I.compute_multiple_scattering_theta0(is, be_slab, pdg, mass, qop, q));
+}
+
+// Continuous material interaction in a volume that is filled with material
+TEST(material_interaction, volume_material) {
+
+    vecmem::host_memory_resource host_mr;
+
+    // Telescope without surface material
+    mask<rectangle2D<>> rectangle{0u, 20.f * unit<scalar>::mm,
+                                  20.f * unit<scalar>::mm};
+    detail::ray<transform3> traj{{0.f, 0.f, 0.f}, 0.f, {1.f, 0.f, 0.f}, -1.f};
+    std::vector<scalar> positions = {0.f,   50.f,  100.f, 150.f, 200.f, 250.f,
+                                     300.f, 350.f, 400.f, 450.f, 500.f};
+
+    auto det = create_telescope_detector(host_mr, rectangle, positions,
+                                         vacuum<scalar>(), 0.f, traj);
+
+    // Fill the telescope volume with aluminium
+    const auto mat = aluminium<scalar>();
+    ASSERT_EQ(det.volume_material(0u), vacuum<scalar>());
+    det.set_volume_material(det.volume_by_index(0u), mat);
+    ASSERT_EQ(det.volume_materials().size(), det.volumes().size());
+    ASSERT_EQ(det.volume_material(0u), mat);
+
+    using navigator_t = navigator<decltype(det)>;
+    using policy_t = stepper_volume_material_policy<>;
+    using stepper_t = line_stepper<transform3, unconstrained_step, policy_t>;
+    using actor_chain_t =
+        actor_chain<dtuple, propagation::print_inspector, pathlimit_aborter,
+                    parameter_transporter<transform3>,
+                    parameter_resetter<transform3>>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain_t>;
+
+    propagator_t p({}, {});
+
+    constexpr scalar q{-1.f};
+    constexpr scalar iniP{10.f * unit<scalar>::GeV};
+
+    typename bound_track_parameters<transform3>::vector_type bound_vector;
+    getter::element(bound_vector, e_bound_loc0, 0) = 0.f;
+    getter::element(bound_vector, e_bound_loc1, 0) = 0.f;
+    getter::element(bound_vector, e_bound_phi, 0) = 0.f;
+    getter::element(bound_vector, e_bound_theta, 0) = constant<scalar>::pi_2;
+    getter::element(bound_vector, e_bound_qoverp, 0) = q / iniP;
+    getter::element(bound_vector, e_bound_time, 0) = 0.f;
+    typename bound_track_parameters<transform3>::covariance_type bound_cov =
+        matrix_operator().template zero<e_bound_size, e_bound_size>();
+
+    const bound_track_parameters<transform3> bound_param(
+        geometry::barcode{}.set_index(0u), bound_vector, bound_cov);
+
+    propagation::print_inspector::state print_insp_state{};
+    pathlimit_aborter::state aborter_state{};
+    parameter_transporter<transform3>::state bound_updater{};
+    parameter_resetter<transform3>::state parameter_resetter_state{};
+
+    auto actor_states = std::tie(print_insp_state, aborter_state, bound_updater,
+                                 parameter_resetter_state);
+
+    propagator_t::state state(bound_param, det);
+
+    ASSERT_TRUE(p.propagate(state, actor_states))
+        << print_insp_state.to_string() << std::endl;
+
+    const auto& pol_state = state._stepping.policy_state();
+    const int pdg{pol_state.pdg};
+    const scalar mass{pol_state.mass};
+
+    // The track traversed the whole telescope volume
+    const scalar path_length{state._stepping.path_length()};
+    EXPECT_NEAR(path_length, positions.back() - positions.front(),
+                1.f * unit<scalar>::mm);
+
+    // Expected energy loss: Mean energy loss of a slab with the thickness of
+    // the total path length (the momentum changes only by a few percent)
+    interaction<scalar> I;
+    intersection2D<typename decltype(det)::surface_type, transform3> is;
+    is.cos_incidence_angle = 1.f;
+    const material_slab<scalar> slab(mat, path_length);
+    const scalar dE{
+        I.compute_energy_loss_bethe(is, slab, pdg, mass, q / iniP, q)};
+    ASSERT_GT(dE, 0.f);
+    EXPECT_NEAR(pol_state.e_loss, dE, 0.01f * dE);
+
+    const scalar newP{state._stepping._bound_params.charge() /
+                      state._stepping._bound_params.qop()};
+    const scalar newE{std::hypot(newP, mass)};
+    const scalar iniE{std::hypot(iniP, mass)};
+    EXPECT_NEAR(newE, iniE - pol_state.e_loss, 1e-3f * dE);
+
+    // The variances were added to the track covariance
+    EXPECT_GT(pol_state.qop_variance, 0.f);
+    EXPECT_GT(pol_state.scattering_variance, 0.f);
+    const auto& cov = state._stepping._bound_params.covariance();
+    EXPECT_NEAR(matrix_operator().element(cov, e_bound_qoverp, e_bound_qoverp),
+                pol_state.qop_variance, 0.01f * pol_state.qop_variance);
+    EXPECT_NEAR(matrix_operator().element(cov, e_bound_theta, e_bound_theta),
+                pol_state.scattering_variance,
+                0.01f * pol_state.scattering_variance);
+
+    // The scattering noise of a step is only transported from the end of the
+    // step on: The line stepper steps from module to module, so that the
+    // local position variance is the sum of the variances of the steps times
+    // the squared remaining distance to the last module
+    scalar dist2_sum{0.f};
+    for (std::size_t i = 1u; i < positions.size(); ++i) {
+        const scalar dist{positions.back() - positions[i]};
+        dist2_sum += dist * dist;
+    }
+    const scalar n_steps{static_cast<scalar>(positions.size() - 1u)};
+    const scalar var_loc{pol_state.scattering_variance / n_steps * dist2_sum};
+    ASSERT_GT(var_loc, 0.f);
+    EXPECT_NEAR(matrix_operator().element(cov, e_bound_loc0, e_bound_loc0),
+                var_loc, 0.02f * var_loc);
+    EXPECT_NEAR(matrix_operator().element(cov, e_bound_loc1, e_bound_loc1),
+                var_loc, 0.02f * var_loc);
+
+    // Bounded by the continuous limit of a thick scatterer
+    const scalar var_loc_cont{pol_state.scattering_variance * path_length *
+                              path_length / 3.f};
+    EXPECT_LT(matrix_operator().element(cov, e_bound_loc0, e_bound_loc0),
+              var_loc_cont);
+}
@@ -1018,4 +1018,58 @@ TEST(ALGEBRA_PLUGIN, toy_geometry) {
                       range, range[0], {mask_ids::e_portal_ring2, 50u},
                       {material_ids::e_slab, 3242u}, portal_mat,
                       {18u, leaving_world});
-}
\ No newline at end of file
+}
+// This test checks the volume search by position in the toy geometry
+TEST(ALGEBRA_PLUGIN, toy_geometry_volume_by_pos) {
+
+    using point3_t = __plugin::point3<detray::scalar>;
+
+    vecmem::host_memory_resource host_mr;
+    const auto toy_det = create_toy_geometry(host_mr, 4u, 7u);
+
+    const auto& volumes = toy_det.volumes();
+    const auto& v_grid = toy_det.volume_search_grid();
+    ASSERT_FALSE(toy_det.volume_index().empty());
+
+    // The volume that contains a point in its center and on its lower bounds
+    for (const auto& vol : volumes) {
+        const auto& b = vol.bounds();
+        const scalar r{0.5f * (b[0] + b[1])};
+        const scalar z{0.5f * (b[2] + b[3])};
+
+        for (const scalar phi : {-3.f, -1.f, 0.5f, 2.f}) {
+            const point3_t center{r * std::cos(phi), r * std::sin(phi), z};
+            EXPECT_EQ(toy_det.volume_by_pos(center).index(), vol.index());
+        }
+        const point3_t lower{b[0], 0.f, b[2]};
+        EXPECT_EQ(toy_det.volume_by_pos(lower).index(), vol.index());
+    }
+
+    // Scan the detector: uniform table, hinted and direct search agree
+    const auto r_span = v_grid.get_axis<n_axis::label::e_r>().span();
+    const auto z_span = v_grid.get_axis<n_axis::label::e_z>().span();
+    constexpr unsigned int n_steps{500u};
+    const scalar r_step{(r_span[1] - r_span[0]) / n_steps};
+    const scalar z_step{(z_span[1] - z_span[0]) / n_steps};
+
+    dindex hint{dindex_invalid};
+    for (unsigned int iz = 0u; iz < n_steps; ++iz) {
+        for (unsigned int ir = 0u; ir < n_steps; ++ir) {
+            const scalar r{r_span[0] + static_cast<scalar>(ir) * r_step};
+            const scalar z{z_span[0] + static_cast<scalar>(iz) * z_step};
+            const point3_t p{r, 0.f, z};
+            const point3_t loc_p{r, 0.f, z};
+
+            ASSERT_EQ(toy_det.volume_index().bins(v_grid.axes(), loc_p),
+                      v_grid.axes().bins(loc_p));
+
+            const dindex idx{toy_det.volume_by_pos(p).index()};
+            ASSERT_EQ(*v_grid.search(loc_p), idx);
+            ASSERT_EQ(toy_det.volume_by_pos(p, hint).index(), idx);
+            ASSERT_EQ(hint, idx);
+
+            const auto& b = volumes[idx].bounds();
+            EXPECT_TRUE(b[0] <= r and r < b[1] and b[2] <= z and z < b[3]);
+        }
+    }
+}
@@ -9,10 +9,10 @@
 
 // Project include(s)
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_intersection_kernel.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
 #include "detray/utils/ranges.hpp"
-#include "tests/common/tools/intersectors/helix_intersection_kernel.hpp"
 
 // System include(s)
 #include <cmath>
@@ -30,13 +30,16 @@ struct particle_gun {
     ///
     /// @param detector the detector.
     /// @param traj the trajectory to be shot through the detector.
-    /// @param epsilon numerical precision
+    /// @param use_bounding_spheres skip surfaces whose bounding sphere a ray
+    ///        cannot reach. Off by default, so that the scan stays exhaustive
+    ///        when it is used as the truth for the navigation validation.
     ///
     /// @return a sorted vector of volume indices with the corresponding
     ///         intersections of the surfaces that were encountered.
     template <typename detector_t, typename trajectory_t>
     DETRAY_HOST_DEVICE inline static auto shoot_particle(
-        const detector_t &detector, const trajectory_t &traj) {
+        const detector_t &detector, const trajectory_t &traj,
+        const bool use_bounding_spheres = false) {
 
         using intersection_t = intersection2D<typename detector_t::surface_type,
                                               typename detector_t::transform3>;
@@ -57,12 +60,22 @@ struct particle_gun {
 
         std::vector<intersection_t> intersections{};
 
+        constexpr auto mask_tol{
+            1.f * unit<typename detector_t::scalar_type>::um};
+
         for (const auto &volume : detector.volumes()) {
             for (const auto &sf : detector.surfaces(volume)) {
+                // Cheap rejection of surfaces that the ray cannot reach
+                if constexpr (not std::is_same_v<trajectory_t, helix_type>) {
+                    if (use_bounding_spheres and
+                        not detector.bounding_sphere(sf).is_reachable(
+                            traj, mask_tol)) {
+                        continue;
+                    }
+                }
                 // Retrieve candidate(s) from the surface
                 mask_store.template visit<intersection_kernel_t>(
-                    sf.mask(), intersections, traj, sf, tf_store,
-                    1.f * unit<typename detector_t::scalar_type>::um);
+                    sf.mask(), intersections, traj, sf, tf_store, mask_tol);
                 // Candidate is invalid if it lies in the opposite direction
                 for (auto &sfi : intersections) {
                     if (sfi.direction == intersection::direction::e_along) {
@@ -10,11 +10,13 @@
 // Project include(s)
 #include "detray/definitions/indexing.hpp"
 #include "detray/geometry/surface.hpp"
-#include "detray/grids/axis.hpp"
-#include "detray/grids/grid2.hpp"
-#include "detray/grids/populator.hpp"
-#include "detray/grids/serializer2.hpp"
+#include "detray/masks/cylinder2D.hpp"
 #include "detray/masks/rectangle2D.hpp"
+#include "detray/masks/ring2D.hpp"
+#include "detray/surface_finders/grid/grid.hpp"
+#include "detray/surface_finders/grid/populator.hpp"
+#include "detray/surface_finders/grid/serializer.hpp"
+#include "detray/tools/grid_factory.hpp"
 #include "detray/tools/local_object_finder.hpp"
 #include "detray/utils/ranges.hpp"
 
@@ -48,6 +50,34 @@ using plane_material_link_t = dtyped_index<plane_material_ids, dindex>;
 
 using binned_neighborhood = darray<darray<dindex, 2>, 2>;
 
+// Local finder grids: circular in r-phi and closed in z, or closed in r and
+// circular in phi
+using cylinder_grid =
+    grid<coordinate_axes<cylinder2D<>::axes<>, true>, dindex,
+         simple_serializer, replacer>;
+using disc_grid = grid<coordinate_axes<ring2D<>::axes<>, true>, dindex,
+                       simple_serializer, replacer>;
+
+/// @returns an empty, data owning 2D grid with regular binning
+template <typename grid_t>
+grid_t make_grid(unsigned int n_bins0, scalar min0, scalar max0,
+                 unsigned int n_bins1, scalar min1, scalar max1) {
+    using axes_t = typename grid_t::axes_type;
+
+    typename axes_t::boundary_storage_type axes_data(&host_mr);
+    typename axes_t::edges_storage_type bin_edges(&host_mr);
+    axes_data.push_back({0u, n_bins0});
+    axes_data.push_back({2u, n_bins1});
+    bin_edges.insert(bin_edges.end(), {min0, max0, min1, max1});
+
+    typename grid_t::bin_storage_type bin_data(&host_mr);
+    bin_data.resize(n_bins0 * n_bins1,
+                    populator<replacer>::template init<dindex>());
+
+    return grid_t(std::move(bin_data),
+                  axes_t(std::move(axes_data), std::move(bin_edges)));
+}
+
 /// This method creates a number (distances.size()) planes along a direction
 [[maybe_unused]] dvector<
     surface<plane_mask_link_t, plane_material_link_t, transform3>>
@@ -112,44 +142,23 @@ create_endcap_components(scalar inner_r, scalar outer_r, scalar pos_z,
     scalar step_phi{2.f * constant<scalar>::pi / static_cast<scalar>(n_phi)};
     dvector<transform3> transforms;
 
-    // Prepare the local finders
-    serializer2 serializer;
-
     // Declare the inner, outer, ecn, ecp object finder
-
-    using cylinder_grid = grid2<replace_populator, axis::circular,
-                                axis::regular, decltype(serializer)>;
-    using disc_grid = grid2<replace_populator, axis::regular, axis::circular,
-                            decltype(serializer)>;
-
-    typename cylinder_grid::axis_p0_type rphi_axis_inner = {
+    auto ec_grid_inner = make_grid<cylinder_grid>(
         n_phi, -volume_inner_r * (constant<scalar>::pi + 0.5f * step_phi),
-        volume_inner_r * (constant<scalar>::pi - 0.5f * step_phi), host_mr};
-    typename cylinder_grid::axis_p1_type z_axis_inner = {1u, volume_min_z,
-                                                         volume_max_z, host_mr};
-    typename cylinder_grid::axis_p0_type rphi_axis_outer = {
+        volume_inner_r * (constant<scalar>::pi - 0.5f * step_phi), 1u,
+        volume_min_z, volume_max_z);
+    auto ec_grid_outer = make_grid<cylinder_grid>(
         n_phi, -volume_outer_r * (constant<scalar>::pi + 0.5f * step_phi),
-        volume_outer_r * (constant<scalar>::pi - 0.5f * step_phi), host_mr};
-
-    typename disc_grid::axis_p0_type r_axis_ecn = {1u, volume_inner_r,
-                                                   volume_outer_r, host_mr};
-    typename disc_grid::axis_p1_type phi_axis_ecn = {
-        n_phi, -constant<scalar>::pi - 0.5f * step_phi,
-        constant<scalar>::pi - 0.5f * step_phi, host_mr};
-    typename disc_grid::axis_p0_type r_axis_ecp = {1u, volume_inner_r,
-                                                   volume_outer_r, host_mr};
-    typename disc_grid::axis_p1_type phi_axis_ecp = {
-        n_phi, -constant<scalar>::pi - 0.5f * step_phi,
-        constant<scalar>::pi - 0.5f * step_phi, host_mr};
-
-    cylinder_grid ec_grid_inner(std::move(rphi_axis_inner),
-                                std::move(z_axis_inner), host_mr);
-    cylinder_grid ec_grid_outer(std::move(rphi_axis_outer),
-                                std::move(z_axis_inner), host_mr);
-    disc_grid ec_grid_n(std::move(r_axis_ecn), std::move(phi_axis_ecn),
-                        host_mr);
-    disc_grid ec_grid_p(std::move(r_axis_ecp), std::move(phi_axis_ecp),
-                        host_mr);
+        volume_outer_r * (constant<scalar>::pi - 0.5f * step_phi), 1u,
+        volume_min_z, volume_max_z);
+    auto ec_grid_n = make_grid<disc_grid>(
+        1u, volume_inner_r, volume_outer_r, n_phi,
+        -constant<scalar>::pi - 0.5f * step_phi,
+        constant<scalar>::pi - 0.5f * step_phi);
+    auto ec_grid_p = make_grid<disc_grid>(
+        1u, volume_inner_r, volume_outer_r, n_phi,
+        -constant<scalar>::pi - 0.5f * step_phi,
+        constant<scalar>::pi - 0.5f * step_phi);
 
     scalar r{0.5f * (inner_r + outer_r)};
 
@@ -219,9 +228,6 @@ create_barrel_components(scalar r, scalar stagger_r, unsigned int n_phi,
                      static_cast<scalar>(n_z)};
     darray<scalar, 2> rectangle_bounds = {0.5f * module_lx, 0.5f * module_ly};
 
-    // Prepare the local finders
-    serializer2 serializer;
-
     // The detector transforms
     dvector<transform3> transforms;
     scalar step_phi{2.f * constant<scalar>::pi / static_cast<scalar>(n_phi)};
@@ -230,39 +236,22 @@ create_barrel_components(scalar r, scalar stagger_r, unsigned int n_phi,
                    (module_ly - overlap_z)};
 
     // Declare the inner, outer, ecn, ecp object finder
-    using cylinder_grid = grid2<replace_populator, axis::circular,
-                                axis::regular, decltype(serializer)>;
-    using disc_grid = grid2<replace_populator, axis::regular, axis::circular,
-                            decltype(serializer)>;
-
-    typename cylinder_grid::axis_p0_type rphi_axis_inner = {
+    auto barrel_grid_inner = make_grid<cylinder_grid>(
         n_phi, -volume_inner_r * (constant<scalar>::pi + 0.5f * step_phi),
-        volume_inner_r * (constant<scalar>::pi - 0.5f * step_phi), host_mr};
-    typename cylinder_grid::axis_p1_type z_axis_inner = {
-        n_z, -0.5f * length_z, 0.5f * length_z, host_mr};
-    typename cylinder_grid::axis_p0_type rphi_axis_outer = {
+        volume_inner_r * (constant<scalar>::pi - 0.5f * step_phi), n_z,
+        -0.5f * length_z, 0.5f * length_z);
+    auto barrel_grid_outer = make_grid<cylinder_grid>(
         n_phi, -volume_outer_r * (constant<scalar>::pi + 0.5f * step_phi),
-        volume_outer_r * (constant<scalar>::pi - 0.5f * step_phi), host_mr};
-    // axis::regular<> z_axis_outer = {n_z, -0.5f * length_z, 0.5f * length_z};
-    typename disc_grid::axis_p0_type r_axis_ecn = {1, volume_inner_r,
-                                                   volume_outer_r, host_mr};
-    typename disc_grid::axis_p1_type phi_axis_ecn = {
-        n_phi, -constant<scalar>::pi - 0.5f * step_phi,
-        constant<scalar>::pi - 0.5f * step_phi, host_mr};
-    typename disc_grid::axis_p0_type r_axis_ecp = {1, volume_inner_r,
-                                                   volume_outer_r, host_mr};
-    typename disc_grid::axis_p1_type phi_axis_ecp = {
-        n_phi, -constant<scalar>::pi - 0.5f * step_phi,
-        constant<scalar>::pi - 0.5f * step_phi, host_mr};
-
-    cylinder_grid barrel_grid_inner(std::move(rphi_axis_inner),
-                                    std::move(z_axis_inner), host_mr);
-    cylinder_grid barrel_grid_outer(std::move(rphi_axis_outer),
-                                    std::move(z_axis_inner), host_mr);
-    disc_grid barrel_grid_n(std::move(r_axis_ecn), std::move(phi_axis_ecn),
-                            host_mr);
-    disc_grid barrel_grid_p(std::move(r_axis_ecp), std::move(phi_axis_ecp),
-                            host_mr);
+        volume_outer_r * (constant<scalar>::pi - 0.5f * step_phi), n_z,
+        -0.5f * length_z, 0.5f * length_z);
+    auto barrel_grid_n = make_grid<disc_grid>(
+        1u, volume_inner_r, volume_outer_r, n_phi,
+        -constant<scalar>::pi - 0.5f * step_phi,
+        constant<scalar>::pi - 0.5f * step_phi);
+    auto barrel_grid_p = make_grid<disc_grid>(
+        1u, volume_inner_r, volume_outer_r, n_phi,
+        -constant<scalar>::pi - 0.5f * step_phi,
+        constant<scalar>::pi - 0.5f * step_phi);
 
     for (unsigned int iz = 0u; iz < n_z; ++iz) {
         scalar pos_z = start_z + static_cast<scalar>(iz) * step_z;
@@ -13,10 +13,10 @@
 #include "detray/intersection/cylinder_intersector.hpp"
 #include "detray/intersection/cylinder_portal_intersector.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_cylinder_intersector.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
 #include "detray/masks/masks.hpp"
-#include "tests/common/tools/intersectors/helix_cylinder_intersector.hpp"
 
 // System include(s)
 #include <cmath>
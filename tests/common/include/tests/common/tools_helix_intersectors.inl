@@ -8,10 +8,10 @@
 // Project include(s).
 #include "detray/definitions/units.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_cylinder_intersector.hpp"
+#include "detray/intersection/helix_plane_intersector.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/tracks/tracks.hpp"
-#include "tests/common/tools/intersectors/helix_cylinder_intersector.hpp"
-#include "tests/common/tools/intersectors/helix_plane_intersector.hpp"
 
 // Google Test include(s).
 #include <gtest/gtest.h>
@@ -68,6 +68,8 @@ TEST(tools, helix_plane_intersector) {
     const auto is = hpi(hlx, sf_handle, rectangle, trf);
 
     // Check the values
+    EXPECT_EQ(is.status, intersection::status::e_inside);
+    EXPECT_EQ(is.direction, intersection::direction::e_along);
     EXPECT_NEAR(is.path, path, tol);
     EXPECT_NEAR(is.p2[0], 0.f, tol);
     EXPECT_NEAR(is.p2[1], 0.f, tol);
@@ -122,3 +124,37 @@ TEST(tools, helix_cylinder_intersector) {
     EXPECT_NEAR(is.p3[1], pos[1], tol);
     EXPECT_NEAR(is.p3[2], pos[2], tol);
 }
+
+/// The seeds of the helix-cylinder intersector are iterated independently
+TEST(tools, helix_cylinder_intersector_seeds) {
+
+    // Track that starts inside a concentric cylinder
+    const free_track_parameters<transform3> free_trk(
+        {-13.f, 36.f, 6.f}, 0.f,
+        {0.36f * unit<scalar>::GeV, 0.36f * unit<scalar>::GeV,
+         -0.92f * unit<scalar>::GeV},
+        -1.f);
+
+    // Magnetic field
+    const vector3 B{0.f, 0.f, 2.f * unit<scalar>::T};
+
+    const detail::helix<transform3> hlx(free_trk, &B);
+
+    // Concentric cylinder surface
+    const scalar c_rad = 41.f * unit<scalar>::mm;
+    const detray::mask<detray::cylinder2D<>> cylinder{
+        0u, c_rad, -1.f * unit<scalar>::m, 1.f * unit<scalar>::m};
+    const transform3 trf{};
+
+    const detail::helix_cylinder_intersector<transform3> hci;
+    const auto is = hci(hlx, sf_handle, cylinder, trf);
+
+    // The second seed yields the intersection, whatever the first one does
+    ASSERT_EQ(is[1].status, intersection::status::e_inside);
+    EXPECT_EQ(is[1].direction, intersection::direction::e_along);
+    EXPECT_NEAR(getter::perp(is[1].p3), c_rad, tol);
+    const auto pos = hlx.pos(is[1].path);
+    EXPECT_NEAR(is[1].p3[0], pos[0], tol);
+    EXPECT_NEAR(is[1].p3[1], pos[1], tol);
+    EXPECT_NEAR(is[1].p3[2], pos[2], tol);
+}
@@ -12,12 +12,12 @@
 #include "detray/intersection/cylinder_intersector.hpp"
 #include "detray/intersection/cylinder_portal_intersector.hpp"
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_intersection_kernel.hpp"
 #include "detray/intersection/intersection_kernel.hpp"
 #include "detray/intersection/plane_intersector.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "detray/utils/ranges.hpp"
-#include "tests/common/tools/intersectors/helix_intersection_kernel.hpp"
 
 // Vecmem include(s)
 #include <vecmem/memory/host_memory_resource.hpp>
@@ -183,6 +183,151 @@ TEST(tools, intersection_kernel_ray) {
         ASSERT_EQ(sfi_init[i].p2, sfi_update[i].p2);
         ASSERT_EQ(sfi_init[i].path, sfi_update[i].path);
     }*/
+
+    // Path-only update after a step: Same path and status as the full update
+    const free_track_parameters<transform3_t> moved_track(
+        point3{0.005f, 0.005f, 5.f}, 0.f, mom, -1.f);
+
+    for (const auto &sfi : sfi_init) {
+        auto sfi_full = sfi;
+        auto sfi_path = sfi;
+
+        const bool full_valid = mask_store.visit<intersection_update>(
+            sfi.surface.mask(), detail::ray(moved_track), sfi_full,
+            transform_store, tol);
+        const bool path_valid = mask_store.visit<intersection_path_update>(
+            sfi.surface.mask(), detail::ray(moved_track), sfi_path,
+            transform_store, tol);
+
+        ASSERT_EQ(full_valid, path_valid)
+            << " at surface " << sfi.surface.barcode();
+        ASSERT_EQ(sfi_full.status, sfi_path.status);
+        ASSERT_NEAR(sfi_full.path, sfi_path.path, is_close);
+        // The cylinder update is ambiguous for two solutions and is skipped
+        if (sfi.surface.id() != surface_id::e_passive) {
+            ASSERT_NEAR(sfi_path.path, sfi.path - 5.f, 1e-3f);
+        }
+        // The remaining data is untouched
+        ASSERT_EQ(sfi_path.surface, sfi.surface);
+        ASSERT_EQ(sfi_path.p3, sfi.p3);
+    }
+
+    // Safety distances: Distance to the planes and to the cylinder axes
+    const std::vector<scalar> expected_safeties = {10.f, 20.f, 30.f, 45.f,
+                                                   96.f};
+    for (const auto [idx, surface] : detray::views::enumerate(surfaces)) {
+        const scalar safety{mask_store.visit<surface_safety>(
+            surface.mask(), pos, surface, transform_store)};
+        ASSERT_NEAR(safety, expected_safeties[idx], is_close)
+            << " at surface " << surface.barcode();
+    }
+    // The safety never exceeds the path to an intersection
+    for (const auto &sfi : sfi_init) {
+        ASSERT_LE(mask_store.visit<surface_safety>(sfi.surface.mask(), pos,
+                                                   sfi.surface,
+                                                   transform_store),
+                  sfi.path + is_close);
+    }
+}
+
+// Compare the batched intersection of a surface range with the intersection
+// surface by surface
+TEST(tools, intersection_kernel_batched) {
+    vecmem::host_memory_resource host_mr;
+
+    typename transform_container_t::context_type static_context{};
+    transform_container_t transform_store;
+    mask_container_t mask_store(host_mr);
+    surface_container_t rectangles, annuli, cylinders;
+
+    mask_store.template emplace_back<e_rectangle2>(empty_context{}, 0u, 10.f,
+                                                   10.f);
+    mask_store.template emplace_back<e_rectangle2>(empty_context{}, 1u, 3.f,
+                                                   3.f);
+    mask_store.template emplace_back<e_annulus2>(
+        empty_context{}, 0u, 15.f, 55.f, 0.75f, 1.95f, 2.f, -2.f, 0.f);
+    mask_store.template emplace_back<e_cylinder2>(empty_context{}, 0u, 5.f,
+                                                  -10.f, 10.f);
+
+    // More rectangles than fit into a single batch, some tilted, some
+    // smaller, some parallel to the ray
+    for (dindex i = 0u; i < 21u; ++i) {
+        const scalar z{10.f * static_cast<scalar>(i + 1u)};
+        const scalar shift{(i % 3u == 0u) ? 9.f : 0.f};
+        if (i % 5u == 4u) {
+            // Normal perpendicular to the ray
+            transform_store.emplace_back(static_context,
+                                         vector3{shift, 0.f, z},
+                                         vector3{1.f, 0.f, 0.f},
+                                         vector3{0.f, 0.f, 1.f});
+        } else if (i % 2u == 0u) {
+            transform_store.emplace_back(static_context,
+                                         vector3{shift, 0.f, z},
+                                         vector3{0.f, 0.6f, 0.8f},
+                                         vector3{1.f, 0.f, 0.f});
+        } else {
+            transform_store.emplace_back(static_context,
+                                         vector3{shift, 0.f, z});
+        }
+        const mask_link_t mask_link{e_rectangle2, i % 4u == 0u ? 1u : 0u};
+        rectangles.emplace_back(transform_store.size() - 1u, mask_link,
+                                material_link_t{e_slab, 0u}, 0u, i,
+                                surface_id::e_sensitive);
+    }
+    for (dindex i = 0u; i < 3u; ++i) {
+        transform_store.emplace_back(
+            static_context,
+            vector3{0.f, -20.f, 300.f + 10.f * static_cast<scalar>(i)});
+        annuli.emplace_back(transform_store.size() - 1u,
+                            mask_link_t{e_annulus2, 0u},
+                            material_link_t{e_slab, 0u}, 0u, 100u + i,
+                            surface_id::e_sensitive);
+    }
+    transform_store.emplace_back(static_context, vector3{0.f, 0.f, 50.f},
+                                 vector3{1.f, 0.f, 0.f},
+                                 vector3{0.f, 0.f, -1.f});
+    cylinders.emplace_back(transform_store.size() - 1u,
+                           mask_link_t{e_cylinder2, 0u},
+                           material_link_t{e_slab, 0u}, 0u, 200u,
+                           surface_id::e_passive);
+
+    const point3 pos{0.f, 0.f, 0.f};
+    const free_track_parameters<transform3_t> track(
+        pos, 0.f, vector3{0.01f, 0.01f, 10.f}, -1.f);
+    const detail::ray<transform3_t> ray(track);
+
+    for (const auto *sf_range : {&rectangles, &annuli, &cylinders}) {
+        std::vector<intersection2D<surface_t, transform3_t>> sfi_single;
+        std::vector<intersection2D<surface_t, transform3_t>> sfi_batched;
+
+        for (const auto &sf : *sf_range) {
+            mask_store.visit<intersection_initialize>(
+                sf.mask(), sfi_single, ray, sf, transform_store, tol);
+        }
+        mask_store.visit<intersection_initialize>(
+            detail::get<0>(sf_range->front().mask()), *sf_range, sfi_batched,
+            ray, transform_store, tol);
+
+        ASSERT_FALSE(sfi_single.empty());
+        ASSERT_EQ(sfi_single.size(), sfi_batched.size());
+        for (std::size_t i = 0u; i < sfi_single.size(); ++i) {
+            EXPECT_EQ(sfi_batched[i].surface, sfi_single[i].surface);
+            EXPECT_EQ(sfi_batched[i].status, sfi_single[i].status);
+            EXPECT_EQ(sfi_batched[i].direction, sfi_single[i].direction);
+            EXPECT_EQ(sfi_batched[i].volume_link, sfi_single[i].volume_link);
+            EXPECT_NEAR(sfi_batched[i].path, sfi_single[i].path, is_close);
+            EXPECT_NEAR(sfi_batched[i].cos_incidence_angle,
+                        sfi_single[i].cos_incidence_angle, is_close);
+            for (unsigned int j = 0u; j < 3u; ++j) {
+                EXPECT_NEAR(sfi_batched[i].p3[j], sfi_single[i].p3[j],
+                            is_close);
+            }
+            for (unsigned int j = 0u; j < 2u; ++j) {
+                EXPECT_NEAR(sfi_batched[i].p2[j], sfi_single[i].p2[j],
+                            is_close);
+            }
+        }
+    }
 }
 
 /// Re-use the intersection kernel test for particle gun
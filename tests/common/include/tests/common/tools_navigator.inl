@@ -8,8 +8,10 @@
 // Project include(s)
 #include "detray/definitions/indexing.hpp"
 #include "detray/detectors/create_toy_geometry.hpp"
+#include "detray/intersection/concentric_portal_intersector.hpp"
 #include "detray/propagator/line_stepper.hpp"
 #include "detray/propagator/navigator.hpp"
+#include "detray/simulation/event_generator/track_generators.hpp"
 #include "detray/tracks/tracks.hpp"
 #include "tests/common/tools/inspectors.hpp"
 
@@ -20,7 +22,10 @@
 #include <gtest/gtest.h>
 
 // System include(s)
+#include <algorithm>
+#include <limits>
 #include <map>
+#include <vector>
 
 namespace detray {
 
@@ -267,4 +272,130 @@ TEST(ALGEBRA_PLUGIN, navigator) {
     // Leave for debugging
     // std::cout << navigation.inspector().to_string() << std::endl;
     ASSERT_TRUE(navigation.is_complete()) << navigation.inspector().to_string();
-}
\ No newline at end of file
+}
+/// This tests that the candidates cache never holds more candidates than the
+/// device side candidate buffers are sized for: With all candidates kept,
+/// where every surface finder is counted with at most
+/// @c max_candidates_per_finder candidates, and with only the closest
+/// candidates kept, where the cache is refilled on a module
+TEST(ALGEBRA_PLUGIN, navigator_candidates_capacity) {
+    using namespace detray;
+    using transform3 = __plugin::transform3<scalar>;
+    using track_t = free_track_parameters<transform3>;
+
+    vecmem::host_memory_resource host_mr;
+
+    auto toy_det = create_toy_geometry(host_mr, 4u, 7u);
+
+    using detector_t = decltype(toy_det);
+    using navigator_t = navigator<detector_t>;
+    using stepper_t = line_stepper<transform3>;
+
+    // The toy detector links one surface finder per volume, which holds
+    // more surfaces than the limit
+    constexpr unsigned int no_limit{std::numeric_limits<unsigned int>::max()};
+    ASSERT_GT(toy_det.n_max_candidates(no_limit),
+              detector_t::max_candidates_per_finder);
+    ASSERT_EQ(toy_det.n_max_candidates(),
+              detector_t::max_candidates_per_finder);
+
+    stepper_t stepper;
+    navigator_t nav;
+
+    for (const unsigned int k : {0u, 3u}) {
+        toy_det.set_n_top_candidates(k);
+
+        // All candidates, or the three closest candidates and the module
+        // that is carried over
+        const std::size_t capacity{candidates_capacity(toy_det)};
+        ASSERT_EQ(capacity, k == 0u ? detector_t::max_candidates_per_finder
+                                    : k + 1u);
+
+        // Number of updates after which the cache was filled to capacity
+        std::size_t n_full{0u};
+
+        const point3 ori{0.f, 0.f, 0.f};
+        for (const auto track :
+             uniform_track_generator<track_t>(10u, 10u, ori)) {
+
+            prop_state<stepper_t::state, navigator_t::state> propagation{
+                stepper_t::state{track}, navigator_t::state(toy_det, host_mr)};
+            const navigator_t::state &navigation = propagation._navigation;
+
+            bool heartbeat = nav.init(propagation);
+            while (heartbeat) {
+                ASSERT_LE(navigation.candidates().size(), capacity);
+
+                heartbeat &= stepper.step(propagation);
+                propagation._navigation.set_high_trust();
+                heartbeat = nav.update(propagation);
+
+                n_full += (navigation.candidates().size() == capacity) ? 1u
+                                                                       : 0u;
+            }
+            ASSERT_LE(navigation.candidates().size(), capacity);
+            ASSERT_TRUE(navigation.is_complete());
+        }
+        // Some of the caches were refilled
+        if (k > 0u) {
+            EXPECT_GT(n_full, 0u);
+        }
+    }
+}
+
+/// This tests the closed-form portal intersection of the volumes against the
+/// generic intersectors
+TEST(ALGEBRA_PLUGIN, exit_portal) {
+    using namespace detray;
+    using transform3 = __plugin::transform3<scalar>;
+    using ray_t = detail::ray<transform3>;
+
+    vecmem::host_memory_resource host_mr;
+
+    /// Tolerance for tests
+    constexpr scalar tol{1e-3f};
+    constexpr scalar mask_tol{1.f * unit<scalar>::um};
+
+    auto toy_det = create_toy_geometry(host_mr, 4u, 3u);
+    using detector_t = decltype(toy_det);
+    using intersection_t = intersection2D<typename detector_t::surface_type,
+                                          typename detector_t::transform3>;
+
+    for (const auto &vol : toy_det.volumes()) {
+        // Start in the middle of the volume
+        const auto &b = vol.bounds();
+        const point3 ori{0.5f * (b[0] + b[1]), 0.f, 0.5f * (b[2] + b[3])};
+
+        for (const auto ray : uniform_track_generator<ray_t>(10u, 10u, ori)) {
+
+            // Brute force: Intersect every portal with the generic
+            // intersectors and find the closest one
+            std::vector<intersection_t> candidates;
+            for (const auto &sf : toy_det.surfaces(vol)) {
+                if (not sf.is_portal()) {
+                    continue;
+                }
+                toy_det.mask_store()
+                    .template visit<intersection_initialize>(
+                        sf.mask(), candidates, ray, sf,
+                        toy_det.transform_store(), mask_tol);
+            }
+            ASSERT_FALSE(candidates.empty());
+            const auto closest =
+                *std::min_element(candidates.begin(), candidates.end());
+
+            const intersection_t exit =
+                exit_portal(toy_det, vol, ray, mask_tol);
+
+            ASSERT_EQ(exit.status, intersection::status::e_inside);
+            ASSERT_EQ(exit.surface.barcode(), closest.surface.barcode())
+                << "volume " << vol.index();
+            ASSERT_NEAR(exit.path, closest.path, tol);
+            ASSERT_EQ(exit.volume_link, closest.volume_link);
+            ASSERT_NEAR(exit.p2[0], closest.p2[0], tol);
+            ASSERT_NEAR(exit.p2[1], closest.p2[1], tol);
+            ASSERT_NEAR(exit.cos_incidence_angle, closest.cos_incidence_angle,
+                        tol);
+        }
+    }
+}
@@ -52,6 +52,15 @@ TEST(tools, particle_gun) {
         const auto intersection_record =
             particle_gun::shoot_particle(toy_det, test_ray);
 
+        // The bounding spheres must not reject any surface that is hit
+        const auto sphere_record =
+            particle_gun::shoot_particle(toy_det, test_ray, true);
+        ASSERT_EQ(sphere_record.size(), intersection_record.size());
+        for (std::size_t i = 0u; i < sphere_record.size(); ++i) {
+            EXPECT_EQ(sphere_record[i].second.surface.barcode(),
+                      intersection_record[i].second.surface.barcode());
+        }
+
         expected.push_back(intersection_record);
     }
 
@@ -7,11 +7,11 @@
 
 // Project include(s)
 #include "detray/intersection/detail/trajectories.hpp"
+#include "detray/intersection/helix_plane_intersector.hpp"
 #include "detray/intersection/intersection.hpp"
 #include "detray/intersection/plane_intersector.hpp"
 #include "detray/masks/masks.hpp"
 #include "detray/masks/unmasked.hpp"
-#include "tests/common/tools/intersectors/helix_plane_intersector.hpp"
 
 // GTest include(s)
 #include <gtest/gtest.h>
@@ -19,6 +19,7 @@
 #include "detray/propagator/actors/pointwise_material_interactor.hpp"
 #include "detray/propagator/base_actor.hpp"
 #include "detray/propagator/line_stepper.hpp"
+#include "detray/propagator/navigation_statistics.hpp"
 #include "detray/propagator/navigator.hpp"
 #include "detray/propagator/propagator.hpp"
 #include "detray/propagator/rk_stepper.hpp"
@@ -26,6 +27,10 @@
 #include "detray/tracks/tracks.hpp"
 #include "tests/common/tools/inspectors.hpp"
 
+// System include(s)
+#include <thread>
+#include <vector>
+
 using namespace detray;
 using transform3 = __plugin::transform3<detray::scalar>;
 
@@ -159,6 +164,126 @@ TEST(ALGEBRA_PLUGIN, propagator_line_stepper) {
         << state._navigation.inspector().to_string() << std::endl;
 }
 
+/// Test the aggregation of the navigation counters from several threads
+TEST(ALGEBRA_PLUGIN, propagator_navigation_statistics) {
+
+    using counter = navigation::counter;
+
+    vecmem::host_memory_resource host_mr;
+
+    using b_field_t = decltype(create_toy_geometry(host_mr))::bfield_type;
+    const auto d = create_toy_geometry(
+        host_mr, b_field_t(b_field_t::backend_t::configuration_t{
+                     0.f * unit<scalar>::T, 0.f * unit<scalar>::T,
+                     2.f * unit<scalar>::T}));
+
+    using navigator_t =
+        navigator<decltype(d), navigation::statistics_inspector>;
+    using track_t = free_track_parameters<transform3>;
+    using stepper_t = rk_stepper<b_field_t::view_t, transform3>;
+    using propagator_t = propagator<stepper_t, navigator_t, actor_chain<>>;
+
+    const point3 ori{0.f, 0.f, 0.f};
+    std::vector<track_t> tracks;
+    for (auto track : uniform_track_generator<track_t>(
+             10u, 10u, ori, 1.f * unit<scalar>::GeV)) {
+        tracks.push_back(track);
+    }
+
+    // Fill the counters of the tracks concurrently
+    constexpr std::size_t n_threads{4u};
+    navigation_statistics stats{};
+    std::vector<navigation::track_statistics> track_stats(tracks.size());
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0u; t < n_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            propagator_t p(stepper_t{}, navigator_t{});
+            for (std::size_t i = t; i < tracks.size(); i += n_threads) {
+                propagator_t::state state(tracks[i], d.get_bfield(), d);
+                p.propagate(state);
+
+                stats.fill(state);
+                track_stats[i] = state._navigation.inspector().counters();
+                track_stats[i][counter::e_steps] =
+                    static_cast<unsigned int>(state._stepping._n_steps);
+                track_stats[i][counter::e_rejected_trials] =
+                    static_cast<unsigned int>(
+                        state._stepping._n_rejected_trials);
+            }
+        });
+    }
+    for (auto &th : threads) {
+        th.join();
+    }
+
+    ASSERT_EQ(stats.n_tracks(), tracks.size());
+    for (std::size_t c = 0u; c < navigation_statistics::n_counters; ++c) {
+        const auto cnt{static_cast<counter>(c)};
+
+        std::size_t total{0u}, max{0u};
+        std::vector<std::size_t> hist(navigation_statistics::n_bins, 0u);
+        for (const auto &ts : track_stats) {
+            total += ts[cnt];
+            max = ts[cnt] > max ? ts[cnt] : max;
+            ++hist[navigation_statistics::bin(ts[cnt])];
+        }
+        EXPECT_EQ(stats.total(cnt), total) << navigation::counter_names[c];
+        EXPECT_EQ(stats.max(cnt), max) << navigation::counter_names[c];
+        for (std::size_t b = 0u; b < navigation_statistics::n_bins; ++b) {
+            EXPECT_EQ(stats.n_entries(cnt, b), hist[b])
+                << navigation::counter_names[c] << ", bin " << b;
+        }
+    }
+
+    // Every volume that is entered is initialized
+    EXPECT_EQ(stats.total(counter::e_aborts), 0u);
+    EXPECT_TRUE(stats.total(counter::e_volume_switches) > 0u);
+    EXPECT_TRUE(stats.total(counter::e_steps) > 0u);
+    EXPECT_TRUE(stats.total(counter::e_intersections_no_trust) > 0u);
+    for (const auto &ts : track_stats) {
+        EXPECT_TRUE(ts[counter::e_reinits] >= ts[counter::e_volume_switches]);
+    }
+
+    // Steps that are limited by a constraint re-evaluate all candidates
+    // (fair trust): the tracks still take the same path through the detector
+    using fair_stepper_t =
+        rk_stepper<b_field_t::view_t, transform3, constrained_step<>>;
+    using fair_propagator_t =
+        propagator<fair_stepper_t, navigator_t, actor_chain<>>;
+
+    navigation_statistics fair_stats{};
+    fair_propagator_t fair_p(fair_stepper_t{}, navigator_t{});
+    for (std::size_t i = 0u; i < tracks.size(); ++i) {
+        fair_propagator_t::state state(tracks[i], d.get_bfield(), d);
+        state._stepping.template set_constraint<step::constraint::e_user>(
+            5.f * unit<scalar>::mm);
+        fair_p.propagate(state);
+
+        fair_stats.fill(state);
+        const auto &ts = state._navigation.inspector().counters();
+        EXPECT_EQ(ts[counter::e_volume_switches],
+                  track_stats[i][counter::e_volume_switches]);
+        // Every intersection is counted once, in the trust level of the
+        // update that computed it
+        const auto &navigation = state._navigation;
+        EXPECT_EQ(ts[counter::e_intersections_no_trust] +
+                      ts[counter::e_intersections_fair] +
+                      ts[counter::e_intersections_high],
+                  navigation.n_intersections());
+        EXPECT_EQ(ts[counter::e_intersections_high],
+                  navigation.n_intersections(navigation::trust_level::e_high));
+    }
+    EXPECT_EQ(fair_stats.total(counter::e_aborts), 0u);
+    EXPECT_TRUE(fair_stats.total(counter::e_resorts) > 0u);
+    EXPECT_TRUE(fair_stats.total(counter::e_intersections_fair) > 0u);
+
+    // Empty histograms after reset
+    stats.reset();
+    EXPECT_EQ(stats.n_tracks(), 0u);
+    EXPECT_EQ(stats.total(counter::e_steps), 0u);
+    EXPECT_EQ(stats.n_entries(counter::e_steps, 0u), 0u);
+}
+
 class PropagatorWithRkStepper
     : public ::testing::TestWithParam<
           std::tuple<__plugin::vector3<scalar>, scalar, scalar>> {};
@@ -0,0 +1,60 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s).
+#include "detray/detectors/create_telescope_detector.hpp"
+#include "detray/detectors/create_toy_geometry.hpp"
+#include "detray/io/json/json_report_writer.hpp"
+
+// VecMem include(s).
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// System include(s).
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+using namespace detray;
+
+namespace {
+
+/// Print the memory layout report of @param det to stdout
+template <typename detector_t>
+void print_report(const detector_t &det, const std::string &name) {
+    std::cout << std::setw(4)
+              << json_report_writer<detector_t>::get_json(det, name)
+              << std::endl;
+}
+
+}  // namespace
+
+/// Prints the memory layout report of one of the bundled detectors as json.
+///
+/// Usage: detray_detector_report [toy|telescope]
+int main(int argc, char **argv) {
+
+    const std::string geometry{argc > 1 ? argv[1] : "toy"};
+
+    // Memory resource
+    vecmem::host_memory_resource host_mr;
+
+    if (geometry == "toy") {
+        print_report(create_toy_geometry(host_mr), "toy_detector");
+    } else if (geometry == "telescope") {
+        // Rectangular telescope planes
+        mask<rectangle2D<>> rectangle{0u, 20.f * unit<scalar>::mm,
+                                      20.f * unit<scalar>::mm};
+        print_report(create_telescope_detector(host_mr, rectangle),
+                     "telescope_detector");
+    } else {
+        std::cerr << "Unknown geometry '" << geometry
+                  << "', choose one of: toy, telescope" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -15,10 +15,12 @@
 
 // detray core
 #include "detray/definitions/indexing.hpp"
-#include "detray/grids/axis.hpp"
-#include "detray/grids/grid2.hpp"
-#include "detray/grids/populator.hpp"
-#include "detray/grids/serializer2.hpp"
+#include "detray/masks/rectangle2D.hpp"
+#include "detray/surface_finders/grid/axis.hpp"
+#include "detray/surface_finders/grid/grid.hpp"
+#include "detray/surface_finders/grid/populator.hpp"
+#include "detray/surface_finders/grid/serializer.hpp"
+#include "detray/tools/grid_factory.hpp"
 #include "detray/tools/local_object_finder.hpp"
 
 using namespace detray;
@@ -27,22 +29,28 @@ using namespace detray;
 TEST(utils, local_object_finder) {
     vecmem::host_memory_resource host_mr;
 
-    serializer2 serializer;
-
     test::point2<detray::scalar> p2 = {-4.5f, -4.5f};
 
-    using grid2r = grid2<replace_populator, axis::regular, axis::regular,
-                         decltype(serializer)>;
+    using axes_t = coordinate_axes<rectangle2D<>::axes<>, true>;
+    using grid2r = grid<axes_t, dindex, simple_serializer, replacer>;
+
+    // 10x10 bins in [-5, 5]
+    typename axes_t::boundary_storage_type axes_data(&host_mr);
+    typename axes_t::edges_storage_type bin_edges(&host_mr);
+    axes_data.push_back({0u, 10u});
+    axes_data.push_back({2u, 10u});
+    bin_edges.insert(bin_edges.end(), {-5.f, 5.f, -5.f, 5.f});
 
-    typename grid2r::axis_p0_type xaxis{10u, -5.f, 5.f, host_mr};
-    typename grid2r::axis_p1_type yaxis{10u, -5.f, 5.f, host_mr};
+    typename grid2r::bin_storage_type bin_data(&host_mr);
+    bin_data.resize(100u, populator<replacer>::init<dindex>());
 
-    grid2r g2(std::move(xaxis), std::move(yaxis), host_mr);
+    grid2r g2(std::move(bin_data),
+              axes_t(std::move(axes_data), std::move(bin_edges)));
 
     g2.populate(p2, 8u);
 
     dvector<dindex> expected = {8u};
-    EXPECT_EQ(g2.zone(p2), expected);
+    EXPECT_EQ(g2.search(p2, grid2r::neighborhood_type<dindex>{}), expected);
 
     local_zone_finder<grid2r> local_zone(std::move(g2));
 
@@ -13,7 +13,11 @@
 #include "navigator_cuda_kernel.hpp"
 #include "vecmem/utils/cuda/copy.hpp"
 
-TEST(navigator_cuda, navigator) {
+namespace {
+
+/// Compares the navigation on host and device, when the navigator keeps the
+/// @param n_top_candidates closest candidates (zero: all candidates)
+void check_navigation(const unsigned int n_top_candidates) {
 
     // Helper object for performing memory copies.
     vecmem::cuda::copy copy;
@@ -25,6 +29,7 @@ TEST(navigator_cuda, navigator) {
     // Create detector
     detector_host_t det = create_toy_geometry<host_container_types>(
         mng_mr, n_brl_layers, n_edc_layers);
+    det.set_n_top_candidates(n_top_candidates);
 
     // Create navigator
     navigator_host_t nav;
@@ -141,4 +146,16 @@ TEST(navigator_cuda, navigator) {
             EXPECT_NEAR(pos_host[2], pos_device[2], pos_diff_tolerance);
         }
     }
-}
\ No newline at end of file
+}
+
+}  // anonymous namespace
+
+TEST(navigator_cuda, navigator) {
+    check_navigation(0u);
+}
+
+/// Only the closest candidates are cached, so that the caches in the
+/// candidates buffer are refilled when a track reaches their last module
+TEST(navigator_cuda, navigator_top_k) {
+    check_navigation(3u);
+}
@@ -0,0 +1,318 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/create_toy_geometry.hpp"
+#include "detray/io/binary/binary_grid_reader.hpp"
+#include "detray/io/binary/binary_grid_writer.hpp"
+#include "detray/io/json/json_geometry_writer.hpp"
+#include "detray/io/json/json_grid_reader.hpp"
+#include "detray/materials/predefined_materials.hpp"
+#include "detray/tools/bin_fillers.hpp"
+#include "detray/tools/grid_builder.hpp"
+#include "detray/tools/grid_factory.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <algorithm>
+#include <sstream>
+
+using namespace detray;
+
+namespace {
+
+using detector_t = detector<detector_registry::toy_detector>;
+using point3 = __plugin::point3<scalar>;
+
+/// Detector metadata with a grid collection for modules on cylinders
+struct surface_grid_metadata : public detector_registry::default_detector {
+
+    enum class sf_finder_ids {
+        e_brute_force = 0,
+        e_cylinder_grid = 1,
+        e_default = e_brute_force,
+    };
+
+    template <template <typename...> class tuple_t = dtuple,
+              typename container_t = host_container_types>
+    using surface_finder_store = multi_store<
+        sf_finder_ids, empty_context, tuple_t,
+        brute_force_collection<surface_type, container_t>,
+        grid_collection<cylinder_sf_grid<surface_type, container_t>>>;
+};
+
+using grid_detector_t = detector<surface_grid_metadata>;
+
+/// Exposes the grid (de)serialization of the writer and reader base classes
+template <typename det_t = detector_t>
+struct grid_io : public geometry_writer<det_t>, public grid_reader<det_t> {
+    using geometry_writer<det_t>::serialize;
+    using geometry_writer<det_t>::serialize_grid;
+    using grid_reader<det_t>::deserialize;
+};
+
+/// Build a detector with one volume of modules on a cylinder, which is
+/// linked to a surface grid. The grid itself is only built, if
+/// @param with_grid is set.
+grid_detector_t build_grid_detector(vecmem::memory_resource& resource,
+                                    const bool with_grid) {
+    using mask_id = typename grid_detector_t::masks::id;
+    using material_id = typename grid_detector_t::materials::id;
+    using mask_link_t = typename grid_detector_t::mask_link;
+    using material_link_t = typename grid_detector_t::material_link;
+
+    constexpr auto grid_id{grid_detector_t::sf_finders::id::e_cylinder_grid};
+    using cyl_grid_t =
+        typename grid_detector_t::surface_container::template get_type<
+            grid_id>;
+
+    grid_detector_t det(resource);
+    typename grid_detector_t::geometry_context geo_ctx{};
+    empty_context empty_ctx{};
+
+    auto& vol = det.new_volume(volume_id::e_cylinder,
+                               {10.f, 20.f, -5.f, 5.f, -constant<scalar>::pi,
+                                constant<scalar>::pi});
+
+    typename grid_detector_t::transform_container trfs(resource);
+    typename grid_detector_t::surface_container_t surfaces{};
+    typename grid_detector_t::mask_container masks(resource);
+    typename grid_detector_t::material_container materials(resource);
+
+    // Four modules, one in every grid bin
+    for (dindex i = 0u; i < 4u; ++i) {
+        trfs.emplace_back(geo_ctx, point3{0.f, i % 2u == 0u ? -15.f : 15.f,
+                                          i < 2u ? -2.5f : 2.5f});
+        masks.template emplace_back<mask_id::e_rectangle2>(empty_ctx, 0u, 1.f,
+                                                           2.f);
+        materials.template emplace_back<material_id::e_slab>(
+            empty_ctx, silicon<scalar>(), 1.f);
+        surfaces.emplace_back(i, mask_link_t{mask_id::e_rectangle2, i},
+                              material_link_t{material_id::e_slab, i}, 0u,
+                              dindex_invalid, surface_id::e_sensitive);
+    }
+    det.add_objects_per_volume(geo_ctx, vol, surfaces, masks, trfs,
+                               materials);
+
+    if (with_grid) {
+        auto gbuilder =
+            grid_builder<grid_detector_t, cyl_grid_t, detail::fill_by_pos>{};
+        gbuilder.init_grid(mask<cylinder2D<>>{0u, 15.f, -5.f, 5.f}, {2u, 2u});
+        gbuilder.fill_grid(det, vol, geo_ctx);
+        det.surface_store().template push_back<grid_id>(gbuilder());
+    }
+    vol.set_link(grid_id, 0u);
+
+    // Otherwise, the navigation metadata still describes the brute force
+    // collection, like in a detector whose grids have not been read yet
+    if (with_grid) {
+        det.update_navigation_info(geo_ctx);
+    }
+
+    return det;
+}
+
+/// Check that the navigation metadata of two detectors is identical
+template <typename det_t>
+void check_navigation_info(const det_t& det, const det_t& ref_det) {
+    ASSERT_EQ(det.navigation_info().size(), ref_det.navigation_info().size());
+    for (const auto& vol : ref_det.volumes()) {
+        const auto& info = det.navigation_info(vol.index());
+        const auto& ref_info = ref_det.navigation_info(vol.index());
+
+        EXPECT_EQ(info.max_candidates, ref_info.max_candidates);
+        EXPECT_EQ(info.typical_candidates, ref_info.typical_candidates);
+        EXPECT_EQ(info.n_portals, ref_info.n_portals);
+        EXPECT_EQ(info.extent, ref_info.extent);
+    }
+}
+
+/// Check that the volume grids of two detectors are identical
+void check_volume_grids(const detector_t& det, const detector_t& ref_det) {
+    const auto& v_grid = det.volume_search_grid();
+    const auto& ref_grid = ref_det.volume_search_grid();
+
+    ASSERT_EQ(v_grid.nbins(), ref_grid.nbins());
+    for (dindex gbin = 0u; gbin < ref_grid.nbins(); ++gbin) {
+        EXPECT_EQ(*v_grid.at(gbin), *ref_grid.at(gbin));
+    }
+    EXPECT_EQ(v_grid.axes().nbins(), ref_grid.axes().nbins());
+    EXPECT_EQ(*v_grid.axes().data().edges(), *ref_grid.axes().data().edges());
+
+    // The lookup table of the volume grid was rebuilt
+    EXPECT_EQ(det.volume_index().n_cells(), ref_det.volume_index().n_cells());
+    for (const auto& vol : ref_det.volumes()) {
+        const auto& b = vol.bounds();
+        const point3 p{0.5f * (b[0] + b[1]), 0.f, 0.5f * (b[2] + b[3])};
+        EXPECT_EQ(det.volume_by_pos(p).index(), vol.index());
+    }
+}
+
+}  // anonymous namespace
+
+/// Test the reading of the toy detector volume grid from json
+TEST(io, json_toy_grid_reader) {
+
+    vecmem::host_memory_resource host_mr;
+    const detector_t ref_det = create_toy_geometry(host_mr);
+
+    json_geometry_writer<detector_t> geo_writer;
+    geo_writer.write(ref_det, "toy_detector_grids");
+
+    // Same detector, but without volume grid
+    detector_t det = create_toy_geometry(host_mr);
+    det.add_volume_finder(typename detector_t::volume_finder{host_mr});
+    ASSERT_TRUE(det.volume_index().empty());
+
+    json_grid_reader<detector_t> grid_reader;
+    grid_reader.read(det, host_mr, "toy_detector_grids");
+
+    check_volume_grids(det, ref_det);
+    check_navigation_info(det, ref_det);
+}
+
+/// Test the reading of the toy detector volume grid from binary file
+TEST(io, binary_toy_grid_reader) {
+
+    vecmem::host_memory_resource host_mr;
+    const detector_t ref_det = create_toy_geometry(host_mr);
+
+    binary_grid_writer<detector_t> grid_writer;
+    grid_writer.write(ref_det, "toy_detector");
+
+    // Same detector, but without volume grid
+    detector_t det = create_toy_geometry(host_mr);
+    det.add_volume_finder(typename detector_t::volume_finder{host_mr});
+
+    binary_grid_reader<detector_t> grid_reader;
+    grid_reader.read(det, host_mr, "toy_detector");
+
+    check_volume_grids(det, ref_det);
+    check_navigation_info(det, ref_det);
+
+    // A truncated file is rejected
+    std::stringstream stream;
+    detector_payload det_data;
+    det_data.volume_grid.grid =
+        grid_io<>::serialize_grid(ref_det.volume_search_grid());
+    to_binary(stream, det_data);
+    std::string data = stream.str();
+    std::stringstream truncated{data.substr(0u, data.size() / 2u)};
+    detector_payload trunc_data;
+    EXPECT_THROW(from_binary(truncated, trunc_data), std::runtime_error);
+}
+
+/// Test the round trip of a surface grid with multiple entries per bin
+TEST(io, surface_grid_payload) {
+
+    using grid_t = grid<coordinate_axes<cylinder2D<>::axes<>, true>, dindex,
+                        simple_serializer, regular_attacher<3>>;
+    using axes_t = typename grid_t::axes_type;
+
+    vecmem::host_memory_resource host_mr;
+
+    // Regular phi and z axes
+    typename axes_t::boundary_storage_type axes_data(&host_mr);
+    typename axes_t::edges_storage_type bin_edges(&host_mr);
+    axes_data.push_back({0u, 20u});
+    axes_data.push_back({2u, 10u});
+    bin_edges.insert(bin_edges.end(), {-10.f, 10.f, -50.f, 50.f});
+
+    typename grid_t::bin_storage_type bin_data(&host_mr);
+    bin_data.resize(200u, populator<regular_attacher<3>>::init<dindex>());
+    grid_t gr(std::move(bin_data),
+              axes_t(std::move(axes_data), std::move(bin_edges)));
+
+    for (dindex gbin = 0u; gbin < gr.nbins(); gbin += 3u) {
+        gr.populate(gbin, gbin);
+        gr.populate(gbin, gbin + 1u);
+    }
+
+    // Through json and binary
+    nlohmann::ordered_json j;
+    j["grid"] = grid_io<>::serialize_grid(gr);
+    grid_payload grid_data = j["grid"];
+
+    std::stringstream stream;
+    to_binary(stream, grid_data);
+    grid_payload bin_grid_data;
+    from_binary(stream, bin_grid_data);
+    EXPECT_EQ(bin_grid_data.entries, grid_data.entries);
+
+    const auto read_gr = grid_io<>::deserialize<grid_t>(
+        bin_grid_data, host_mr,
+        [](const std::size_t idx) { return static_cast<dindex>(idx); });
+
+    const grid_t& ref_gr = gr;
+    ASSERT_EQ(read_gr.nbins(), ref_gr.nbins());
+    for (dindex gbin = 0u; gbin < ref_gr.nbins(); ++gbin) {
+        const auto bin = ref_gr.at(gbin);
+        const auto read_bin = read_gr.at(gbin);
+        ASSERT_EQ(read_bin.size(), bin.size());
+        EXPECT_TRUE(std::equal(bin.begin(), bin.end(), read_bin.begin()));
+    }
+
+    // Axis type mismatch
+    grid_data.axes[0].binning = n_axis::binning::e_irregular;
+    EXPECT_THROW(
+        grid_io<>::deserialize<grid_t>(
+            grid_data, host_mr,
+            [](const std::size_t idx) { return static_cast<dindex>(idx); }),
+        std::invalid_argument);
+}
+
+/// Test the reading of a surface grid into a detector, in which the volume
+/// is already linked to the grid
+TEST(io, surface_grid_reader) {
+
+    constexpr auto grid_id{grid_detector_t::sf_finders::id::e_cylinder_grid};
+
+    vecmem::host_memory_resource host_mr;
+    const grid_detector_t ref_det = build_grid_detector(host_mr, true);
+    grid_detector_t det = build_grid_detector(host_mr, false);
+
+    // The navigation metadata still describes the brute force collection
+    ASSERT_NE(det.navigation_info(0u).max_candidates,
+              ref_det.navigation_info(0u).max_candidates);
+
+    // Through json and binary
+    const detector_payload det_data =
+        grid_io<grid_detector_t>::serialize(ref_det);
+    ASSERT_EQ(det_data.surface_grids.size(), 1u);
+
+    nlohmann::ordered_json j;
+    j["surface_grid"] = det_data.surface_grids[0];
+    const surface_grid_payload grid_data = j["surface_grid"];
+    std::stringstream stream;
+    to_binary(stream, grid_data);
+
+    detector_payload read_data;
+    read_data.surface_grids.emplace_back();
+    from_binary(stream, read_data.surface_grids[0]);
+
+    grid_io<grid_detector_t>::deserialize(read_data, det, host_mr);
+
+    const auto& ref_coll = ref_det.surface_store().template get<grid_id>();
+    const auto& coll = det.surface_store().template get<grid_id>();
+    ASSERT_EQ(coll.size(), 1u);
+    const auto gr = coll[0u];
+    const auto ref_gr = ref_coll[0u];
+    ASSERT_EQ(gr.nbins(), ref_gr.nbins());
+    for (dindex gbin = 0u; gbin < ref_gr.nbins(); ++gbin) {
+        const auto bin = ref_gr.at(gbin);
+        const auto read_bin = gr.at(gbin);
+        EXPECT_TRUE(std::equal(bin.begin(), bin.end(), read_bin.begin()));
+    }
+
+    // The navigation metadata was updated for the new grid
+    check_navigation_info(det, ref_det);
+}
@@ -0,0 +1,123 @@
+/** Detray library, part of the ACTS project (R&D line)
+ *
+ * (c) 2023 CERN for the benefit of the ACTS project
+ *
+ * Mozilla Public License Version 2.0
+ */
+
+// Project include(s)
+#include "detray/detectors/create_toy_geometry.hpp"
+#include "detray/io/json/json_navigation_report_writer.hpp"
+#include "detray/io/json/json_report_writer.hpp"
+
+// Vecmem include(s)
+#include <vecmem/memory/host_memory_resource.hpp>
+
+// GTest include(s)
+#include <gtest/gtest.h>
+
+// System include(s)
+#include <limits>
+#include <numeric>
+#include <vector>
+
+using namespace detray;
+
+/// Test the memory layout report of the toy detector
+TEST(io, json_toy_report_writer) {
+
+    using detector_t = detector<detector_registry::toy_detector>;
+
+    // Toy detector
+    vecmem::host_memory_resource host_mr;
+    detector_t det = create_toy_geometry(host_mr);
+
+    nlohmann::ordered_json j =
+        json_report_writer<detector_t>::get_json(det, "toy_detector");
+    detector_report_payload report = j;
+
+    EXPECT_EQ(report.name, "toy_detector");
+
+    // Check the memory footprint of the stores
+    std::size_t total_bytes{0u};
+    for (const auto& st : report.stores) {
+        EXPECT_EQ(st.bytes, st.n_elements * st.element_size) << st.name;
+        EXPECT_TRUE(st.capacity_bytes >= st.bytes) << st.name;
+        EXPECT_TRUE(st.padding < st.element_size) << st.name;
+        total_bytes += st.bytes;
+    }
+    EXPECT_EQ(report.total_bytes, total_bytes);
+    EXPECT_EQ(report.stores[0].name, "volumes");
+    EXPECT_EQ(report.stores[0].n_elements, det.volumes().size());
+    EXPECT_EQ(report.stores[1].name, "transforms");
+    EXPECT_EQ(report.stores[1].n_elements, det.transform_store().size());
+
+    // Check the surface content of the volumes
+    ASSERT_EQ(report.volumes.size(), det.volumes().size());
+    std::size_t n_surfaces{0u};
+    for (const auto& vol_data : report.volumes) {
+        n_surfaces +=
+            vol_data.n_sensitives + vol_data.n_portals + vol_data.n_passives;
+        EXPECT_TRUE(vol_data.n_portals > 0u);
+    }
+    EXPECT_EQ(n_surfaces, det.surfaces().size());
+
+    // Every volume contributes one entry to the candidates histogram
+    const auto& cand = report.candidates.counts;
+    EXPECT_EQ(std::accumulate(cand.begin(), cand.end(), std::size_t{0u}),
+              det.volumes().size());
+    // The report holds the candidates without the per-finder limit
+    EXPECT_EQ(cand.size() - 1u,
+              det.n_max_candidates(std::numeric_limits<unsigned int>::max()));
+
+    // Every bin of a grid contributes one entry to its occupancy histogram
+    ASSERT_EQ(report.grids.size(), 1u);
+    EXPECT_EQ(report.grids[0].name, "volume_finder");
+    for (const auto& grid_data : report.grids) {
+        const auto& occ = grid_data.occupancy.counts;
+        EXPECT_EQ(std::accumulate(occ.begin(), occ.end(), std::size_t{0u}),
+                  grid_data.n_bins);
+    }
+}
+
+/// Test the navigation statistics report
+TEST(io, json_navigation_report_writer) {
+
+    using counter = navigation::counter;
+
+    // Two tracks with known counters
+    navigation_statistics stats{};
+    navigation::track_statistics track_stats{};
+    track_stats[counter::e_steps] = 5u;
+    track_stats[counter::e_volume_switches] = 1u;
+    stats.fill(track_stats);
+    track_stats[counter::e_steps] = 12u;
+    stats.fill(track_stats);
+
+    nlohmann::ordered_json j =
+        json_navigation_report_writer::get_json(stats, "toy_detector");
+    navigation_report_payload report = j;
+
+    EXPECT_EQ(report.name, "toy_detector");
+    EXPECT_EQ(report.n_tracks, 2u);
+    ASSERT_EQ(report.counters.size(), navigation_statistics::n_counters);
+
+    // Logarithmic bins: 5 in [4, 8) and 12 in [8, 16)
+    const auto& steps = report.counters[0];
+    EXPECT_EQ(steps.name, "steps");
+    EXPECT_EQ(steps.total, 17u);
+    EXPECT_EQ(steps.max, 12u);
+    EXPECT_EQ(steps.counts.counts,
+              (std::vector<std::size_t>{0u, 0u, 0u, 1u, 1u}));
+
+    const auto& switches = report.counters[6];
+    EXPECT_EQ(switches.name, "volume_switches");
+    EXPECT_EQ(switches.total, 2u);
+    EXPECT_EQ(switches.counts.counts, (std::vector<std::size_t>{0u, 2u}));
+
+    // Counters that are zero for every track
+    const auto& aborts = report.counters[8];
+    EXPECT_EQ(aborts.name, "aborts");
+    EXPECT_EQ(aborts.total, 0u);
+    EXPECT_EQ(aborts.counts.counts, (std::vector<std::size_t>{2u}));
+}
@@ -22,9 +22,11 @@
 #include <covfie/core/field.hpp>
 
 // System include(s)
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 namespace detray {
 
@@ -912,6 +914,79 @@ void add_barrel_detector(
     }
 }
 
+/** Helper function that creates the volume search grid from the volume bounds.
+ *
+ * The r and z bin edges are the union of all volume boundaries and the phi
+ * axis has a single bin. Every bin is filled with the index of the volume
+ * that contains its center, the bins outside of the volumes keep an invalid
+ * index.
+ *
+ * @param det detector the volume grid should be added to
+ * @param resource vecmem memory resource
+ */
+template <typename detector_t>
+inline void add_volume_grid(detector_t &det,
+                            vecmem::memory_resource &resource) {
+
+    using volume_finder_t = typename detector_t::volume_finder;
+    using axes_t = typename volume_finder_t::axes_type;
+    using bin_storage_t = typename volume_finder_t::bin_storage_type;
+    using populator_t = populator<typename volume_finder_t::populator_impl>;
+
+    // Collect the volume boundaries in r and z
+    std::vector<scalar> r_edges, z_edges;
+    for (const auto &vol : det.volumes()) {
+        const auto &bounds = vol.bounds();
+        r_edges.insert(r_edges.end(), {bounds[0], bounds[1]});
+        z_edges.insert(z_edges.end(), {bounds[2], bounds[3]});
+    }
+    for (auto *edges : {&r_edges, &z_edges}) {
+        std::sort(edges->begin(), edges->end());
+        edges->erase(std::unique(edges->begin(), edges->end()), edges->end());
+    }
+    const auto n_r_bins{static_cast<dindex>(r_edges.size() - 1u)};
+    const auto n_z_bins{static_cast<dindex>(z_edges.size() - 1u)};
+
+    // Axes data: r (irregular), phi (regular, one bin), z (irregular)
+    typename axes_t::boundary_storage_type axes_data(&resource);
+    typename axes_t::edges_storage_type bin_edges(&resource);
+
+    axes_data.push_back({0u, n_r_bins});
+    bin_edges.insert(bin_edges.end(), r_edges.begin(), r_edges.end());
+    axes_data.push_back({static_cast<dindex>(bin_edges.size()), 1u});
+    bin_edges.insert(bin_edges.end(), {-constant<scalar>::pi,
+                                       constant<scalar>::pi});
+    const auto z_offset{static_cast<dindex>(bin_edges.size())};
+    axes_data.push_back({z_offset, z_offset + n_z_bins});
+    bin_edges.insert(bin_edges.end(), z_edges.begin(), z_edges.end());
+
+    // Open r and z axes have an additional under- and overflow bin
+    bin_storage_t bin_data(&resource);
+    bin_data.resize((n_r_bins + 2u) * (n_z_bins + 2u),
+                    populator_t::template init<dindex>());
+
+    volume_finder_t v_grid(std::move(bin_data),
+                           axes_t(std::move(axes_data), std::move(bin_edges)));
+
+    for (dindex ir = 0u; ir < n_r_bins; ++ir) {
+        for (dindex iz = 0u; iz < n_z_bins; ++iz) {
+            const scalar r{0.5f * (r_edges[ir] + r_edges[ir + 1u])};
+            const scalar z{0.5f * (z_edges[iz] + z_edges[iz + 1u])};
+
+            for (const auto &vol : det.volumes()) {
+                const auto &bounds = vol.bounds();
+                if (bounds[0] <= r and r < bounds[1] and bounds[2] <= z and
+                    z < bounds[3]) {
+                    v_grid.populate({{ir + 1u, 0u, iz + 1u}}, vol.index());
+                    break;
+                }
+            }
+        }
+    }
+
+    det.add_volume_finder(std::move(v_grid));
+}
+
 }  // namespace
 
 /** Builds a detray geometry that contains the innermost tml layers. The number
@@ -1112,6 +1187,9 @@ auto create_toy_geometry(
             edc_positions, edc_config);
     }
 
+    // volume search grid
+    add_volume_grid(det, resource);
+
     return det;
 }
 
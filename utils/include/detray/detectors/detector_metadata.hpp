@@ -71,6 +71,24 @@ using disc_sf_grid = surface_grid_t<ring2D<>::axes<>, bin_entry_t, container_t>;
 
 /// @}
 
+/// material map types (regular, closed binning)
+/// @{
+
+// material map definition: bin-content: a single material slab
+template <typename grid_shape_t, typename container_t>
+using material_map_t = grid<coordinate_axes<grid_shape_t, false, container_t>,
+                            slab, simple_serializer, replacer>;
+
+// cylindrical material map for barrel surfaces and cylinder portals
+template <typename container_t>
+using cylinder_map_t = material_map_t<cylinder2D<>::axes<>, container_t>;
+
+// disc material map for endcap surfaces and disc portals
+template <typename container_t>
+using disc_map_t = material_map_t<ring2D<>::axes<>, container_t>;
+
+/// @}
+
 /// Defines all available types
 template <typename dynamic_data, std::size_t kBrlGrids = 1,
           std::size_t kEdcGrids = 1, std::size_t kDefault = 1,
@@ -112,27 +130,35 @@ struct full_metadata {
         e_portal_ring2 = 5,
     };
 
-    /// How to store and link masks
+    /// How to store and link masks (the mask type is resolved through a
+    /// jump table, since the volumes mix many different shapes)
     template <template <typename...> class tuple_t = dtuple,
               template <typename...> class vector_t = dvector>
     using mask_store =
-        regular_multi_store<mask_ids, empty_context, tuple_t, vector_t,
-                            rectangle, trapezoid, annulus, cylinder,
-                            cylinder_portal, disc>;
+        regular_jump_table_store<mask_ids, empty_context, tuple_t, vector_t,
+                                 rectangle, trapezoid, annulus, cylinder,
+                                 cylinder_portal, disc>;
 
     /// Give your material types a name (needs to be consecutive to be matched
     /// to a type!)
     enum class material_ids {
         e_slab = 0,
         e_rod = 1,
-        e_none = 2,
+        e_disc_map = 2,
+        e_cylinder_map = 3,
+        e_none = 4,
     };
 
-    /// How to store and link materials
+    /// How to store and link materials (homogeneous materials and material
+    /// maps, which hold one grid of material slabs per surface)
     template <template <typename...> class tuple_t = dtuple,
-              template <typename...> class vector_t = dvector>
-    using material_store = regular_multi_store<material_ids, empty_context,
-                                               tuple_t, vector_t, slab, rod>;
+              typename container_t = host_container_types>
+    using material_store =
+        multi_store<material_ids, empty_context, tuple_t,
+                    typename container_t::template vector_type<slab>,
+                    typename container_t::template vector_type<rod>,
+                    grid_collection<disc_map_t<container_t>>,
+                    grid_collection<cylinder_map_t<container_t>>>;
 
     /// Surface type used for sensitives, passives and portals
     using transform_link = typename transform_store<>::link_type;
@@ -220,14 +246,20 @@ struct toy_metadata {
     /// to a type!)
     enum class material_ids {
         e_slab = 0,
-        e_none = 1,
+        e_disc_map = 1,
+        e_cylinder_map = 2,
+        e_none = 3,
     };
 
-    /// How to store and link materials
+    /// How to store and link materials (homogeneous materials and material
+    /// maps, which hold one grid of material slabs per surface)
     template <template <typename...> class tuple_t = dtuple,
-              template <typename...> class vector_t = dvector>
-    using material_store = regular_multi_store<material_ids, empty_context,
-                                               tuple_t, vector_t, slab>;
+              typename container_t = host_container_types>
+    using material_store =
+        multi_store<material_ids, empty_context, tuple_t,
+                    typename container_t::template vector_type<slab>,
+                    grid_collection<disc_map_t<container_t>>,
+                    grid_collection<cylinder_map_t<container_t>>>;
 
     /// Surface type used for sensitives, passives and portals
     using transform_link = typename transform_store<>::link_type;
@@ -326,13 +358,13 @@ struct telescope_metadata {
 
     /// How to store and link materials
     template <template <typename...> class tuple_t = dtuple,
-              template <typename...> class vector_t = dvector>
-    using material_store =
-        std::conditional_t<std::is_same_v<mask<mask_shape_t>, lines>,
-                           regular_multi_store<material_ids, empty_context,
-                                               tuple_t, vector_t, slab, rod>,
-                           regular_multi_store<material_ids, empty_context,
-                                               tuple_t, vector_t, slab>>;
+              typename container_t = host_container_types>
+    using material_store = std::conditional_t<
+        std::is_same_v<mask<mask_shape_t>, lines>,
+        regular_multi_store<material_ids, empty_context, tuple_t,
+                            container_t::template vector_type, slab, rod>,
+        regular_multi_store<material_ids, empty_context, tuple_t,
+                            container_t::template vector_type, slab>>;
 
     /// Surface type used for sensitives, passives and portals
     using transform_link = typename transform_store<>::link_type;